@@ -19,6 +19,7 @@
 #include <hpx/hpx.hpp>
 
 #include <hpx/include/parallel_algorithm.hpp>
+#include <hpx/include/thread_executors.hpp>
 #include <boost/range/irange.hpp>
 
 #include <memory>
@@ -33,6 +34,7 @@ bool header = true; // print csv heading
 double k = 0.5;     // heat transfer coefficient
 double dt = 1.;     // time step
 double dx = 1.;     // grid spacing
+bool affinity = false;  // keep partitions on the same core
 
 inline std::size_t idx(std::size_t i, int dir, std::size_t size)
 {
@@ -152,6 +154,19 @@ struct stepper
 
         auto Op = unwrapped(&stepper::heat_part);
 
+        // The affinity hint makes sure the work on each partition is
+        // preferably done by the core which worked on it in the previous
+        // time step.
+        using hpx::threads::executors::default_executor;
+        std::vector<default_executor> execs;
+        if (affinity)
+        {
+            execs.reserve(np);
+            for (std::size_t i = 0; i != np; ++i)
+                execs.push_back(default_executor(
+                    hpx::threads::thread_affinity_hint(i)));
+        }
+
         // Actual time step loop
         for (std::size_t t = 0; t != nt; ++t)
         {
@@ -160,6 +175,16 @@ struct stepper
 
             for (std::size_t i = 0; i != np; ++i)
             {
+                if (affinity)
+                {
+                    next[i] = dataflow(
+                            execs[i], Op,
+                            current[idx(i, -1, np)], current[i],
+                            current[idx(i, +1, np)]
+                        );
+                    continue;
+                }
+
                 next[i] = dataflow(
                         hpx::launch::async, Op,
                         current[idx(i, -1, np)], current[i], current[idx(i, +1, np)]
@@ -232,6 +257,8 @@ int main(int argc, char* argv[])
         ("dx", value<double>(&dx)->default_value(1.0),
          "Local x dimension")
         ( "no-header", "do not print out the csv header row")
+        ( "affinity", bool_switch(&affinity),
+         "keep the work on each partition on the same core (default: false)")
     ;
 
     // Initialize and run HPX
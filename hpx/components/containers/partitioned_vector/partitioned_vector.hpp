@@ -12,6 +12,7 @@
 #include <hpx/config.hpp>
 #include <hpx/lcos/wait_all.hpp>
 #include <hpx/lcos/when_all.hpp>
+#include <hpx/runtime/agas/interface.hpp>
 #include <hpx/runtime/components/client_base.hpp>
 #include <hpx/runtime/components/copy_component.hpp>
 #include <hpx/runtime/components/new.hpp>
@@ -269,6 +270,13 @@ namespace hpx
             std::move(data.partitions_.begin(), data.partitions_.end(),
                 std::back_inserter(partitions_));
 
+            // look up all segments at once, this fills the local AGAS cache
+            std::vector<id_type> ids;
+            ids.reserve(partitions_.size());
+            for (partition_data const& p : partitions_)
+                ids.push_back(p.partition_);
+            agas::resolve(ids).get();
+
             boost::uint32_t this_locality = get_locality_id();
             std::vector<future<void> > ptrs;
 
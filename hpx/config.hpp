@@ -187,11 +187,49 @@
 #  define HPX_AGAS_LOCAL_CACHE_SIZE 4096
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+/// This defines the number of independently locked shards the AGAS address
+/// translation cache is split into.
+///
+/// This value can be changes at runtime by setting the configuration parameter:
+///
+///   hpx.agas.local_cache_shards = ...
+///
+/// (or by setting the corresponding environment variable
+/// HPX_AGAS_LOCAL_CACHE_SHARDS)
+#if !defined(HPX_AGAS_LOCAL_CACHE_SHARDS)
+#  define HPX_AGAS_LOCAL_CACHE_SHARDS 16
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// This defines the number of independently locked shards the tables of the
+/// AGAS primary namespace (the GVA table and the reference count table) are
+/// split into.
+#if !defined(HPX_AGAS_PRIMARY_NS_SHARDS)
+#  define HPX_AGAS_PRIMARY_NS_SHARDS 16
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 #if !defined(HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS)
 #  define HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS 4096
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+/// This defines the interval (in milliseconds) after which pending reference
+/// count decrements are sent to AGAS, even if fewer than
+/// hpx.agas.max_pending_refcnt_requests have been buffered. A value of zero
+/// disables the periodic flushing.
+///
+/// This value can be changes at runtime by setting the configuration parameter:
+///
+///   hpx.agas.refcnt_flush_interval = ...
+///
+/// (or by setting the corresponding environment variable
+/// HPX_AGAS_REFCNT_FLUSH_INTERVAL)
+#if !defined(HPX_AGAS_REFCNT_FLUSH_INTERVAL)
+#  define HPX_AGAS_REFCNT_FLUSH_INTERVAL 50
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 /// This defines the initial global reference count associated with any created
 /// object.
@@ -387,6 +425,13 @@
 #  define HPX_IDLE_LOOP_COUNT_MAX 200000
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// Maximum time (in milliseconds) an idle worker thread is put to sleep before
+// it checks its queues again
+#if !defined(HPX_IDLE_BACKOFF_TIME_MAX)
+#  define HPX_IDLE_BACKOFF_TIME_MAX 1000
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Count number of busy thread manager loop executions before forcefully
 // cleaning up terminated thread objects
@@ -135,21 +135,28 @@ namespace hpx { namespace lcos
 #define HPX_LCOS_BROADCAST_HPP
 
 #include <hpx/config.hpp>
+#include <hpx/error_code.hpp>
+#include <hpx/exception.hpp>
 #include <hpx/lcos/detail/async_colocated.hpp>
 #include <hpx/lcos/future.hpp>
 #include <hpx/lcos/when_all.hpp>
 #include <hpx/runtime/actions/plain_action.hpp>
+#include <hpx/runtime/agas/interface.hpp>
 #include <hpx/runtime/applier/detail/apply_colocated.hpp>
+#include <hpx/runtime/naming/address.hpp>
 #include <hpx/runtime/naming/name.hpp>
 #include <hpx/runtime/serialization/vector.hpp>
 #include <hpx/throw_exception.hpp>
 #include <hpx/traits/extract_action.hpp>
 #include <hpx/traits/promise_local_result.hpp>
+#include <hpx/util/bind.hpp>
 #include <hpx/util/calculate_fanout.hpp>
 #include <hpx/util/detail/count_num_args.hpp>
 #include <hpx/util/detail/pack.hpp>
+#include <hpx/util/logging.hpp>
 #include <hpx/util/tuple.hpp>
 
+#include <boost/cstdint.hpp>
 #include <boost/preprocessor/cat.hpp>
 
 #include <type_traits>
@@ -237,6 +244,63 @@ namespace hpx { namespace lcos
           , Ts const&... vs
         );
 
+        ///////////////////////////////////////////////////////////////////////
+        // Return whether the addresses of the first count targets are known
+        // without asking AGAS, either because the targets are managed by this
+        // locality or because they are held in the local AGAS cache.
+        inline bool broadcast_targets_resolved(
+            std::vector<hpx::id_type> const & ids
+          , std::size_t count
+        )
+        {
+            boost::uint32_t const here = agas::get_locality_id();
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                if (naming::get_locality_id_from_id(ids[i]) == here)
+                    continue;
+
+                naming::address addr;
+                error_code ec(lightweight);
+                if (!agas::resolve_cached(ids[i], addr, ec) || ec)
+                    return false;
+            }
+            return true;
+        }
+
+        // Resolve the targets invoked directly from this locality using one
+        // request per responsible AGAS instance, this fills the local AGAS
+        // cache. The returned future becomes ready with the targets once they
+        // have been resolved. Errors are reported to the caller by the
+        // invocations themselves, they are logged here.
+        inline std::vector<hpx::id_type> broadcast_resolved_targets(
+            std::vector<hpx::id_type> const & targets
+          , hpx::future<std::vector<naming::address> > f
+        )
+        {
+            if (f.has_exception())
+            {
+                LAGAS_(warning) << "broadcast_resolve_targets: "
+                    << hpx::get_error_what(f.get_exception_ptr());
+            }
+            return targets;
+        }
+
+        inline hpx::future<std::vector<hpx::id_type> >
+        broadcast_resolve_targets(
+            std::vector<hpx::id_type> const & ids
+          , std::size_t count
+        )
+        {
+            using util::placeholders::_1;
+
+            std::vector<hpx::id_type> targets(ids.begin(), ids.begin() + count);
+            hpx::future<std::vector<naming::address> > f =
+                hpx::agas::resolve(targets);
+
+            return f.then(
+                util::bind(&broadcast_resolved_targets, std::move(targets), _1));
+        }
+
         ///////////////////////////////////////////////////////////////////////
         template <
             typename Action
@@ -528,6 +592,99 @@ namespace hpx { namespace lcos
             return res;
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Invoke the action on the first count targets
+        template <
+            typename Action
+          , typename ...Ts
+        >
+        hpx::future<void>
+        broadcast_invoke_targets(
+            Action const & act
+          , std::vector<hpx::id_type> const & targets
+          , std::size_t count
+          , std::size_t global_idx
+          , std::true_type
+          , Ts const&... vs
+        )
+        {
+            std::vector<hpx::future<void> > futures;
+            futures.reserve(count);
+            for(std::size_t i = 0; i != count; ++i)
+            {
+                broadcast_invoke(
+                    act
+                  , futures
+                  , targets[i]
+                  , global_idx + i
+                  , vs...
+                );
+            }
+            return hpx::when_all(futures).then(&return_void);
+        }
+
+        template <
+            typename Action
+          , typename ...Ts
+        >
+        hpx::future<typename broadcast_result<Action>::type>
+        broadcast_invoke_targets(
+            Action const & act
+          , std::vector<hpx::id_type> const & targets
+          , std::size_t count
+          , std::size_t global_idx
+          , std::false_type
+          , Ts const&... vs
+        )
+        {
+            typedef
+                typename broadcast_result<Action>::action_result
+                action_result;
+            typedef
+                typename broadcast_result<Action>::type
+                result_type;
+
+            std::vector<hpx::future<result_type> > futures;
+            futures.reserve(count);
+            for(std::size_t i = 0; i != count; ++i)
+            {
+                broadcast_invoke(
+                    act
+                  , futures
+                  , &wrap_into_vector<action_result>
+                  , targets[i]
+                  , global_idx + i
+                  , vs...
+                );
+            }
+            return hpx::when_all(futures).
+                then(&return_result_type<action_result>);
+        }
+
+        template <
+            typename Action
+          , typename ...Ts
+        >
+        void
+        broadcast_invoke_apply_targets(
+            Action const & act
+          , std::vector<hpx::id_type> const & targets
+          , std::size_t count
+          , std::size_t global_idx
+          , Ts const&... vs
+        )
+        {
+            for(std::size_t i = 0; i != count; ++i)
+            {
+                broadcast_invoke_apply(
+                    act
+                  , targets[i]
+                  , global_idx + i
+                  , vs...
+                );
+            }
+        }
+
         ///////////////////////////////////////////////////////////////////////
         template <
             typename Action
@@ -550,16 +707,27 @@ namespace hpx { namespace lcos
             std::size_t fanout = util::calculate_fanout(ids.size(), local_fanout);
 
             std::vector<hpx::future<void> > broadcast_futures;
-            broadcast_futures.reserve(local_size + (ids.size()/fanout) + 1);
-            for(std::size_t i = 0; i != local_size; ++i)
+            broadcast_futures.reserve((ids.size()/fanout) + 2);
+
+            // invoke the local targets, resolve them first unless their
+            // addresses are known already
+            if(broadcast_targets_resolved(ids, local_size))
             {
-                broadcast_invoke(
-                    act
-                  , broadcast_futures
-                  , ids[i]
-                  , global_idx + i
-                  , vs...
-                );
+                broadcast_futures.push_back(
+                    broadcast_invoke_targets(act, ids, local_size, global_idx
+                      , std::true_type(), vs...));
+            }
+            else
+            {
+                broadcast_futures.push_back(
+                    broadcast_resolve_targets(ids, local_size).then(
+                        [=](hpx::future<std::vector<hpx::id_type> > f)
+                        {
+                            std::vector<hpx::id_type> targets = f.get();
+                            return broadcast_invoke_targets(act, targets
+                              , targets.size(), global_idx, std::true_type()
+                              , vs...);
+                        }));
             }
 
             if(ids.size() > local_fanout)
@@ -631,17 +799,27 @@ namespace hpx { namespace lcos
             std::size_t fanout = util::calculate_fanout(ids.size(), local_fanout);
 
             std::vector<hpx::future<result_type> > broadcast_futures;
-            broadcast_futures.reserve(local_size + (ids.size()/fanout) + 1);
-            for(std::size_t i = 0; i != local_size; ++i)
+            broadcast_futures.reserve((ids.size()/fanout) + 2);
+
+            // invoke the local targets, resolve them first unless their
+            // addresses are known already, their results come first
+            if(broadcast_targets_resolved(ids, local_size))
             {
-                broadcast_invoke(
-                    act
-                  , broadcast_futures
-                  , &wrap_into_vector<action_result>
-                  , ids[i]
-                  , global_idx + i
-                  , vs...
-                );
+                broadcast_futures.push_back(
+                    broadcast_invoke_targets(act, ids, local_size, global_idx
+                      , std::false_type(), vs...));
+            }
+            else
+            {
+                broadcast_futures.push_back(
+                    broadcast_resolve_targets(ids, local_size).then(
+                        [=](hpx::future<std::vector<hpx::id_type> > f)
+                        {
+                            std::vector<hpx::id_type> targets = f.get();
+                            return broadcast_invoke_targets(act, targets
+                              , targets.size(), global_idx, std::false_type()
+                              , vs...);
+                        }));
             }
 
             if(ids.size() > local_fanout)
@@ -702,14 +880,22 @@ namespace hpx { namespace lcos
             std::size_t const local_fanout = HPX_BROADCAST_FANOUT;
             std::size_t local_size = (std::min)(ids.size(), local_fanout);
 
-            for(std::size_t i = 0; i != local_size; ++i)
+            // invoke the local targets, resolve them first unless their
+            // addresses are known already
+            if(broadcast_targets_resolved(ids, local_size))
             {
-                broadcast_invoke_apply(
-                    act
-                  , ids[i]
-                  , global_idx + i
-                  , vs...
-                );
+                broadcast_invoke_apply_targets(act, ids, local_size
+                  , global_idx, vs...);
+            }
+            else
+            {
+                broadcast_resolve_targets(ids, local_size).then(
+                    [=](hpx::future<std::vector<hpx::id_type> > f)
+                    {
+                        std::vector<hpx::id_type> targets = f.get();
+                        broadcast_invoke_apply_targets(act, targets
+                          , targets.size(), global_idx, vs...);
+                    });
             }
 
             if(ids.size() > local_fanout)
@@ -49,6 +49,8 @@ namespace hpx { namespace plugins { namespace parcel
             get_counter_type average_time_between_parcels;
             get_counter_values_creator_type time_between_parcels_histogram_creator;
             boost::int64_t min_boundary, max_boundary, num_buckets;
+            get_counter_type max_parcels_per_message;
+            get_counter_type flush_interval;
         };
 
         typedef std::unordered_map<
@@ -63,7 +65,9 @@ namespace hpx { namespace plugins { namespace parcel
             get_counter_type num_parcels, get_counter_type num_messages,
             get_counter_type time_between_parcels,
             get_counter_type average_time_between_parcels,
-            get_counter_values_creator_type time_between_parcels_histogram_creator);
+            get_counter_values_creator_type time_between_parcels_histogram_creator,
+            get_counter_type max_parcels_per_message,
+            get_counter_type flush_interval);
 
         get_counter_type get_parcels_counter(std::string const& name) const;
         get_counter_type get_messages_counter(std::string const& name) const;
@@ -71,6 +75,10 @@ namespace hpx { namespace plugins { namespace parcel
             std::string const& name) const;
         get_counter_type get_average_time_between_parcels_counter(
             std::string const& name) const;
+        get_counter_type get_max_parcels_per_message_counter(
+            std::string const& name) const;
+        get_counter_type get_flush_interval_counter(
+            std::string const& name) const;
         get_counter_values_type get_time_between_parcels_histogram_counter(
             std::string const& name, boost::int64_t min_boundary,
             boost::int64_t max_boundary, boost::int64_t num_buckets);
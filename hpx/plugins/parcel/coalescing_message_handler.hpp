@@ -19,8 +19,10 @@
 
 #include <hpx/plugins/parcel/message_buffer.hpp>
 
+#include <boost/atomic.hpp>
 #include <boost/cstdint.hpp>
 
+#include <cstddef>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -58,6 +60,8 @@ namespace hpx { namespace plugins { namespace parcel
         boost::int64_t get_messages_count(bool reset);
         boost::int64_t get_parcels_per_message_count(bool reset);
         boost::int64_t get_average_time_between_parcels(bool reset);
+        boost::int64_t get_max_parcels_per_message(bool reset);
+        boost::int64_t get_flush_interval(bool reset);
         std::vector<boost::int64_t>
             get_time_between_parcels_histogram(bool reset);
         void get_time_between_parcels_histogram_creator(
@@ -69,25 +73,63 @@ namespace hpx { namespace plugins { namespace parcel
         static void register_action(char const* action, error_code& ec);
 
     protected:
+        // Parcels are collected in several independent buffers, the buffer
+        // is selected based on the worker thread sending the parcel. This
+        // avoids contention on a single lock if many threads send parcels
+        // for the same action to the same destination.
+        struct buffer_shard
+        {
+            buffer_shard(std::size_t num_messages, std::size_t interval,
+                double mean_time_between_parcels, boost::int64_t now);
+
+            mutex_type mtx_;
+            detail::message_buffer buffer_;
+
+            // current number of parcels per message and flush interval [us],
+            // both are adjusted to the observed traffic in adaptive mode
+            std::size_t num_messages_per_buffer_;
+            std::size_t interval_;
+
+            // moving average of the time between parcels [ns]
+            double mean_time_between_parcels_;
+            boost::int64_t last_arrival_time_;
+
+            boost::int64_t num_parcels_;
+            boost::int64_t num_messages_;
+        };
+
+        buffer_shard& get_shard();
+
         bool timer_flush();
-        bool flush_locked(std::unique_lock<mutex_type>& l,
-            parcelset::policies::message_handler::flush_mode mode,
-            bool stop_buffering);
+        bool flush_locked(buffer_shard& shard,
+            std::unique_lock<mutex_type>& l);
+
+        // recompute buffer size and flush interval from the observed traffic
+        void adapt_locked(buffer_shard& shard);
+
+        boost::int64_t get_total_parcels() const;
+        boost::int64_t get_total_messages() const;
 
     private:
         mutable mutex_type mtx_;
         parcelset::parcelport* pp_;
-        detail::message_buffer buffer_;
         util::pool_timer timer_;
-        bool stopped_;
+        boost::atomic<bool> stopped_;
         bool allow_background_flush_;
         std::string action_name_;
 
+        // bounds for the adaptive mode
+        bool adaptive_;
+        std::size_t min_num_messages_;
+        std::size_t max_num_messages_;
+        std::size_t min_interval_;
+        std::size_t max_interval_;
+
+        std::vector<std::unique_ptr<buffer_shard> > shards_;
+
         // performance counter data
-        boost::int64_t num_parcels_;
         boost::int64_t reset_num_parcels_;
         boost::int64_t reset_num_parcels_per_message_parcels_;
-        boost::int64_t num_messages_;
         boost::int64_t reset_num_messages_;
         boost::int64_t reset_num_parcels_per_message_messages_;
         boost::int64_t started_at_;
@@ -99,6 +141,7 @@ namespace hpx { namespace plugins { namespace parcel
                 boost::accumulators::features<hpx::util::tag::histogram>
             > histogram_collector_type;
 
+        boost::atomic<bool> collect_time_between_parcels_;
         std::unique_ptr<histogram_collector_type> time_between_parcels_;
         boost::int64_t histogram_min_boundary_;
         boost::int64_t histogram_max_boundary_;
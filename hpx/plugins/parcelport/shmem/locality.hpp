@@ -0,0 +1,102 @@
+//  Copyright (c) 2026 agent
+//  Copyright (c) 2014 Thomas Heller
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_LOCALITY_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_LOCALITY_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/serialization/string.hpp>
+
+#include <boost/cstdint.hpp>
+#include <boost/io/ios_state.hpp>
+
+#include <string>
+
+namespace hpx { namespace parcelset
+{
+    namespace policies { namespace shmem
+    {
+        // A shared memory endpoint is identified by the name of the host it
+        // is running on and by the id of the process, which is used to derive
+        // the name of the shared memory segment the process receives data in.
+        class locality
+        {
+        public:
+            locality()
+              : pid_(-1)
+            {}
+
+            locality(std::string const& addr, boost::int32_t pid)
+              : address_(addr), pid_(pid)
+            {}
+
+            std::string const & address() const
+            {
+                return address_;
+            }
+
+            boost::int32_t pid() const
+            {
+                return pid_;
+            }
+
+            static const char *type()
+            {
+                return "shmem";
+            }
+
+            explicit operator bool() const HPX_NOEXCEPT
+            {
+                return pid_ != -1;
+            }
+
+            void save(serialization::output_archive & ar) const
+            {
+                ar << address_;
+                ar << pid_;
+            }
+
+            void load(serialization::input_archive & ar)
+            {
+                ar >> address_;
+                ar >> pid_;
+            }
+
+        private:
+            friend bool operator==(locality const & lhs, locality const & rhs)
+            {
+                return lhs.pid_ == rhs.pid_ && lhs.address_ == rhs.address_;
+            }
+
+            friend bool operator<(locality const & lhs, locality const & rhs)
+            {
+                return lhs.address_ < rhs.address_ ||
+                    (lhs.address_ == rhs.address_ && lhs.pid_ < rhs.pid_);
+            }
+
+            friend std::ostream & operator<<(std::ostream & os, locality const & loc)
+            {
+                boost::io::ios_flags_saver ifs(os);
+                os << loc.address_ << ":" << loc.pid_;
+
+                return os;
+            }
+
+            std::string address_;
+            boost::int32_t pid_;
+        };
+    }}
+}}
+
+#endif
+
+#endif
+
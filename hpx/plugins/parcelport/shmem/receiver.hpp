@@ -0,0 +1,73 @@
+//  Copyright (c) 2026 agent
+//  Copyright (c) 2014-2015 Thomas Heller
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_RECEIVER_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_RECEIVER_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/plugins/parcelport/shmem/locality.hpp>
+#include <hpx/plugins/parcelport/shmem/receiver_connection.hpp>
+#include <hpx/plugins/parcelport/shmem/segment.hpp>
+
+#include <boost/cstdint.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    template <typename Parcelport>
+    struct receiver
+    {
+        typedef
+            receiver_connection<Parcelport>
+            connection_type;
+        typedef std::unique_ptr<connection_type> connection_ptr;
+
+        receiver(Parcelport & pp)
+          : pp_(pp)
+        {}
+
+        // Create the segment other localities send their data to, there is
+        // one receiving connection for each of its slots. The segment is
+        // removed when the receiver is destroyed.
+        void run(locality const& here, std::size_t num_slots,
+            std::size_t ring_size, boost::uint64_t max_inbound_size)
+        {
+            segment_.create(segment::name(here.pid()), num_slots, ring_size);
+
+            connections_.reserve(num_slots);
+            for (std::size_t i = 0; i != num_slots; ++i)
+            {
+                connections_.push_back(connection_ptr(
+                    new connection_type(segment_, i, max_inbound_size, pp_)));
+            }
+        }
+
+        bool background_work(std::size_t num_thread)
+        {
+            bool has_work = false;
+            for (connection_ptr& rcv : connections_)
+                has_work = rcv->receive(num_thread) || has_work;
+            return has_work;
+        }
+
+    private:
+        Parcelport & pp_;
+
+        segment segment_;
+        std::vector<connection_ptr> connections_;
+    };
+}}}}
+
+#endif
+
+#endif
+
@@ -0,0 +1,294 @@
+//  Copyright (c) 2026 agent
+//  Copyright (c) 2014-2015 Thomas Heller
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_RECEIVER_CONNECTION_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_RECEIVER_CONNECTION_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/error.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/plugins/parcelport/shmem/segment.hpp>
+#include <hpx/runtime/parcelset/decode_parcels.hpp>
+#include <hpx/runtime/parcelset/parcel_buffer.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
+
+#include <boost/cstdint.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    // A receiver_connection reads the messages written by the sender which
+    // currently owns the associated slot of the segment of this locality.
+    template <typename Parcelport>
+    struct receiver_connection
+    {
+    private:
+        enum connection_state
+        {
+            rcvd_none
+          , rcvd_header
+          , rcvd_data
+          , rcvd_error
+        };
+
+        typedef hpx::lcos::local::spinlock mutex_type;
+
+        typedef std::vector<char> data_type;
+        typedef parcel_buffer<data_type, data_type> buffer_type;
+
+        typedef std::pair<char*, std::size_t> read_buffer_type;
+
+    public:
+        receiver_connection(
+            segment & seg
+          , std::size_t slot
+          , boost::uint64_t max_inbound_size
+          , Parcelport & pp
+        )
+          : segment_(seg)
+          , slot_(slot)
+          , max_inbound_size_(max_inbound_size)
+          , state_(rcvd_none)
+          , current_(0)
+          , offset_(0)
+          , pp_(pp)
+        {
+            start_header();
+        }
+
+        // Read whatever is available in the slot, decode all messages which
+        // have been received completely. Returns true if any data was read.
+        bool receive(std::size_t num_thread = -1)
+        {
+            slot_header& s = segment_.slot(slot_);
+            boost::uint32_t state = s.state_.load(boost::memory_order_acquire);
+            if (state == slot_header::slot_free)
+                return false;
+
+            ring_buffer ring = segment_.ring(slot_);
+            if (ring.empty() && state != slot_header::slot_closed)
+                return false;
+
+            std::unique_lock<mutex_type> l(mtx_, std::try_to_lock);
+            if (!l)
+                return false;
+
+            bool has_work = false;
+            if (state_ == rcvd_error)
+            {
+                // the stream can't be decoded anymore, drop everything the
+                // current sender writes until it gives up the slot
+                has_work = ring.discard() != 0;
+            }
+            else
+            {
+                while (state_ != rcvd_error && read(ring, has_work))
+                    next_state(num_thread);
+            }
+
+            // the slot can be reused once the sender is gone and all of its
+            // data has been consumed (or discarded)
+            if (state == slot_header::slot_closed && ring.empty())
+            {
+                // drop a partially received message (the sender might have
+                // been destroyed before finishing it)
+                if (state_ != rcvd_none || current_ != 0 || offset_ != 0)
+                    buffer_ = buffer_type();
+                start_header();
+                segment_.free_slot(slot_);
+            }
+
+            return has_work;
+        }
+
+    private:
+        // returns true if all buffers for the current state have been filled
+        bool read(ring_buffer& ring, bool& has_work)
+        {
+            while (current_ != buffers_.size())
+            {
+                read_buffer_type const& b = buffers_[current_];
+
+                std::size_t bytes = ring.read(b.first + offset_, b.second - offset_);
+                if (bytes != 0)
+                    has_work = true;
+
+                offset_ += bytes;
+                if (offset_ != b.second)
+                    return false;
+
+                ++current_;
+                offset_ = 0;
+            }
+            return true;
+        }
+
+        void add_buffer(void* p, std::size_t size)
+        {
+            if (size != 0)
+                buffers_.push_back(
+                    read_buffer_type(static_cast<char*>(p), size));
+        }
+
+        void start_header()
+        {
+            state_ = rcvd_none;
+
+            buffers_.clear();
+            current_ = 0;
+            offset_ = 0;
+
+            add_buffer(&buffer_.size_, sizeof(buffer_.size_));
+            add_buffer(&buffer_.data_size_, sizeof(buffer_.data_size_));
+            add_buffer(&buffer_.num_chunks_, sizeof(buffer_.num_chunks_));
+        }
+
+        void next_state(std::size_t num_thread)
+        {
+            switch (state_)
+            {
+            case rcvd_none:
+                receive_header();
+                break;
+
+            case rcvd_header:
+                receive_data();
+                break;
+
+            case rcvd_data:
+                receive_chunks(num_thread);
+                break;
+
+            default:
+                HPX_ASSERT(false);
+            }
+        }
+
+        void receive_header()
+        {
+            // Store the time of the begin of the read operation
+            performance_counters::parcels::data_point& data = buffer_.data_point_;
+            data.time_ = timer_.elapsed_nanoseconds();
+            data.serialization_time_ = 0;
+            data.num_parcels_ = 0;
+
+            // Determine the length of the serialized data.
+            boost::uint64_t inbound_size = buffer_.size_;
+            if (inbound_size > max_inbound_size_)
+            {
+                std::ostringstream strm;
+                strm << "inbound message of size " << inbound_size
+                     << " exceeds the maximally allowed message size of "
+                     << max_inbound_size_;
+                hpx::report_error(HPX_GET_EXCEPTION(network_error,
+                    "shmem::receiver_connection::receive_header", strm.str()));
+
+                // the stream can't be decoded anymore
+                state_ = rcvd_error;
+                return;
+            }
+
+            data.bytes_ = static_cast<std::size_t>(inbound_size);
+
+            buffers_.clear();
+            current_ = 0;
+            offset_ = 0;
+
+            // determine the size of the chunk buffer
+            std::size_t num_zero_copy_chunks =
+                static_cast<std::size_t>(
+                    static_cast<boost::uint32_t>(buffer_.num_chunks_.first));
+            std::size_t num_non_zero_copy_chunks =
+                static_cast<std::size_t>(
+                    static_cast<boost::uint32_t>(buffer_.num_chunks_.second));
+
+            if (num_zero_copy_chunks != 0)
+            {
+                typedef buffer_type::transmission_chunk_type
+                    transmission_chunk_type;
+
+                std::vector<transmission_chunk_type>& chunks =
+                    buffer_.transmission_chunks_;
+
+                chunks.resize(num_zero_copy_chunks + num_non_zero_copy_chunks);
+                add_buffer(chunks.data(),
+                    chunks.size() * sizeof(transmission_chunk_type));
+            }
+
+            // main buffer holding data which was serialized normally
+            buffer_.data_.resize(static_cast<std::size_t>(inbound_size));
+            add_buffer(buffer_.data_.data(), buffer_.data_.size());
+
+            state_ = rcvd_header;
+        }
+
+        void receive_data()
+        {
+            buffers_.clear();
+            current_ = 0;
+            offset_ = 0;
+
+            // add appropriately sized chunk buffers for the zero-copy data
+            std::size_t num_zero_copy_chunks =
+                static_cast<std::size_t>(
+                    static_cast<boost::uint32_t>(buffer_.num_chunks_.first));
+
+            buffer_.chunks_.resize(num_zero_copy_chunks);
+            for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+            {
+                std::size_t chunk_size = static_cast<std::size_t>(
+                    buffer_.transmission_chunks_[i].second);
+                buffer_.chunks_[i].resize(chunk_size);
+                add_buffer(buffer_.chunks_[i].data(), chunk_size);
+            }
+
+            state_ = rcvd_data;
+        }
+
+        void receive_chunks(std::size_t num_thread)
+        {
+            // complete data point and pass it along
+            buffer_.data_point_.time_ = timer_.elapsed_nanoseconds() -
+                buffer_.data_point_.time_;
+
+            // decode the received parcels.
+            decode_parcels(pp_, std::move(buffer_), num_thread);
+            buffer_ = buffer_type();
+
+            start_header();
+        }
+
+        segment & segment_;
+        std::size_t slot_;
+        boost::uint64_t max_inbound_size_;
+
+        connection_state state_;
+        buffer_type buffer_;
+
+        std::vector<read_buffer_type> buffers_;
+        std::size_t current_;
+        std::size_t offset_;
+
+        util::high_resolution_timer timer_;
+
+        mutex_type mtx_;
+        Parcelport & pp_;
+    };
+}}}}
+
+#endif
+
+#endif
+
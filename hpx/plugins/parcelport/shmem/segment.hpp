@@ -0,0 +1,373 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_SEGMENT_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_SEGMENT_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/error_code.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <string>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Each slot of a segment is used by exactly one sending connection at any
+    // point in time, the slot is held for the duration of writing one
+    // message. The sender advances head_, the receiver advances tail_, both
+    // counters are never wrapped.
+    struct slot_header
+    {
+        enum state
+        {
+            slot_free = 0,          // the slot can be claimed by a sender
+            slot_connected = 1,     // a sender is writing to this slot
+            slot_closed = 2         // the sender is gone, the slot is drained
+        };
+
+        enum { cache_line_size = 64 };
+
+        boost::atomic<boost::uint32_t> state_;
+        char pad0_[cache_line_size - sizeof(boost::atomic<boost::uint32_t>)];
+        boost::atomic<boost::uint64_t> head_;
+        char pad1_[cache_line_size - sizeof(boost::atomic<boost::uint64_t>)];
+        boost::atomic<boost::uint64_t> tail_;
+        char pad2_[cache_line_size - sizeof(boost::atomic<boost::uint64_t>)];
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A single producer, single consumer byte stream stored in a slot of a
+    // shared memory segment. The size of the ring has to be a power of two.
+    class ring_buffer
+    {
+    public:
+        ring_buffer(slot_header& slot, char* data, std::size_t size)
+          : slot_(slot), data_(data), size_(size)
+        {
+            HPX_ASSERT((size_ & (size_ - 1)) == 0);
+        }
+
+        // Copy up to n bytes into the ring, returns the number of bytes
+        // which have been written.
+        std::size_t write(char const* p, std::size_t n)
+        {
+            boost::uint64_t head = slot_.head_.load(boost::memory_order_relaxed);
+            boost::uint64_t tail = slot_.tail_.load(boost::memory_order_acquire);
+
+            n = (std::min)(n, size_ - std::size_t(head - tail));
+            if (n == 0)
+                return 0;
+
+            std::size_t pos = std::size_t(head) & (size_ - 1);
+            std::size_t first = (std::min)(n, size_ - pos);
+            std::memcpy(data_ + pos, p, first);
+            std::memcpy(data_, p + first, n - first);
+
+            slot_.head_.store(head + n, boost::memory_order_release);
+            return n;
+        }
+
+        // Copy up to n bytes out of the ring, returns the number of bytes
+        // which have been read.
+        std::size_t read(char* p, std::size_t n)
+        {
+            boost::uint64_t tail = slot_.tail_.load(boost::memory_order_relaxed);
+            boost::uint64_t head = slot_.head_.load(boost::memory_order_acquire);
+
+            n = (std::min)(n, std::size_t(head - tail));
+            if (n == 0)
+                return 0;
+
+            std::size_t pos = std::size_t(tail) & (size_ - 1);
+            std::size_t first = (std::min)(n, size_ - pos);
+            std::memcpy(p, data_ + pos, first);
+            std::memcpy(p + first, data_, n - first);
+
+            slot_.tail_.store(tail + n, boost::memory_order_release);
+            return n;
+        }
+
+        // Drop all data which is currently in the ring, returns the number
+        // of bytes which have been discarded.
+        std::size_t discard()
+        {
+            boost::uint64_t tail = slot_.tail_.load(boost::memory_order_relaxed);
+            boost::uint64_t head = slot_.head_.load(boost::memory_order_acquire);
+
+            slot_.tail_.store(head, boost::memory_order_release);
+            return std::size_t(head - tail);
+        }
+
+        bool empty() const
+        {
+            return slot_.head_.load(boost::memory_order_acquire) ==
+                slot_.tail_.load(boost::memory_order_relaxed);
+        }
+
+    private:
+        slot_header& slot_;
+        char* data_;
+        std::size_t size_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A shared memory segment holding the slots other localities on the same
+    // host use to send data to the locality which has created the segment.
+    //
+    // The layout is: segment header, array of slot headers, ring data of all
+    // slots.
+    class segment
+    {
+    private:
+        HPX_NON_COPYABLE(segment);
+
+        struct segment_header
+        {
+            boost::atomic<boost::uint64_t> magic_;  // set once initialized
+            boost::uint64_t num_slots_;
+            boost::uint64_t ring_size_;
+        };
+
+        static boost::uint64_t magic()
+        {
+            return 0x6870782d73686d65ull;       // "hpx-shme"
+        }
+
+        static std::size_t slots_offset()
+        {
+            std::size_t const align = slot_header::cache_line_size;
+            return (sizeof(segment_header) + align - 1) / align * align;
+        }
+
+        static std::size_t data_offset(std::size_t num_slots)
+        {
+            std::size_t const page = 4096;
+            std::size_t offset = slots_offset() + num_slots * sizeof(slot_header);
+            return (offset + page - 1) / page * page;
+        }
+
+    public:
+        segment()
+          : header_(nullptr), size_(0), owner_(false)
+        {}
+
+        ~segment()
+        {
+            close();
+        }
+
+        // Return the name of the segment the given process receives data in
+        static std::string name(boost::int32_t pid)
+        {
+            return "/hpx.shmem." + std::to_string(pid);
+        }
+
+        // Create the segment the calling process receives its data in, any
+        // stale segment with the same name is removed first.
+        void create(std::string const& name, std::size_t num_slots,
+            std::size_t ring_size, error_code& ec = throws)
+        {
+            HPX_ASSERT(header_ == nullptr);
+
+            // round the ring size up to the next power of two
+            std::size_t size = 4096;
+            while (size < ring_size)
+                size <<= 1;
+            ring_size = size;
+
+            ::shm_unlink(name.c_str());
+
+            int fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL,
+                S_IRUSR | S_IWUSR);
+            if (fd == -1)
+            {
+                report_error("shmem::segment::create", name, errno, ec);
+                return;
+            }
+
+            size_ = data_offset(num_slots) + num_slots * ring_size;
+            if (::ftruncate(fd, static_cast<off_t>(size_)) == -1 || !map(fd))
+            {
+                int err = errno;
+                ::close(fd);
+                ::shm_unlink(name.c_str());
+                report_error("shmem::segment::create", name, err, ec);
+                return;
+            }
+            ::close(fd);
+
+            name_ = name;
+            owner_ = true;
+
+            // the memory is zero-initialized, all slots are free
+            header_->num_slots_ = num_slots;
+            header_->ring_size_ = ring_size;
+            for (std::size_t i = 0; i != num_slots; ++i)
+                new (&slot(i)) slot_header();
+
+            header_->magic_.store(magic(), boost::memory_order_release);
+
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+
+        // Attach to the segment created by another process
+        void open(std::string const& name, error_code& ec = throws)
+        {
+            HPX_ASSERT(header_ == nullptr);
+
+            int fd = ::shm_open(name.c_str(), O_RDWR, 0);
+            if (fd == -1)
+            {
+                report_error("shmem::segment::open", name, errno, ec);
+                return;
+            }
+
+            // the segment might not have been fully set up yet
+            struct stat st;
+            if (::fstat(fd, &st) == -1 ||
+                std::size_t(st.st_size) < data_offset(0))
+            {
+                int err = errno;
+                ::close(fd);
+                report_error("shmem::segment::open", name, err, ec);
+                return;
+            }
+
+            size_ = std::size_t(st.st_size);
+            bool mapped = map(fd);
+            ::close(fd);
+
+            if (!mapped ||
+                header_->magic_.load(boost::memory_order_acquire) != magic())
+            {
+                close();
+                HPX_THROWS_IF(ec, network_error, "shmem::segment::open",
+                    "shared memory segment " + name + " is not initialized");
+                return;
+            }
+
+            name_ = name;
+
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+
+        void close()
+        {
+            if (header_ != nullptr)
+            {
+                ::munmap(header_, size_);
+                header_ = nullptr;
+            }
+            if (owner_)
+            {
+                ::shm_unlink(name_.c_str());
+                owner_ = false;
+            }
+        }
+
+        std::size_t num_slots() const
+        {
+            return std::size_t(header_->num_slots_);
+        }
+
+        slot_header& slot(std::size_t i)
+        {
+            HPX_ASSERT(i < num_slots());
+            return reinterpret_cast<slot_header*>(
+                reinterpret_cast<char*>(header_) + slots_offset())[i];
+        }
+
+        ring_buffer ring(std::size_t i)
+        {
+            std::size_t ring_size = std::size_t(header_->ring_size_);
+            char* data = reinterpret_cast<char*>(header_) +
+                data_offset(num_slots()) + i * ring_size;
+            return ring_buffer(slot(i), data, ring_size);
+        }
+
+        // Claim a free slot for sending a message, returns std::size_t(-1)
+        // if all slots are in use.
+        std::size_t acquire_slot()
+        {
+            for (std::size_t i = 0; i != num_slots(); ++i)
+            {
+                boost::uint32_t expected = slot_header::slot_free;
+                if (slot(i).state_.compare_exchange_strong(expected,
+                        slot_header::slot_connected, boost::memory_order_acq_rel))
+                {
+                    return i;
+                }
+            }
+            return std::size_t(-1);
+        }
+
+        // The sender will not write to the slot anymore
+        void release_slot(std::size_t i)
+        {
+            slot(i).state_.store(slot_header::slot_closed,
+                boost::memory_order_release);
+        }
+
+        // Called by the receiver once a closed slot has been drained
+        void free_slot(std::size_t i)
+        {
+            slot_header& s = slot(i);
+            HPX_ASSERT(s.state_.load() == slot_header::slot_closed);
+
+            s.head_.store(0, boost::memory_order_relaxed);
+            s.tail_.store(0, boost::memory_order_relaxed);
+            s.state_.store(slot_header::slot_free, boost::memory_order_release);
+        }
+
+    private:
+        bool map(int fd)
+        {
+            void* p = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE,
+                MAP_SHARED, fd, 0);
+            if (p == MAP_FAILED)
+                return false;
+
+            header_ = static_cast<segment_header*>(p);
+            return true;
+        }
+
+        static void report_error(char const* func, std::string const& name,
+            int err, error_code& ec)
+        {
+            HPX_THROWS_IF(ec, network_error, func,
+                "shared memory segment " + name + ": " + std::strerror(err));
+        }
+
+        segment_header* header_;
+        std::size_t size_;
+        std::string name_;
+        bool owner_;
+    };
+}}}}
+
+#endif
+
+#endif
+
@@ -0,0 +1,165 @@
+//  Copyright (c) 2026 agent
+//  Copyright (c) 2014-2015 Thomas Heller
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_SENDER_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_SENDER_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/error_code.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/performance_counters/parcels/gatherer.hpp>
+#include <hpx/plugins/parcelport/shmem/locality.hpp>
+#include <hpx/plugins/parcelport/shmem/segment.hpp>
+#include <hpx/plugins/parcelport/shmem/sender_connection.hpp>
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/throw_exception.hpp>
+
+#include <boost/cstdint.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    struct sender
+    {
+        typedef
+            sender_connection
+            connection_type;
+        typedef std::shared_ptr<connection_type> connection_ptr;
+        typedef std::deque<connection_ptr> connection_list;
+
+        typedef hpx::lcos::local::spinlock mutex_type;
+
+        connection_ptr create_connection(parcelset::locality const& there,
+            performance_counters::parcels::gatherer & parcels_sent,
+            error_code& ec)
+        {
+            std::shared_ptr<segment> seg =
+                get_segment(there.get<locality>(), ec);
+            if (!seg)
+                return connection_ptr();
+
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            return std::make_shared<connection_type>(
+                this, seg, there, parcels_sent);
+        }
+
+        void add(connection_ptr const & ptr)
+        {
+            std::unique_lock<mutex_type> l(connections_mtx_);
+            connections_.push_back(ptr);
+        }
+
+        // returns whether at least one of the messages was sent completely
+        bool send_messages(
+            connection_list connections
+        )
+        {
+            // We try to handle all sends
+            connection_list::iterator end = std::remove_if(
+                connections.begin()
+              , connections.end()
+              , [](connection_ptr sender) -> bool
+              {
+                    if(sender->send())
+                    {
+                        boost::system::error_code ec;
+                        sender->postprocess_handler_(
+                            ec, sender->destination(), sender);
+                        return true;
+                    }
+                    return false;
+              }
+            );
+
+            bool has_work = end != connections.end();
+
+            // If some are still in progress, give them back
+            if(connections.begin() != end)
+            {
+                std::unique_lock<mutex_type> l(connections_mtx_);
+                connections_.insert(
+                    connections_.end()
+                  , std::make_move_iterator(connections.begin())
+                  , std::make_move_iterator(end)
+                );
+            }
+            return has_work;
+        }
+
+        bool background_work()
+        {
+            connection_list connections;
+            {
+                std::unique_lock<mutex_type> l(connections_mtx_, std::try_to_lock);
+                if(l && !connections_.empty())
+                {
+                    connections.push_back(connections_.front());
+                    connections_.pop_front();
+                }
+            }
+            // A connection waiting for the receiver to make room in its ring
+            // buffer does not count as work, this avoids spinning while
+            // stopping if the receiving locality is gone already.
+            if(!connections.empty())
+                return send_messages(std::move(connections));
+            return false;
+        }
+
+        void clear()
+        {
+            std::unique_lock<mutex_type> l(segments_mtx_);
+            segments_.clear();
+        }
+
+    private:
+        // All connections to the same locality share the mapping of the
+        // segment of that locality.
+        std::shared_ptr<segment> get_segment(locality const& there,
+            error_code& ec)
+        {
+            std::unique_lock<mutex_type> l(segments_mtx_);
+
+            segments_map::iterator it = segments_.find(there.pid());
+            if (it != segments_.end())
+                return it->second;
+
+            std::shared_ptr<segment> seg = std::make_shared<segment>();
+            seg->open(segment::name(there.pid()), ec);
+            if (ec)
+                return std::shared_ptr<segment>();
+
+            segments_.insert(segments_map::value_type(there.pid(), seg));
+            return seg;
+        }
+
+        mutex_type connections_mtx_;
+        connection_list connections_;
+
+        typedef std::map<boost::int32_t, std::shared_ptr<segment> >
+            segments_map;
+
+        mutex_type segments_mtx_;
+        segments_map segments_;
+    };
+}}}}
+
+#endif
+
+#endif
+
@@ -0,0 +1,225 @@
+//  Copyright (c) 2026 agent
+//  Copyright (c) 2014-2015 Thomas Heller
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_SENDER_CONNECTION_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_SENDER_CONNECTION_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/performance_counters/parcels/gatherer.hpp>
+#include <hpx/plugins/parcelport/shmem/locality.hpp>
+#include <hpx/plugins/parcelport/shmem/segment.hpp>
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/runtime/parcelset/parcelport_connection.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
+#include <hpx/util/unique_function.hpp>
+
+#include <boost/system/error_code.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    struct sender;
+    struct sender_connection;
+
+    void add_connection(sender *, std::shared_ptr<sender_connection> const&);
+
+    // A sender_connection claims a slot in the segment of the destination
+    // locality for each message it sends, the slot is released as soon as
+    // the message has been written completely. Idle (cached) connections
+    // don't hold on to any slot. The message is written into the ring buffer
+    // of that slot using the same layout as the TCP parcelport uses on the
+    // wire. The zero-copy chunks are copied directly from the memory they
+    // reference into the shared segment.
+    struct sender_connection
+      : parcelset::parcelport_connection<
+            sender_connection
+          , std::vector<char>
+        >
+    {
+    private:
+        typedef sender sender_type;
+
+        typedef std::pair<char const*, std::size_t> buffer_type;
+
+    public:
+        sender_connection(
+            sender_type * s
+          , std::shared_ptr<segment> const& seg
+          , parcelset::locality const& there
+          , performance_counters::parcels::gatherer & parcels_sent
+        )
+          : sender_(s)
+          , segment_(seg)
+          , slot_(std::size_t(-1))
+          , current_(0)
+          , offset_(0)
+          , parcels_sent_(parcels_sent)
+          , there_(there)
+        {
+        }
+
+        ~sender_connection()
+        {
+            // a message which was not sent completely leaves the slot behind,
+            // the receiver drains whatever was written
+            if (slot_ != std::size_t(-1))
+                segment_->release_slot(slot_);
+        }
+
+        parcelset::locality const& destination() const
+        {
+            return there_;
+        }
+
+        void verify(parcelset::locality const & parcel_locality_id) const
+        {
+            HPX_ASSERT(parcel_locality_id == there_);
+        }
+
+        template <typename Handler, typename ParcelPostprocess>
+        void async_write(Handler && handler, ParcelPostprocess && parcel_postprocess)
+        {
+            HPX_ASSERT(!buffer_.data_.empty());
+
+            handler_ = std::forward<Handler>(handler);
+
+            /// Increment sends and begin timer.
+            buffer_.data_point_.time_ = timer_.elapsed_nanoseconds();
+
+            buffers_.clear();
+            current_ = 0;
+            offset_ = 0;
+
+            add_buffer(&buffer_.size_, sizeof(buffer_.size_));
+            add_buffer(&buffer_.data_size_, sizeof(buffer_.data_size_));
+            add_buffer(&buffer_.num_chunks_, sizeof(buffer_.num_chunks_));
+
+            std::vector<parcel_buffer_type::transmission_chunk_type>& chunks =
+                buffer_.transmission_chunks_;
+            if (!chunks.empty())
+            {
+                add_buffer(chunks.data(), chunks.size() *
+                    sizeof(parcel_buffer_type::transmission_chunk_type));
+            }
+
+            // main buffer holding data which was serialized normally
+            add_buffer(buffer_.data_.data(), buffer_.data_.size());
+
+            // the chunks themselves, those hold zero-copy serialized data
+            if (!chunks.empty())
+            {
+                for (serialization::serialization_chunk& c : buffer_.chunks_)
+                {
+                    if (c.type_ == serialization::chunk_type_pointer)
+                        add_buffer(c.data_.cpos_, c.size_);
+                }
+            }
+
+            if (!send())
+            {
+                postprocess_handler_ =
+                    std::forward<ParcelPostprocess>(parcel_postprocess);
+                add_connection(sender_, shared_from_this());
+            }
+            else
+            {
+                boost::system::error_code ec;
+                parcel_postprocess(ec, there_, shared_from_this());
+            }
+        }
+
+        // Write as much of the pending message as fits into the ring buffer,
+        // returns true once the whole message has been written. If all slots
+        // of the destination are in use, nothing is written until one of
+        // them has been freed by the receiver.
+        bool send()
+        {
+            if (slot_ == std::size_t(-1))
+            {
+                slot_ = segment_->acquire_slot();
+                if (slot_ == std::size_t(-1))
+                    return false;
+            }
+
+            ring_buffer ring = segment_->ring(slot_);
+            while (current_ != buffers_.size())
+            {
+                buffer_type const& b = buffers_[current_];
+                offset_ += ring.write(b.first + offset_, b.second - offset_);
+                if (offset_ != b.second)
+                    return false;
+
+                ++current_;
+                offset_ = 0;
+            }
+
+            segment_->release_slot(slot_);
+            slot_ = std::size_t(-1);
+
+            return done();
+        }
+
+        util::unique_function_nonser<
+            void(
+                boost::system::error_code const&
+              , parcelset::locality const&
+              , std::shared_ptr<sender_connection>
+            )
+        > postprocess_handler_;
+
+    private:
+        void add_buffer(void const* p, std::size_t size)
+        {
+            if (size != 0)
+                buffers_.push_back(
+                    buffer_type(static_cast<char const*>(p), size));
+        }
+
+        bool done()
+        {
+            boost::system::error_code ec;
+            handler_(ec);
+
+            buffer_.data_point_.time_ =
+                timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
+            parcels_sent_.add_data(buffer_.data_point_);
+            buffer_.clear();
+
+            return true;
+        }
+
+        sender_type * sender_;
+        std::shared_ptr<segment> segment_;
+        std::size_t slot_;
+
+        std::vector<buffer_type> buffers_;
+        std::size_t current_;
+        std::size_t offset_;
+
+        util::unique_function_nonser<
+            void(
+                boost::system::error_code const&
+            )
+        > handler_;
+
+        util::high_resolution_timer timer_;
+        performance_counters::parcels::gatherer & parcels_sent_;
+
+        parcelset::locality there_;
+    };
+}}}}
+
+#endif
+
+#endif
+
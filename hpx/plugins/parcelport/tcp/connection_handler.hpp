@@ -15,9 +15,11 @@
 #if defined(HPX_HAVE_PARCELPORT_TCP)
 #include <hpx/config/asio.hpp>
 
+#include <hpx/plugins/parcelport/tcp/gather_policy.hpp>
 #include <hpx/plugins/parcelport/tcp/locality.hpp>
 #include <hpx/runtime/parcelset/locality.hpp>
 #include <hpx/runtime/parcelset/parcelport_impl.hpp>
+#include <hpx/util/size_class_pool.hpp>
 #include <hpx/util_fwd.hpp>
 
 #include <boost/asio/ip/host_name.hpp>
@@ -108,6 +110,9 @@ namespace hpx { namespace parcelset
 
             parcelset::locality create_locality() const;
 
+            boost::int64_t get_buffer_pool_statistics(
+                buffer_pool_statistics_type t, bool reset);
+
         private:
             void handle_accept(boost::system::error_code const & e,
                 std::shared_ptr<receiver> receiver_conn);
@@ -117,6 +122,16 @@ namespace hpx { namespace parcelset
             /// Acceptor used to listen for incoming connections.
             boost::asio::ip::tcp::acceptor* acceptor_;
 
+            /// The buffers of all incoming messages are allocated from this
+            /// pool.
+            std::shared_ptr<util::size_class_pool<> > receive_buffer_pool_;
+
+            /// Decides which buffers of a message are coalesced before being
+            /// written, see hpx.parcel.tcp.max_iovecs,
+            /// hpx.parcel.tcp.max_gather_bytes, and
+            /// hpx.parcel.tcp.gather_threshold
+            gather_policy gather_;
+
             /// The list of accepted connections
             mutable lcos::local::spinlock connections_mtx_;
 
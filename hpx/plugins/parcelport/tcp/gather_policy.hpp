@@ -0,0 +1,163 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_TCP_GATHER_POLICY_HPP
+#define HPX_PARCELSET_POLICIES_TCP_GATHER_POLICY_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <boost/asio/buffer.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace policies { namespace tcp
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The gather_policy decides which of the buffers making up a single write
+    // operation are copied into a (contiguous) staging buffer instead of
+    // being handed to the operating system on their own:
+    //
+    //  - adjacent buffers smaller than gather_threshold are always copied
+    //    into the staging buffer, this turns the header, the serialized data
+    //    and the small zero-copy chunks of small messages into a single
+    //    buffer,
+    //  - if the write would still consist of more than max_iovecs buffers,
+    //    adjacent buffers are merged, the cheapest ones first, until it
+    //    fits.
+    //
+    // In both cases at most max_gather_bytes bytes are copied per write.
+    class gather_policy
+    {
+    public:
+        gather_policy(std::size_t max_iovecs = 64,
+                std::size_t max_gather_bytes = 65536,
+                std::size_t gather_threshold = 4096)
+          : max_iovecs_(max_iovecs)
+          , max_gather_bytes_(max_gather_bytes)
+          , gather_threshold_(gather_threshold)
+        {}
+
+        // Compute the buffers to write for the given list of buffers. The
+        // merged buffers are copied into 'staging', which must not be
+        // modified until the write has finished. Returns the number of
+        // copied bytes.
+        std::size_t gather(std::vector<boost::asio::const_buffer> const& in,
+            std::vector<char>& staging,
+            std::vector<boost::asio::const_buffer>& out) const
+        {
+            std::vector<entry> entries;
+            entries.reserve(in.size());
+
+            // coalesce all runs of small buffers
+            std::size_t gather_bytes = 0;
+            for (std::size_t i = 0; i != in.size(); ++i)
+            {
+                std::size_t size = boost::asio::buffer_size(in[i]);
+                entry e = { i, i, size, size < gather_threshold_ };
+                if (e.small_ && !entries.empty() && entries.back().small_)
+                {
+                    std::size_t bytes = gathered_bytes(entries.back(), e);
+                    if (gather_bytes + bytes <= max_gather_bytes_)
+                    {
+                        gather_bytes += bytes;
+                        entries.back().last_ = i;
+                        entries.back().size_ += e.size_;
+                        continue;
+                    }
+                }
+                entries.push_back(e);
+            }
+
+            // merge the cheapest neighbors until the write fits
+            while (entries.size() > max_iovecs_ && entries.size() > 1)
+            {
+                std::size_t merge = 0;
+                std::size_t merge_bytes = std::size_t(-1);
+                for (std::size_t i = 0; i != entries.size() - 1; ++i)
+                {
+                    std::size_t bytes =
+                        gathered_bytes(entries[i], entries[i + 1]);
+                    if (bytes < merge_bytes)
+                    {
+                        merge = i;
+                        merge_bytes = bytes;
+                    }
+                }
+
+                if (gather_bytes + merge_bytes > max_gather_bytes_)
+                    break;
+
+                gather_bytes += merge_bytes;
+                entries[merge].last_ = entries[merge + 1].last_;
+                entries[merge].size_ += entries[merge + 1].size_;
+                entries.erase(entries.begin() + merge + 1);
+            }
+
+            // copy the merged buffers, the staging buffer must not be
+            // resized afterwards as the resulting buffers refer to it
+            staging.clear();
+            staging.reserve(gather_bytes);
+
+            out.clear();
+            out.reserve(entries.size());
+            for (entry const& e : entries)
+            {
+                if (e.first_ == e.last_)
+                {
+                    out.push_back(in[e.first_]);
+                    continue;
+                }
+
+                std::size_t offset = staging.size();
+                for (std::size_t i = e.first_; i <= e.last_; ++i)
+                {
+                    char const* p =
+                        boost::asio::buffer_cast<char const*>(in[i]);
+                    staging.insert(staging.end(), p,
+                        p + boost::asio::buffer_size(in[i]));
+                }
+                out.push_back(boost::asio::buffer(
+                    staging.data() + offset, e.size_));
+            }
+
+            HPX_ASSERT(staging.size() == gather_bytes);
+            return gather_bytes;
+        }
+
+        std::size_t max_iovecs() const { return max_iovecs_; }
+        std::size_t max_gather_bytes() const { return max_gather_bytes_; }
+        std::size_t gather_threshold() const { return gather_threshold_; }
+
+    private:
+        // a run of the consecutive input buffers [first, last], small_ is
+        // set if all of those are smaller than the gather threshold
+        struct entry
+        {
+            std::size_t first_;
+            std::size_t last_;
+            std::size_t size_;
+            bool small_;
+        };
+
+        // number of bytes which have to be copied when merging two entries
+        static std::size_t gathered_bytes(entry const& lhs, entry const& rhs)
+        {
+            std::size_t bytes = 0;
+            if (lhs.first_ == lhs.last_)
+                bytes += lhs.size_;
+            if (rhs.first_ == rhs.last_)
+                bytes += rhs.size_;
+            return bytes;
+        }
+
+        std::size_t max_iovecs_;
+        std::size_t max_gather_bytes_;
+        std::size_t gather_threshold_;
+    };
+}}}}
+
+#endif
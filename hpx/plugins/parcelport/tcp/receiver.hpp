@@ -24,6 +24,7 @@
 #include <hpx/util/bind.hpp>
 #include <hpx/util/high_resolution_timer.hpp>
 #include <hpx/util/protect.hpp>
+#include <hpx/util/size_class_pool.hpp>
 
 #include <boost/asio/buffer.hpp>
 #include <boost/asio/io_service.hpp>
@@ -43,17 +44,29 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 {
     class connection_handler;
 
+    // All buffers of incoming messages are drawn from the pool of the
+    // parcelport, they are handed back to the pool once the decoding of the
+    // message has finished. The buffers are not zero-initialized before they
+    // are filled from the socket.
+    typedef util::size_class_pool_allocator<char> receive_allocator_type;
+    typedef std::vector<char, receive_allocator_type> receive_buffer_type;
+
     class receiver
-      : public parcelport_connection<receiver, std::vector<char>, std::vector<char> >
+      : public parcelport_connection<receiver, receive_buffer_type,
+            receive_buffer_type>
     {
         typedef hpx::lcos::local::spinlock mutex_type;
     public:
         receiver(boost::asio::io_service& io_service, boost::uint64_t max_inbound_size,
-            connection_handler& parcelport)
-          : socket_(io_service)
+            connection_handler& parcelport,
+            std::shared_ptr<util::size_class_pool<> > const& pool)
+          : parcelport_connection<receiver, receive_buffer_type,
+                receive_buffer_type>(receive_allocator_type(pool))
+          , socket_(io_service)
           , max_inbound_size_(max_inbound_size)
           , ack_(0)
           , parcelport_(parcelport)
+          , allocator_(pool)
           , timer_()
           , mtx_()
         {}
@@ -242,7 +255,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                     static_cast<std::size_t>(
                         static_cast<boost::uint32_t>(buffer_.num_chunks_.first));
 
-                buffer_.chunks_.resize(num_zero_copy_chunks);
+                buffer_.chunks_.resize(num_zero_copy_chunks,
+                    receive_buffer_type(allocator_));
                 for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
                 {
                     std::size_t chunk_size = buffer_.transmission_chunks_[i].second;
@@ -302,7 +316,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
                 // decode the received parcels.
                 decode_parcels(parcelport_, std::move(buffer_), -1);
-                buffer_ = parcel_buffer_type();
+                buffer_ = parcel_buffer_type(allocator_);
 
                 ack_ = true;
                 {
@@ -349,6 +363,9 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         /// The handler used to process the incoming request.
         connection_handler& parcelport_;
 
+        /// The allocator used for all buffers of incoming messages.
+        receive_allocator_type allocator_;
+
         /// Counters and timers for parcels received.
         util::high_resolution_timer timer_;
 
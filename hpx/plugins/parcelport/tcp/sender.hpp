@@ -16,6 +16,7 @@
 #include <hpx/config/asio.hpp>
 #include <hpx/performance_counters/parcels/data_point.hpp>
 #include <hpx/performance_counters/parcels/gatherer.hpp>
+#include <hpx/plugins/parcelport/tcp/gather_policy.hpp>
 #include <hpx/plugins/parcelport/tcp/locality.hpp>
 #include <hpx/runtime/parcelset/locality.hpp>
 #include <hpx/runtime/parcelset/parcelport_connection.hpp>
@@ -33,6 +34,8 @@
 #include <boost/atomic.hpp>
 #include <boost/cstdint.hpp>
 
+#include <cstddef>
+#include <cstring>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -46,12 +49,14 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         /// Construct a sending parcelport_connection with the given io_service.
         sender(boost::asio::io_service& io_service,
             parcelset::locality const& locality_id,
-            performance_counters::parcels::gatherer& parcels_sent)
+            performance_counters::parcels::gatherer& parcels_sent,
+            gather_policy const& gather = gather_policy())
           : socket_(io_service)
           , ack_(0)
           , there_(locality_id)
           , timer_()
           , parcels_sent_(parcels_sent)
+          , gather_(gather)
         {
         }
 
@@ -110,16 +115,24 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
             buffer_.data_point_.time_ = timer_.elapsed_nanoseconds();
 
             // Write the serialized data to the socket. We use "gather-write"
-            // to send both the header and the data in a single write operation.
-            std::vector<boost::asio::const_buffer> buffers;
-            buffers.push_back(boost::asio::buffer(&buffer_.size_,
-                sizeof(buffer_.size_)));
-            buffers.push_back(boost::asio::buffer(&buffer_.data_size_,
-                sizeof(buffer_.data_size_)));
+            // to send the header, the data, and all zero-copy chunks of the
+            // message in a single write operation. The header is packed into
+            // one contiguous buffer, small buffers are coalesced according to
+            // the gather policy.
+            static_assert(sizeof(header_) == sizeof(buffer_.size_) +
+                    sizeof(buffer_.data_size_) + sizeof(buffer_.num_chunks_),
+                "the packed header has to match the layout of the message");
+
+            char* header = header_;
+            std::memcpy(header, &buffer_.size_, sizeof(buffer_.size_));
+            header += sizeof(buffer_.size_);
+            std::memcpy(header, &buffer_.data_size_, sizeof(buffer_.data_size_));
+            header += sizeof(buffer_.data_size_);
+            std::memcpy(header, &buffer_.num_chunks_, sizeof(buffer_.num_chunks_));
 
-            // add chunk description
-            buffers.push_back(boost::asio::buffer(&buffer_.num_chunks_,
-                sizeof(buffer_.num_chunks_)));
+            std::vector<boost::asio::const_buffer> buffers;
+            buffers.reserve(3 + buffer_.chunks_.size());
+            buffers.push_back(boost::asio::buffer(header_, sizeof(header_)));
 
             std::vector<parcel_buffer_type::transmission_chunk_type>& chunks =
                 buffer_.transmission_chunks_;
@@ -149,9 +162,12 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
             void (sender::*f)(boost::system::error_code const&, std::size_t)
                 = &sender::handle_write;
 
+            std::vector<boost::asio::const_buffer> gathered;
+            gather_.gather(buffers, gather_buffer_, gathered);
+
             using util::placeholders::_1;
             using util::placeholders::_2;
-            boost::asio::async_write(socket_, buffers,
+            boost::asio::async_write(socket_, gathered,
                 util::bind(f, shared_from_this(), _1, _2));
         }
 
@@ -198,6 +214,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
             state_ = state_handle_read_ack;
 #endif
             buffer_.clear();
+            gather_buffer_.clear();
             // Call post-processing handler, which will send remaining pending
             // parcels. Pass along the connection so it can be reused if more
             // parcels have to be sent.
@@ -209,6 +226,12 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
         bool ack_;
 
+        /// the packed header of the current message
+        char header_[2 * sizeof(boost::uint64_t) + 2 * sizeof(boost::uint32_t)];
+
+        /// staging buffer for the coalesced buffers of the current message
+        std::vector<char> gather_buffer_;
+
         /// the other (receiving) end of this connection
         parcelset::locality there_;
 
@@ -216,6 +239,9 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         util::high_resolution_timer timer_;
         performance_counters::parcels::gatherer& parcels_sent_;
 
+        /// decides which buffers are copied into gather_buffer_
+        gather_policy gather_;
+
         util::unique_function_nonser<
             void(
                 boost::system::error_code const&
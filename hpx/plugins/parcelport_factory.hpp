@@ -106,6 +106,12 @@ namespace hpx { namespace plugins
                 "async_serialization = ${HPX_PARCEL_" + name_uc +
                     "_ASYNC_SERIALIZATION:"
                     "$[hpx.parcel.async_serialization]}",
+                "priority_lanes = ${HPX_PARCEL_" + name_uc +
+                    "_PRIORITY_LANES:$[hpx.parcel.priority_lanes]}",
+                "priority_connections_per_locality = "
+                    "${HPX_PARCEL_" + name_uc +
+                    "_PRIORITY_CONNECTIONS_PER_LOCALITY:"
+                    "$[hpx.parcel.priority_connections_per_locality]}",
                 "priority = ${HPX_PARCEL_" + name_uc +
                     "_PRIORITY:" + traits::plugin_config_data<Parcelport>::priority()
                                  + "}"
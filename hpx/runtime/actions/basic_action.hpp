@@ -810,6 +810,9 @@ namespace hpx { namespace serialization
 #define HPX_ACTION_USES_HUGE_STACK(action)                                    \
     HPX_ACTION_USES_STACK(action, threads::thread_stacksize_huge)             \
 /**/
+#define HPX_ACTION_USES_NO_STACK(action)                                      \
+    HPX_ACTION_USES_STACK(action, threads::thread_stacksize_nostack)          \
+/**/
 // This macro is deprecated. It expands to an inline function which will emit a
 // warning.
 #define HPX_ACTION_DOES_NOT_SUSPEND(action)                                    \
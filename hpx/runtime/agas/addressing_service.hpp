@@ -21,7 +21,9 @@
 #include <hpx/runtime/naming/name.hpp>
 #include <hpx/state.hpp>
 #include <hpx/util/cache/lru_cache.hpp>
+#include <hpx/util/cache/sharded_cache.hpp>
 #include <hpx/util/cache/statistics/local_full_statistics.hpp>
+#include <hpx/util/interval_timer.hpp>
 #include <hpx/util_fwd.hpp>
 
 #include <boost/atomic.hpp>
@@ -65,18 +67,37 @@ public:
 
     // {{{ gva cache
     struct gva_cache_key;
-
-    typedef hpx::util::cache::lru_cache<
-        gva_cache_key
-      , gva
-      , hpx::util::cache::statistics::local_full_statistics
+    struct gva_cache_sharding;
+
+    // The cache is split into independently locked shards, this avoids
+    // serializing all cached address resolutions on a single lock.
+    typedef hpx::util::cache::sharded_cache<
+        hpx::util::cache::lru_cache<
+            gva_cache_key
+          , gva
+          , hpx::util::cache::statistics::local_full_statistics
+        >
+      , gva_cache_sharding
     > gva_cache_type;
     // }}}
 
     typedef std::set<naming::gid_type> migrated_objects_table_type;
     typedef std::map<naming::gid_type, boost::int64_t> refcnt_requests_type;
 
-    mutable mutex_type gva_cache_mtx_;
+    // Pending decrements are coalesced per gid and collected separately for
+    // each of the localities owning the referenced objects.
+    struct refcnt_requests_batch
+    {
+        refcnt_requests_batch()
+          : count_(0)
+        {}
+
+        refcnt_requests_type requests_;
+        std::size_t count_;         // number of buffered decrements
+    };
+    typedef std::map<boost::uint32_t, refcnt_requests_batch>
+        refcnt_requests_batches_type;
+
     std::shared_ptr<gva_cache_type> gva_cache_;
 
     mutable mutex_type migrated_objects_mtx_;
@@ -88,10 +109,19 @@ public:
     std::size_t const max_refcnt_requests_;
 
     mutex_type refcnt_requests_mtx_;
-    std::size_t refcnt_requests_count_;
     bool enable_refcnt_caching_;
 
-    std::shared_ptr<refcnt_requests_type> refcnt_requests_;
+    refcnt_requests_batches_type refcnt_requests_;
+
+    // flushes the pending decrements periodically, stops whenever there is
+    // nothing to flush and is restarted by the next decrement
+    util::interval_timer refcnt_requests_timer_;
+    boost::atomic<bool> refcnt_requests_timer_started_;
+
+    // number of incref/decref operations which were merged with pending
+    // decrements, and number of operations sent to AGAS
+    boost::atomic<boost::int64_t> refcnt_requests_coalesced_;
+    boost::atomic<boost::int64_t> refcnt_requests_sent_;
 
     service_mode const service_type;
     runtime_mode const runtime_type;
@@ -232,6 +262,16 @@ protected:
         future<response> f
       , naming::gid_type const& id
         );
+    naming::address resolve_response(
+        response const& rep
+      , naming::gid_type const& id
+        );
+    void resolve_bulk_postproc(
+        future<std::vector<response> > f
+      , std::vector<naming::gid_type> const& ids
+      , std::vector<std::size_t> const& indices
+      , std::shared_ptr<std::vector<naming::address> > const& addrs
+        );
     bool bind_postproc(
         future<response> f
       , naming::gid_type const& id
@@ -247,9 +287,18 @@ private:
     /// Assumes that \a refcnt_requests_mtx_ is locked.
     void send_refcnt_requests(
         std::unique_lock<mutex_type>& l
+      , boost::uint32_t locality_id
       , error_code& ec = throws
         );
 
+    /// Invoked periodically to flush all pending decrements. Returns false
+    /// (stopping the timer) if there are none.
+    bool flush_refcnt_requests();
+
+    void send_refcnt_requests_batch_non_blocking(
+        refcnt_requests_type const& requests
+        );
+
     /// Assumes that \a refcnt_requests_mtx_ is locked.
     void send_refcnt_requests_non_blocking(
         std::unique_lock<mutex_type>& l
@@ -285,6 +334,10 @@ private:
     boost::uint64_t get_cache_update_entry_time(bool reset);
     boost::uint64_t get_cache_erase_entry_time(bool reset);
 
+    // Helper functions to access the reference counting statistics
+    boost::uint64_t get_refcnt_requests_coalesced(bool reset);
+    boost::uint64_t get_refcnt_requests_sent(bool reset);
+
 public:
     response service(
         request const& req
@@ -1018,6 +1071,23 @@ public:
         return resolve_async(id.get_gid());
     }
 
+    /// \brief Resolve a list of global ids to their local virtual addresses
+    ///
+    /// All ids which can't be resolved from the local cache are grouped by
+    /// the primary namespace instance responsible for them and a single
+    /// request is sent to each of those instances. The resolved addresses
+    /// are stored in the local cache.
+    ///
+    /// \returns A future referring to the addresses of the given ids (in
+    ///          the same order).
+    hpx::future<std::vector<naming::address> > resolve_async(
+        std::vector<naming::gid_type> const& ids
+        );
+
+    hpx::future<std::vector<naming::address> > resolve_async(
+        std::vector<naming::id_type> const& ids
+        );
+
     ///////////////////////////////////////////////////////////////////////////
     hpx::future<naming::id_type> get_colocation_id_async(
         naming::id_type const& id
@@ -1086,8 +1156,8 @@ public:
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    // Bulk version.
-    // TODO: Add versions that take std::vector<id_type> for convenience.
+    // Bulk version, see resolve_async above for an asynchronous version
+    // taking a std::vector<id_type>.
     bool resolve_local(
         naming::gid_type const* gids
       , naming::address* addrs
@@ -292,6 +292,24 @@ inline bool is_local_address_cached(
     return is_local_address_cached(gid.get_gid(), addr, ec);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Resolve the given id using the local AGAS cache only, returns false if the
+// address is not cached
+HPX_API_EXPORT bool resolve_cached(
+    naming::gid_type const& gid
+  , naming::address& addr
+  , error_code& ec = throws
+    );
+
+inline bool resolve_cached(
+    naming::id_type const& id
+  , naming::address& addr
+  , error_code& ec = throws
+    )
+{
+    return resolve_cached(id.get_gid(), addr, ec);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 HPX_API_EXPORT bool is_local_lva_encoded_address(
     naming::gid_type const& gid
@@ -315,6 +333,23 @@ HPX_API_EXPORT naming::address resolve(
   , error_code& ec = throws
     );
 
+// Resolve all given ids using one request per responsible AGAS instance
+HPX_API_EXPORT hpx::future<std::vector<naming::address> > resolve(
+    std::vector<naming::id_type> const& ids
+    );
+
+HPX_API_EXPORT std::vector<naming::address> resolve(
+    launch::sync_policy
+  , std::vector<naming::id_type> const& ids
+  , error_code& ec = throws
+    );
+
+HPX_API_EXPORT void update_cache_entry(
+    naming::gid_type const& gid
+  , naming::address const& addr
+  , error_code& ec = throws
+    );
+
 #if defined(HPX_HAVE_ASYNC_FUNCTION_COMPATIBILITY)
 HPX_DEPRECATED(HPX_DEPRECATED_MSG)
 inline naming::address resolve_sync(
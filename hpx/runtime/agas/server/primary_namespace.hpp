@@ -28,6 +28,7 @@
 #include <boost/atomic.hpp>
 #include <boost/format.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <list>
 #include <map>
@@ -133,21 +134,57 @@ struct HPX_EXPORT primary_namespace
     // }}}
 
   private:
-    // REVIEW: Separate mutexes might reduce contention here. This has to be
-    // investigated carefully.
-    mutex_type mutex_;
-
-    gva_table_type gvas_;
-    refcnt_table_type refcnts_;
     typedef std::map<
             naming::gid_type,
             hpx::util::tuple<bool, std::size_t, lcos::local::condition_variable_any>
         > migration_table_type;
 
+    // The GVA table and the reference count table are split into a number
+    // of shards, each protected by a lock of its own. Consecutive gids are
+    // mapped onto consecutive shards. A range of gids is stored in all
+    // shards any of its gids map to, which ensures that a gid can always be
+    // resolved by looking at its own shard only.
+    enum { num_shards = HPX_AGAS_PRIMARY_NS_SHARDS };
+
+    // avoid false sharing between the locks of adjacent shards
+    enum { cache_line_size = 64 };
+
+    struct gva_shard
+    {
+        mutex_type mutex_;
+        gva_table_type gvas_;
+        migration_table_type migrating_objects_;
+        char pad_[cache_line_size];
+    };
+
+    struct refcnt_shard
+    {
+        mutex_type mutex_;
+        refcnt_table_type refcnts_;
+        char pad_[cache_line_size];
+    };
+
+    gva_shard gva_shards_[num_shards];
+    refcnt_shard refcnt_shards_[num_shards];
+
     std::string instance_name_;
     naming::gid_type next_id_;      // next available gid
     naming::gid_type locality_;     // our locality id
-    migration_table_type migrating_objects_;
+
+    static std::size_t get_shard_index(naming::gid_type const& id);
+
+    gva_shard& get_gva_shard(naming::gid_type const& id)
+    {
+        return gva_shards_[get_shard_index(id)];
+    }
+
+    refcnt_shard& get_refcnt_shard(naming::gid_type const& id)
+    {
+        return refcnt_shards_[get_shard_index(id)];
+    }
+
+    // Holds the locks of all GVA table shards a range of gids is stored in
+    struct gva_range_lock;
 
     struct update_time_on_exit;
 
@@ -240,14 +277,10 @@ struct HPX_EXPORT primary_namespace
     };
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-    /// Dump the credit counts of all matching ranges. Expects that \p l
-    /// is locked.
+    /// Dump the credit counts of all gids in the given range.
     void dump_refcnt_matches(
-        refcnt_table_type::iterator lower_it
-      , refcnt_table_type::iterator upper_it
-      , naming::gid_type const& lower
+        naming::gid_type const& lower
       , naming::gid_type const& upper
-      , std::unique_lock<mutex_type>& l
       , const char* func_name
         );
 #endif
@@ -260,16 +293,16 @@ struct HPX_EXPORT primary_namespace
         request const& req
       , error_code& ec);
 
-    // helper function
+    // helper function, expects that \p l holds the lock of \p shard
     void wait_for_migration_locked(
         std::unique_lock<mutex_type>& l
+      , gva_shard& shard
       , naming::gid_type id
       , error_code& ec);
 
   public:
     primary_namespace()
       : base_type(HPX_AGAS_PRIMARY_NS_MSB, HPX_AGAS_PRIMARY_NS_LSB)
-      , mutex_()
       , instance_name_()
       , next_id_(naming::invalid_gid)
       , locality_(naming::invalid_gid)
@@ -367,8 +400,11 @@ struct HPX_EXPORT primary_namespace
         );
 
   private:
+    // Expects that \p l holds the lock of \p shard, which has to be the
+    // shard of \p gid
     resolved_type resolve_gid_locked(
         std::unique_lock<mutex_type>& l
+      , gva_shard const& shard
       , naming::gid_type const& gid
       , error_code& ec
         );
@@ -394,8 +430,7 @@ struct HPX_EXPORT primary_namespace
     };
 
     void resolve_free_list(
-        std::unique_lock<mutex_type>& l
-      , std::list<refcnt_table_type::iterator> const& free_list
+        std::list<naming::gid_type> const& free_list
       , std::list<free_entry>& free_entry_list
       , naming::gid_type const& lower
       , naming::gid_type const& upper
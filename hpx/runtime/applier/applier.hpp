@@ -165,6 +165,12 @@ namespace hpx { namespace applier
         void schedule_action(parcelset::parcel p,
             std::size_t num_thread = std::size_t(-1));
 
+        /// Schedule threads based on the given parcel without consuming it,
+        /// the parcel still refers to the (scheduled) action afterwards,
+        /// unless it had to be routed to another locality.
+        void schedule_action_in_place(parcelset::parcel& p,
+            std::size_t num_thread = std::size_t(-1));
+
 #if defined(HPX_HAVE_SECURITY)
         void enable_verify_capabilities()
         {
@@ -9,6 +9,7 @@
 #define HPX_RUNTIME_SUPPORT_JUN_02_2008_1145AM
 
 #include <hpx/config.hpp>
+#include <hpx/runtime_fwd.hpp>
 #include <hpx/throw_exception.hpp>
 #if defined(HPX_HAVE_SECURITY)
 #include <hpx/traits/action_capability_provider.hpp>
@@ -21,14 +22,19 @@
 #include <hpx/runtime/actions/component_action.hpp>
 #include <hpx/runtime/actions/manage_object_action.hpp>
 #include <hpx/runtime/agas/gva.hpp>
+#include <hpx/runtime/agas/interface.hpp>
 #include <hpx/runtime/components/component_factory_base.hpp>
 #include <hpx/runtime/components/component_type.hpp>
 #include <hpx/runtime/components/server/create_component.hpp>
 #include <hpx/runtime/components/static_factory_data.hpp>
 #include <hpx/runtime/get_lva.hpp>
+#include <hpx/runtime/naming/address.hpp>
+#include <hpx/runtime/naming/name.hpp>
 #include <hpx/runtime/parcelset/locality.hpp>
 #include <hpx/traits/action_does_termination_detection.hpp>
+#include <hpx/traits/get_remote_result.hpp>
 #include <hpx/traits/is_component.hpp>
+#include <hpx/traits/promise_local_result.hpp>
 #include <hpx/util/bind.hpp>
 #include <hpx/util/functional/new.hpp>
 #include <hpx/util/one_size_heap_list_base.hpp>
@@ -60,6 +66,56 @@
 
 namespace hpx { namespace components { namespace server
 {
+    ///////////////////////////////////////////////////////////////////////////
+    // The result of creating a new component instance: its global id and the
+    // address it has been bound to. The creating locality puts the address
+    // into its AGAS cache, which spares the first action invoked on the new
+    // object from having to resolve it.
+    struct created_component
+    {
+        created_component() {}
+
+        created_component(naming::gid_type const& gid,
+                naming::address const& addr)
+          : gid_(gid), addr_(addr)
+        {}
+
+        naming::gid_type gid_;
+        naming::address addr_;
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            ar & gid_ & addr_;
+        }
+    };
+
+    namespace detail
+    {
+        // Create a new component using the given constructor function. The
+        // address the component is bound to is made of this locality, its
+        // type, and the location of its wrapping instance, which is recorded
+        // while constructing it. This avoids looking up the new object in
+        // the local AGAS instance.
+        template <typename F>
+        created_component make_created_component(
+            component_factory_base& factory, component_type type, F && ctor)
+        {
+            void* lva = nullptr;
+            naming::gid_type gid = factory.create_with_args(
+                [&ctor, &lva](void* p)
+                {
+                    ctor(p);
+                    lva = p;
+                });
+            return created_component(gid,
+                naming::address(hpx::get_locality(), type, lva));
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     class runtime_support
     {
@@ -156,16 +212,17 @@ namespace hpx { namespace components { namespace server
 
         /// \brief Actions to create new objects
         template <typename Component>
-        naming::gid_type create_component();
+        created_component create_component();
 
         template <typename Component, typename T, typename ...Ts>
-        naming::gid_type create_component(T v, Ts... vs);
+        created_component create_component(T v, Ts... vs);
 
         template <typename Component>
-        std::vector<naming::gid_type> bulk_create_component(std::size_t count);
+        std::vector<created_component> bulk_create_component(
+            std::size_t count);
 
         template <typename Component, typename T, typename ...Ts>
-        std::vector<naming::gid_type> bulk_create_component(
+        std::vector<created_component> bulk_create_component(
             std::size_t count, T v, Ts... vs);
 
         template <typename Component>
@@ -452,7 +509,7 @@ namespace hpx { namespace components { namespace server
     ///////////////////////////////////////////////////////////////////////////
     // Functions wrapped by creat_component actions below
     template <typename Component>
-    naming::gid_type runtime_support::create_component()
+    created_component runtime_support::create_component()
     {
         components::component_type const type =
             components::get_component_type<
@@ -469,7 +526,7 @@ namespace hpx { namespace components { namespace server
             HPX_THROW_EXCEPTION(hpx::bad_component_type,
                 "runtime_support::create_component",
                 strm.str());
-            return naming::invalid_gid;
+            return created_component();
         }
 
         if (!(*it).second.first) {
@@ -481,23 +538,26 @@ namespace hpx { namespace components { namespace server
             HPX_THROW_EXCEPTION(hpx::bad_component_type,
                 "runtime_support::create_component",
                 strm.str());
-            return naming::invalid_gid;
+            return created_component();
         }
 
-        naming::gid_type id;
+        created_component result;
         std::shared_ptr<component_factory_base> factory((*it).second.first);
         {
             util::unlock_guard<std::unique_lock<component_map_mutex_type> > ul(l);
-            id = factory->create();
+
+            typedef typename Component::wrapping_type wrapping_type;
+            result = detail::make_created_component(*factory, type,
+                detail::construct_function<wrapping_type>());
         }
-        LRT_(info) << "successfully created component " << id
+        LRT_(info) << "successfully created component " << result.gid_
             << " of type: " << components::get_component_type_name(type);
 
-        return id;
+        return result;
     }
 
     template <typename Component, typename T, typename ...Ts>
-    naming::gid_type runtime_support::create_component(T v, Ts... vs)
+    created_component runtime_support::create_component(T v, Ts... vs)
     {
         components::component_type const type =
             components::get_component_type<
@@ -514,7 +574,7 @@ namespace hpx { namespace components { namespace server
             HPX_THROW_EXCEPTION(hpx::bad_component_type,
                 "runtime_support::create_component",
                 strm.str());
-            return naming::invalid_gid;
+            return created_component();
         }
 
         if (!(*it).second.first) {
@@ -526,10 +586,10 @@ namespace hpx { namespace components { namespace server
             HPX_THROW_EXCEPTION(hpx::bad_component_type,
                 "runtime_support::create_component",
                 strm.str());
-            return naming::invalid_gid;
+            return created_component();
         }
 
-        naming::gid_type id;
+        created_component result;
         std::shared_ptr<component_factory_base> factory((*it).second.first);
         {
             util::unlock_guard<std::unique_lock<component_map_mutex_type> > ul(l);
@@ -539,18 +599,18 @@ namespace hpx { namespace components { namespace server
             // Note, T and Ts can't be (non-const) references, and parameters
             // should be moved to allow for move-only constructor argument
             // types.
-            id = factory->create_with_args(
-                    detail::construct_function<wrapping_type>(
-                        std::move(v), std::move(vs)...));
+            result = detail::make_created_component(*factory, type,
+                detail::construct_function<wrapping_type>(
+                    std::move(v), std::move(vs)...));
         }
-        LRT_(info) << "successfully created component " << id
+        LRT_(info) << "successfully created component " << result.gid_
             << " of type: " << components::get_component_type_name(type);
 
-        return id;
+        return result;
     }
 
     template <typename Component>
-    std::vector<naming::gid_type>
+    std::vector<created_component>
     runtime_support::bulk_create_component(std::size_t count)
     {
         components::component_type const type =
@@ -568,7 +628,7 @@ namespace hpx { namespace components { namespace server
             HPX_THROW_EXCEPTION(hpx::bad_component_type,
                 "runtime_support::create_component",
                 strm.str());
-            return std::vector<naming::gid_type>();
+            return std::vector<created_component>();
         }
 
         if (!(*it).second.first) {
@@ -580,18 +640,21 @@ namespace hpx { namespace components { namespace server
             HPX_THROW_EXCEPTION(hpx::bad_component_type,
                 "runtime_support::create_component",
                 strm.str());
-            return std::vector<naming::gid_type>();
+            return std::vector<created_component>();
         }
 
-        std::vector<naming::gid_type> ids;
+        std::vector<created_component> ids;
         ids.reserve(count);
 
         std::shared_ptr<component_factory_base> factory((*it).second.first);
         {
             util::unlock_guard<std::unique_lock<component_map_mutex_type> > ul(l);
+
+            typedef typename Component::wrapping_type wrapping_type;
             for (std::size_t i = 0; i != count; ++i)
             {
-                ids.push_back(factory->create());
+                ids.push_back(detail::make_created_component(*factory, type,
+                    detail::construct_function<wrapping_type>()));
             }
         }
         LRT_(info) << "successfully created " << count //-V128
@@ -602,7 +665,7 @@ namespace hpx { namespace components { namespace server
     }
 
     template <typename Component, typename T, typename ...Ts>
-    std::vector<naming::gid_type>
+    std::vector<created_component>
     runtime_support::bulk_create_component(std::size_t count, T v, Ts... vs)
     {
         components::component_type const type =
@@ -620,7 +683,7 @@ namespace hpx { namespace components { namespace server
             HPX_THROW_EXCEPTION(hpx::bad_component_type,
                 "runtime_support::create_component",
                 strm.str());
-            return std::vector<naming::gid_type>();
+            return std::vector<created_component>();
         }
 
         if (!(*it).second.first) {
@@ -632,10 +695,10 @@ namespace hpx { namespace components { namespace server
             HPX_THROW_EXCEPTION(hpx::bad_component_type,
                 "runtime_support::create_component",
                 strm.str());
-            return std::vector<naming::gid_type>();
+            return std::vector<created_component>();
         }
 
-        std::vector<naming::gid_type> ids;
+        std::vector<created_component> ids;
         ids.reserve(count);
 
         std::shared_ptr<component_factory_base> factory((*it).second.first);
@@ -648,7 +711,7 @@ namespace hpx { namespace components { namespace server
                 // Note, T and Ts can't be (non-const) references, and parameters
                 // should be moved to allow for move-only constructor argument
                 // types.
-                ids.push_back(factory->create_with_args(
+                ids.push_back(detail::make_created_component(*factory, type,
                     detail::construct_function<wrapping_type>(
                         std::move(v), std::move(vs)...)));
             }
@@ -875,7 +938,7 @@ namespace hpx { namespace components { namespace server
     template <typename Component, typename ...Ts>
     struct create_component_action
       : ::hpx::actions::action<
-            naming::gid_type (runtime_support::*)(Ts...)
+            created_component (runtime_support::*)(Ts...)
           , &runtime_support::create_component<Component, Ts...>
           , create_component_action<Component, Ts...> >
     {};
@@ -883,7 +946,7 @@ namespace hpx { namespace components { namespace server
     template <typename Component>
     struct create_component_action<Component>
       : ::hpx::actions::action<
-            naming::gid_type (runtime_support::*)()
+            created_component (runtime_support::*)()
           , &runtime_support::create_component<Component>
           , create_component_action<Component> >
     {};
@@ -891,7 +954,7 @@ namespace hpx { namespace components { namespace server
     template <typename Component, typename ...Ts>
     struct create_component_direct_action
       : ::hpx::actions::direct_action<
-            naming::gid_type (runtime_support::*)(Ts...)
+            created_component (runtime_support::*)(Ts...)
           , &runtime_support::create_component<Component, Ts...>
           , create_component_direct_action<Component, Ts...> >
     {};
@@ -899,7 +962,7 @@ namespace hpx { namespace components { namespace server
     template <typename Component>
     struct create_component_direct_action<Component>
       : ::hpx::actions::direct_action<
-            naming::gid_type (runtime_support::*)()
+            created_component (runtime_support::*)()
           , &runtime_support::create_component<Component>
           , create_component_direct_action<Component> >
     {};
@@ -908,7 +971,8 @@ namespace hpx { namespace components { namespace server
     template <typename Component, typename ...Ts>
     struct bulk_create_component_action
       : ::hpx::actions::action<
-            std::vector<naming::gid_type> (runtime_support::*)(std::size_t, Ts...)
+            std::vector<created_component>
+                (runtime_support::*)(std::size_t, Ts...)
           , &runtime_support::bulk_create_component<Component, Ts...>
           , bulk_create_component_action<Component, Ts...> >
     {};
@@ -916,7 +980,7 @@ namespace hpx { namespace components { namespace server
     template <typename Component>
     struct bulk_create_component_action<Component>
       : ::hpx::actions::action<
-            std::vector<naming::gid_type> (runtime_support::*)(std::size_t)
+            std::vector<created_component> (runtime_support::*)(std::size_t)
           , &runtime_support::bulk_create_component<Component>
           , bulk_create_component_action<Component> >
     {};
@@ -924,7 +988,8 @@ namespace hpx { namespace components { namespace server
     template <typename Component, typename ...Ts>
     struct bulk_create_component_direct_action
       : ::hpx::actions::direct_action<
-            std::vector<naming::gid_type> (runtime_support::*)(std::size_t, Ts...)
+            std::vector<created_component>
+                (runtime_support::*)(std::size_t, Ts...)
           , &runtime_support::bulk_create_component<Component, Ts...>
           , bulk_create_component_direct_action<Component, Ts...> >
     {};
@@ -932,7 +997,7 @@ namespace hpx { namespace components { namespace server
     template <typename Component>
     struct bulk_create_component_direct_action<Component>
       : ::hpx::actions::direct_action<
-            std::vector<naming::gid_type> (runtime_support::*)(std::size_t)
+            std::vector<created_component> (runtime_support::*)(std::size_t)
           , &runtime_support::bulk_create_component<Component>
           , bulk_create_component_direct_action<Component> >
     {};
@@ -958,6 +1023,60 @@ namespace hpx { namespace components { namespace server
 
 namespace hpx { namespace traits
 {
+    ///////////////////////////////////////////////////////////////////////////
+    // Newly created components are returned as ids, their addresses are put
+    // into the local AGAS cache on the way.
+    template <>
+    struct get_remote_result<
+        naming::id_type, components::server::created_component>
+    {
+        static naming::id_type call(
+            components::server::created_component const& rhs)
+        {
+            if (rhs.addr_)
+            {
+                error_code ec(lightweight);
+                agas::update_cache_entry(rhs.gid_, rhs.addr_, ec);
+            }
+            return get_remote_result<
+                    naming::id_type, naming::gid_type
+                >::call(rhs.gid_);
+        }
+    };
+
+    template <>
+    struct promise_local_result<components::server::created_component>
+    {
+        typedef naming::id_type type;
+    };
+
+    template <>
+    struct get_remote_result<
+        std::vector<naming::id_type>,
+        std::vector<components::server::created_component> >
+    {
+        static std::vector<naming::id_type>
+        call(std::vector<components::server::created_component> const& rhs)
+        {
+            std::vector<naming::id_type> result;
+            result.reserve(rhs.size());
+            for (components::server::created_component const& r : rhs)
+            {
+                result.push_back(get_remote_result<
+                        naming::id_type, components::server::created_component
+                    >::call(r));
+            }
+            return result;
+        }
+    };
+
+    template <>
+    struct promise_local_result<
+        std::vector<components::server::created_component> >
+    {
+        typedef std::vector<naming::id_type> type;
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     // Termination detection does not make this locality black
     template <>
@@ -16,7 +16,9 @@
 #include <hpx/runtime_fwd.hpp>
 #include <hpx/util/high_resolution_timer.hpp>
 
+#include <memory>
 #include <sstream>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -84,6 +86,38 @@ namespace hpx { namespace parcelset
         return chunks;
     }
 
+    // The memory of the received zero-copy chunks may be adopted by the
+    // de-serialized objects (see serialize_buffer). Each chunk gets an owner
+    // of its own (stored at the position of the chunk in the list of
+    // chunks), a chunk is kept alive only for as long as an object refers to
+    // it.
+    template <typename Buffer>
+    std::vector<std::shared_ptr<void> > make_chunk_owners(Buffer& buffer,
+        std::size_t num_chunks)
+    {
+        typedef typename Buffer::transmission_chunk_type transmission_chunk_type;
+        typedef typename std::decay<
+                decltype(buffer.chunks_)
+            >::type::value_type chunk_type;
+
+        std::vector<std::shared_ptr<void> > owners;
+
+        std::size_t num_zero_copy_chunks = buffer.chunks_.size();
+        if (num_zero_copy_chunks != 0)
+        {
+            owners.resize(num_chunks);
+            for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+            {
+                // moving the chunk does not move the memory it holds
+                transmission_chunk_type& c = buffer.transmission_chunks_[i];
+                owners[static_cast<std::size_t>(c.first)] =
+                    std::make_shared<chunk_type>(std::move(buffer.chunks_[i]));
+            }
+            buffer.chunks_.clear();
+        }
+        return owners;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Parcelport, typename Buffer>
     void decode_message_with_chunks(
@@ -105,10 +139,13 @@ namespace hpx { namespace parcelset
                 performance_counters::parcels::data_point& data =
                     buffer.data_point_;
 
+                std::vector<std::shared_ptr<void> > chunk_owners =
+                    make_chunk_owners(buffer, chunks.size());
+
                 {
                     // De-serialize the parcel data
                     serialization::input_archive archive(buffer.data_,
-                        inbound_data_size, &chunks);
+                        inbound_data_size, &chunks, &chunk_owners);
 
                     if(parcel_count == 0)
                         archive >> parcel_count; //-V128
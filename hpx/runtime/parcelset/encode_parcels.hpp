@@ -119,16 +119,42 @@ namespace hpx
                 }
             }
 
+            // Gather the size of the archive by serializing the parcels
+            // without writing any data. The parcels are serialized exactly
+            // like it is done afterwards (into a single archive, optionally
+            // preceded by their number), this allows for allocating the
+            // buffer only once. The returned size doesn't account for
+            // compression.
             inline std::size_t
-            get_archive_size(parcel const& p, boost::uint32_t flags,
+            get_archive_size(parcel const* ps, std::size_t num_parcels,
+                bool store_count, boost::uint32_t flags,
                 boost::uint32_t dest_locality_id,
-                std::vector<serialization::serialization_chunk>* chunks)
+                std::vector<serialization::serialization_chunk>* chunks,
+                boost::uint64_t max_outbound_size, std::size_t& parcels_sent)
             {
-                // gather the required size for the archive
                 hpx::serialization::detail::size_gatherer_container gather_size;
-                hpx::serialization::output_archive archive(
-                    gather_size, flags, dest_locality_id, chunks);
-                archive << p;
+
+                {
+                    hpx::serialization::output_archive archive(
+                        gather_size, flags, dest_locality_id, chunks);
+
+                    // the number of parcels is stored with a fixed size, the
+                    // actual value doesn't matter here
+                    if (store_count)
+                        archive << num_parcels; //-V128
+
+                    parcels_sent = 0;
+                    for (/**/; parcels_sent != num_parcels; ++parcels_sent)
+                    {
+                        if (parcels_sent != 0 &&
+                            gather_size.size() >= max_outbound_size)
+                        {
+                            break;
+                        }
+                        archive << ps[parcels_sent];
+                    }
+                }
+
                 return gather_size.size();
             }
         }
@@ -162,15 +188,12 @@ namespace hpx
 
 
                     // preallocate data
-                    for (/**/; parcels_sent != parcels_size; ++parcels_sent)
-                    {
-                        if (arg_size >= max_outbound_size)
-                            break;
-                        arg_size += detail::get_archive_size(ps[parcels_sent],
-                            archive_flags, dest_locality_id, &buffer.chunks_);
-                    }
+                    std::size_t const archive_size = detail::get_archive_size(
+                        ps, parcels_size, num_parcels != std::size_t(-1),
+                        archive_flags, dest_locality_id, &buffer.chunks_,
+                        max_outbound_size, parcels_sent);
 
-                    buffer.data_.reserve(arg_size);
+                    buffer.data_.reserve(archive_size);
 
                     // mark start of serialization
                     util::high_resolution_timer timer;
@@ -200,6 +223,10 @@ namespace hpx
                         arg_size = archive.bytes_written();
                     }
 
+                    // without compression the buffer was sized exactly
+                    HPX_ASSERT(filter.get() != nullptr ||
+                        buffer.data_.size() == archive_size);
+
                     // store the time required for serialization
                     buffer.data_point_.serialization_time_ =
                         timer.elapsed_nanoseconds();
@@ -309,6 +309,12 @@ namespace hpx { namespace parcelset
         // number of parcels routed
         boost::int64_t get_parcel_routed_count(bool);
 
+        // number of parcels delivered locally without being serialized
+        boost::int64_t get_parcel_loopback_count(bool);
+
+        // number of parcels handed to one of the parcelports
+        boost::int64_t get_parcel_network_count(bool);
+
         // number of parcels received
         boost::int64_t get_parcel_receive_count(std::string const&, bool) const;
 
@@ -358,6 +364,13 @@ namespace hpx { namespace parcelset
 
         boost::int64_t get_connection_cache_statistics(std::string const& pp_type,
             parcelport::connection_cache_statistics_type stat_type, bool) const;
+        boost::int64_t get_buffer_pool_statistics(std::string const& pp_type,
+            parcelport::buffer_pool_statistics_type stat_type, bool) const;
+
+        boost::int64_t get_queue_time(std::string const& pp_type,
+            parcelport::parcel_lane lane, bool) const;
+        boost::int64_t get_queue_count(std::string const& pp_type,
+            parcelport::parcel_lane lane, bool) const;
 
         void list_parcelports(std::ostringstream& strm) const;
         void list_parcelport(std::ostringstream& strm,
@@ -392,6 +405,12 @@ namespace hpx { namespace parcelset
 
         std::pair<std::shared_ptr<parcelport>, locality>
         find_appropriate_destination(naming::gid_type const & dest_gid);
+
+        // parcels which are addressed to this locality only are scheduled
+        // directly
+        bool can_deliver_locally(parcel const& p) const;
+        void deliver_locally(parcel p, write_handler_type const& f);
+
         locality find_endpoint(endpoints_type const & eps, std::string const & name);
 
         void register_counter_types(std::string const& pp_type);
@@ -445,6 +464,14 @@ namespace hpx { namespace parcelset
         /// Count number of (outbound) parcels routed
         boost::atomic<boost::int64_t> count_routed_;
 
+        /// Count number of (outbound) parcels which were delivered locally
+        /// or handed to one of the parcelports
+        boost::atomic<boost::int64_t> count_loopback_;
+        boost::atomic<boost::int64_t> count_network_;
+
+        /// the applier used for delivering local parcels
+        applier::applier* applier_;
+
         /// global exception handler for unhandled exceptions thrown from the
         /// parcel layer
         mutable mutex_type mtx_;
@@ -17,9 +17,12 @@
 #include <hpx/runtime/applier_fwd.hpp>
 #include <hpx/runtime/parcelset/locality.hpp>
 #include <hpx/runtime/parcelset/parcel.hpp>
+#include <hpx/runtime/threads/thread_enums.hpp>
 #include <hpx/util/function.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util_fwd.hpp>
 
+#include <boost/atomic.hpp>
 #include <boost/cstdint.hpp>
 
 #include <deque>
@@ -176,6 +179,21 @@ namespace hpx { namespace parcelset
         virtual boost::int64_t get_connection_cache_statistics(
             connection_cache_statistics_type, bool reset) = 0;
 
+        /// Return the given statistic of the pool of receive buffers
+        enum buffer_pool_statistics_type
+        {
+            buffer_pool_hits = 0,
+            buffer_pool_misses = 1
+        };
+
+        // retrieve performance counter value for given statistics type, the
+        // default is for parcelports which do not pool their receive buffers
+        virtual boost::int64_t get_buffer_pool_statistics(
+            buffer_pool_statistics_type, bool /*reset*/)
+        {
+            return 0;
+        }
+
         /// Return the name of this locality
         virtual std::string get_locality_name() const = 0;
 
@@ -301,7 +319,47 @@ namespace hpx { namespace parcelset
         boost::uint64_t get_pending_parcels_count(bool /*reset*/)
         {
             std::lock_guard<lcos::local::spinlock> l(mtx_);
-            return pending_parcels_.size();
+            return pending_parcels_[lane_normal].size() +
+                pending_parcels_[lane_priority].size();
+        }
+
+        /// Outgoing parcels are queued on separate lanes depending on the
+        /// priority of the action they carry. Parcels on the priority lane
+        /// don't have to wait for bulk data to the same destination and are
+        /// sent over their own connections.
+        enum parcel_lane
+        {
+            lane_normal = 0,
+            lane_priority = 1,
+            num_lanes = 2
+        };
+
+        parcel_lane get_parcel_lane(parcel const& p) const
+        {
+            if (!enable_priority_lanes_)
+                return lane_normal;
+
+            threads::thread_priority priority = p.get_thread_priority();
+            if (priority == threads::thread_priority_critical ||
+                priority == threads::thread_priority_boost)
+            {
+                return lane_priority;
+            }
+            return lane_normal;
+        }
+
+        /// the total time the parcels sent from the given lane have spent
+        /// between being handed to the parcel layer and being encoded for
+        /// sending (nanoseconds)
+        boost::int64_t get_queue_time(parcel_lane lane, bool reset)
+        {
+            return util::get_and_reset_value(queue_time_[lane], reset);
+        }
+
+        /// number of parcels sent from the given lane
+        boost::int64_t get_queue_count(parcel_lane lane, bool reset)
+        {
+            return util::get_and_reset_value(queue_count_[lane], reset);
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -380,10 +438,14 @@ namespace hpx { namespace parcelset
 #endif
             map_second_type;
         typedef std::map<locality, map_second_type> pending_parcels_map;
-        pending_parcels_map pending_parcels_;
+        pending_parcels_map pending_parcels_[num_lanes];
 
         typedef std::set<locality> pending_parcels_destinations;
-        pending_parcels_destinations parcel_destinations_;
+        pending_parcels_destinations parcel_destinations_[num_lanes];
+
+        /// queueing statistics for each of the lanes
+        boost::atomic<boost::int64_t> queue_time_[num_lanes];
+        boost::atomic<boost::int64_t> queue_count_[num_lanes];
 
         /// The local locality
         locality here_;
@@ -406,6 +468,9 @@ namespace hpx { namespace parcelset
         /// async serialization of parcels
         bool async_serialization_;
 
+        /// queue parcels of high priority actions separately
+        bool enable_priority_lanes_;
+
         /// priority of the parcelport
         int priority_;
         std::string type_;
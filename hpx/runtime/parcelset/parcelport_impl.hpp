@@ -21,6 +21,7 @@
 #include <hpx/throw_exception.hpp>
 #include <hpx/util/bind.hpp>
 #include <hpx/util/connection_cache.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
 #include <hpx/util/io_service_pool.hpp>
 #include <hpx/util/runtime_configuration.hpp>
 #include <hpx/util/safe_lexical_cast.hpp>
@@ -63,6 +64,9 @@ namespace hpx { namespace parcelset
             future_await_container_type;
         typedef hpx::serialization::output_archive archive_type;
 
+        typedef util::connection_cache<connection, locality>
+            connection_cache_type;
+
     public:
         static const char * connection_handler_type()
         {
@@ -108,6 +112,16 @@ namespace hpx { namespace parcelset
                 HPX_PARCEL_MAX_CONNECTIONS_PER_LOCALITY);
         }
 
+        static std::size_t max_priority_connections_per_loc(
+            util::runtime_configuration const& ini)
+        {
+            std::string key("hpx.parcel.");
+            key += connection_handler_type();
+
+            return hpx::util::get_entry_as<std::size_t>(
+                ini, key + ".priority_connections_per_locality", "2");
+        }
+
     public:
         /// Construct the parcelport on the given locality.
         parcelport_impl(util::runtime_configuration const& ini,
@@ -118,6 +132,8 @@ namespace hpx { namespace parcelset
           , io_service_pool_(thread_pool_size(ini),
                 on_start_thread, on_stop_thread, pool_name(), pool_name_postfix())
           , connection_cache_(max_connections(ini), max_connections_per_loc(ini))
+          , priority_connection_cache_(max_connections(ini),
+                max_priority_connections_per_loc(ini))
           , archive_flags_(0)
           , operations_in_flight_(0)
           , num_thread_(0)
@@ -154,6 +170,7 @@ namespace hpx { namespace parcelset
         ~parcelport_impl()
         {
             connection_cache_.clear();
+            priority_connection_cache_.clear();
         }
 
         bool can_bootstrap() const
@@ -192,9 +209,11 @@ namespace hpx { namespace parcelset
             io_service_pool_.stop();
             if (blocking) {
                 connection_cache_.shutdown();
+                priority_connection_cache_.shutdown();
                 connection_handler().do_stop();
                 io_service_pool_.join();
                 connection_cache_.clear();
+                priority_connection_cache_.clear();
                 io_service_pool_.clear();
             }
 
@@ -235,10 +254,11 @@ namespace hpx { namespace parcelset
             }
             else {
                 // enqueue the outgoing parcel ...
-                enqueue_parcel(dest, std::move(p), std::move(f),
+                parcel_lane lane = this->get_parcel_lane(p);
+                enqueue_parcel(lane, dest, std::move(p), std::move(f),
                     std::move(future_await->new_gids_));
 
-                get_connection_and_send_parcels(dest);
+                get_connection_and_send_parcels(dest, lane);
             }
         }
 
@@ -286,11 +306,24 @@ namespace hpx { namespace parcelset
                 return;
             }
 
+            // The new gids are shared between all parcels of this batch, the
+            // batch is kept together and sent on the priority lane if any of
+            // its parcels belong there.
+            parcel_lane lane = lane_normal;
+            for (parcel const& p : parcels)
+            {
+                if (this->get_parcel_lane(p) == lane_priority)
+                {
+                    lane = lane_priority;
+                    break;
+                }
+            }
+
             // enqueue the outgoing parcel ...
-            enqueue_parcels(dest, std::move(parcels), std::move(handlers),
+            enqueue_parcels(lane, dest, std::move(parcels), std::move(handlers),
                 std::move(future_await->new_gids_));
 
-            get_connection_and_send_parcels(dest);
+            get_connection_and_send_parcels(dest, lane);
         }
 
     public:
@@ -374,6 +407,7 @@ namespace hpx { namespace parcelset
             }
 
             connection_cache_.clear(loc);
+            priority_connection_cache_.clear(loc);
         }
 
         void remove_from_connection_cache(locality const& loc)
@@ -408,19 +442,24 @@ namespace hpx { namespace parcelset
         {
             switch (t) {
                 case connection_cache_insertions:
-                    return connection_cache_.get_cache_insertions(reset);
+                    return connection_cache_.get_cache_insertions(reset) +
+                        priority_connection_cache_.get_cache_insertions(reset);
 
                 case connection_cache_evictions:
-                    return connection_cache_.get_cache_evictions(reset);
+                    return connection_cache_.get_cache_evictions(reset) +
+                        priority_connection_cache_.get_cache_evictions(reset);
 
                 case connection_cache_hits:
-                    return connection_cache_.get_cache_hits(reset);
+                    return connection_cache_.get_cache_hits(reset) +
+                        priority_connection_cache_.get_cache_hits(reset);
 
                 case connection_cache_misses:
-                    return connection_cache_.get_cache_misses(reset);
+                    return connection_cache_.get_cache_misses(reset) +
+                        priority_connection_cache_.get_cache_misses(reset);
 
                 case connection_cache_reclaims:
-                    return connection_cache_.get_cache_reclaims(reset);
+                    return connection_cache_.get_cache_reclaims(reset) +
+                        priority_connection_cache_.get_cache_reclaims(reset);
 
                 default:
                     break;
@@ -520,14 +559,22 @@ namespace hpx { namespace parcelset
         }
 
         ///////////////////////////////////////////////////////////////////////
-        std::shared_ptr<connection> get_connection(
+        // Parcels on the priority lane are sent over a separate set of
+        // connections, they never wait for a connection busy with bulk data.
+        connection_cache_type& get_connection_cache(parcel_lane lane)
+        {
+            return lane == lane_priority ?
+                priority_connection_cache_ : connection_cache_;
+        }
+
+        std::shared_ptr<connection> get_connection(parcel_lane lane,
             locality const& l, bool force, error_code& ec)
         {
             // Request new connection from connection cache.
             std::shared_ptr<connection> sender_connection;
 
             // Get a connection or reserve space for a new connection.
-            if (!connection_cache_.get_or_reserve(l, sender_connection))
+            if (!get_connection_cache(lane).get_or_reserve(l, sender_connection))
             {
                 // If no slot is available it's not a problem as the parcel
                 // will be sent out whenever the next connection is returned
@@ -565,7 +612,7 @@ namespace hpx { namespace parcelset
         }
 
         ///////////////////////////////////////////////////////////////////////
-        void enqueue_parcel(locality const& locality_id,
+        void enqueue_parcel(parcel_lane lane, locality const& locality_id,
             parcel&& p, write_handler_type&& f, new_gids_map && new_gids)
         {
             typedef pending_parcels_map::mapped_type mapped_type;
@@ -578,7 +625,7 @@ namespace hpx { namespace parcelset
                 std::unique_lock<lcos::local::spinlock>
             > il(&l);
 
-            mapped_type& e = pending_parcels_[locality_id];
+            mapped_type& e = pending_parcels_[lane][locality_id];
 #if defined(HPX_PARCELSET_PENDING_PARCELS_WORKAROUND)
             if(!util::get<0>(e))
                 util::get<0>(e) = std::make_shared<std::vector<parcel> >();
@@ -590,10 +637,10 @@ namespace hpx { namespace parcelset
 
             merge_gids(util::get<2>(e), std::move(new_gids));
 
-            parcel_destinations_.insert(locality_id);
+            parcel_destinations_[lane].insert(locality_id);
         }
 
-        void enqueue_parcels(locality const& locality_id,
+        void enqueue_parcels(parcel_lane lane, locality const& locality_id,
             std::vector<parcel>&& parcels,
             std::vector<write_handler_type>&& handlers, new_gids_map && new_gids)
         {
@@ -609,7 +656,7 @@ namespace hpx { namespace parcelset
 
             HPX_ASSERT(parcels.size() == handlers.size());
 
-            mapped_type& e = pending_parcels_[locality_id];
+            mapped_type& e = pending_parcels_[lane][locality_id];
 #if defined(HPX_PARCELSET_PENDING_PARCELS_WORKAROUND)
             if(!util::get<0>(e))
             {
@@ -650,10 +697,10 @@ namespace hpx { namespace parcelset
 
             merge_gids(util::get<2>(e), std::move(new_gids));
 
-            parcel_destinations_.insert(locality_id);
+            parcel_destinations_[lane].insert(locality_id);
         }
 
-        bool dequeue_parcels(locality const& locality_id,
+        bool dequeue_parcels(parcel_lane lane, locality const& locality_id,
             std::vector<parcel>& parcels,
             std::vector<write_handler_type>& handlers,
             new_gids_map & new_gids)
@@ -663,14 +710,15 @@ namespace hpx { namespace parcelset
             {
                 std::lock_guard<lcos::local::spinlock> l(mtx_);
 
-                iterator it = pending_parcels_.find(locality_id);
+                pending_parcels_map& pending = pending_parcels_[lane];
+                iterator it = pending.find(locality_id);
 
                 // do nothing if parcels have already been picked up by
                 // another thread
 #if defined(HPX_PARCELSET_PENDING_PARCELS_WORKAROUND)
-                if (it != pending_parcels_.end() && !util::get<0>(it->second)->empty())
+                if (it != pending.end() && !util::get<0>(it->second)->empty())
 #else
-                if (it != pending_parcels_.end() && !util::get<0>(it->second).empty())
+                if (it != pending.end() && !util::get<0>(it->second).empty())
 #endif
                 {
                     HPX_ASSERT(it->first == locality_id);
@@ -688,11 +736,12 @@ namespace hpx { namespace parcelset
                 }
                 else
                 {
-                    HPX_ASSERT(util::get<1>(it->second).empty());
+                    HPX_ASSERT(it == pending.end() ||
+                        util::get<1>(it->second).empty());
                     return false;
                 }
 
-                parcel_destinations_.erase(locality_id);
+                parcel_destinations_[lane].erase(locality_id);
 
                 return true;
             }
@@ -702,28 +751,30 @@ namespace hpx { namespace parcelset
         {
             if(hpx::is_stopped()) return true;
 
-            std::vector<locality> destinations;
+            std::vector<locality> destinations[num_lanes];
 
             {
                 std::unique_lock<lcos::local::spinlock> l(mtx_, std::try_to_lock);
                 if(l.owns_lock())
                 {
-                    if (parcel_destinations_.empty())
-                        return true;
-
-                    destinations.reserve(parcel_destinations_.size());
-                    for (locality const& loc : parcel_destinations_)
+                    for (int lane = 0; lane != num_lanes; ++lane)
                     {
-                        destinations.push_back(loc);
+                        destinations[lane].assign(
+                            parcel_destinations_[lane].begin(),
+                            parcel_destinations_[lane].end());
                     }
                 }
             }
 
             // Create new HPX threads which send the parcels that are still
-            // pending.
-            for (locality const& loc : destinations)
+            // pending, the priority lane goes first.
+            for (locality const& loc : destinations[lane_priority])
             {
-                get_connection_and_send_parcels(loc);
+                get_connection_and_send_parcels(loc, lane_priority);
+            }
+            for (locality const& loc : destinations[lane_normal])
+            {
+                get_connection_and_send_parcels(loc, lane_normal);
             }
 
             return true;
@@ -775,8 +826,8 @@ namespace hpx { namespace parcelset
         }
 
         ///////////////////////////////////////////////////////////////////////
-        void get_connection_and_send_parcels(
-            locality const& locality_id, bool background = false)
+        void get_connection_and_send_parcels(locality const& locality_id,
+            parcel_lane lane, bool background = false)
         {
             // repeat until no more parcels are to be sent
 //             while (!hpx::is_stopped())
@@ -785,7 +836,8 @@ namespace hpx { namespace parcelset
                 std::vector<write_handler_type> handlers;
                 new_gids_map new_gids;
 
-                if(!dequeue_parcels(locality_id, parcels, handlers, new_gids))
+                if(!dequeue_parcels(lane, locality_id, parcels, handlers,
+                        new_gids))
                 {
                     return;
                 }
@@ -796,12 +848,12 @@ namespace hpx { namespace parcelset
 
                 error_code ec;
                 std::shared_ptr<connection> sender_connection =
-                    get_connection(locality_id, force_connection, ec);
+                    get_connection(lane, locality_id, force_connection, ec);
 
                 if (!sender_connection)
                 {
                     // give the parcels back to the queues for later
-                    enqueue_parcels(locality_id, std::move(parcels),
+                    enqueue_parcels(lane, locality_id, std::move(parcels),
                         std::move(handlers), std::move(new_gids));
 
                     // We can safely return if no connection is available
@@ -820,6 +872,7 @@ namespace hpx { namespace parcelset
                             hpx::util::one_shot(&parcelport_impl
                                 ::send_pending_parcels)
                           , this
+                          , lane
                           , locality_id
                           , sender_connection
                           , std::move(parcels)
@@ -834,7 +887,7 @@ namespace hpx { namespace parcelset
                 else
                 {
                     send_pending_parcels(
-                        locality_id,
+                        lane, locality_id,
                         sender_connection, std::move(parcels),
                         std::move(handlers), std::move(new_gids));
                 }
@@ -864,7 +917,8 @@ namespace hpx { namespace parcelset
         void send_pending_parcels_trampoline(
             boost::system::error_code const& ec,
             locality const& locality_id,
-            std::shared_ptr<connection> sender_connection)
+            std::shared_ptr<connection> sender_connection,
+            parcel_lane lane)
         {
             HPX_ASSERT(operations_in_flight_ != 0);
             --operations_in_flight_;
@@ -876,33 +930,36 @@ namespace hpx { namespace parcelset
             {
                 // Give this connection back to the cache as it's not
                 // needed anymore.
-                connection_cache_.reclaim(locality_id, sender_connection);
+                get_connection_cache(lane).reclaim(
+                    locality_id, sender_connection);
             }
             else
             {
                 // remove this connection from cache
-                connection_cache_.clear(locality_id, sender_connection);
+                get_connection_cache(lane).clear(
+                    locality_id, sender_connection);
             }
             {
                 std::lock_guard<lcos::local::spinlock> l(mtx_);
 
                 HPX_ASSERT(locality_id == sender_connection->destination());
-                pending_parcels_map::iterator it = pending_parcels_.find(locality_id);
+                pending_parcels_map& pending = pending_parcels_[lane];
+                pending_parcels_map::iterator it = pending.find(locality_id);
 #if defined(HPX_PARCELSET_PENDING_PARCELS_WORKAROUND)
-                if (it == pending_parcels_.end() ||
+                if (it == pending.end() ||
                     (util::get<0>(it->second) && util::get<0>(it->second)->empty()))
 #else
-                if (it == pending_parcels_.end() || util::get<0>(it->second).empty())
+                if (it == pending.end() || util::get<0>(it->second).empty())
 #endif
                     return;
             }
 
             // Create a new HPX thread which sends parcels that are still
             // pending.
-            get_connection_and_send_parcels(locality_id);
+            get_connection_and_send_parcels(locality_id, lane);
         }
 
-        void send_pending_parcels(
+        void send_pending_parcels(parcel_lane lane,
             parcelset::locality const & parcel_locality_id,
             std::shared_ptr<connection> sender_connection,
             std::vector<parcel>&& parcels,
@@ -928,6 +985,8 @@ namespace hpx { namespace parcelset
                     this->get_max_outbound_message_size(),
                     &new_gids);
 
+            record_queue_time(lane, parcels.data(), num_parcels);
+
             using hpx::parcelset::detail::call_for_each;
             using hpx::util::placeholders::_1;
             using hpx::util::placeholders::_2;
@@ -939,7 +998,7 @@ namespace hpx { namespace parcelset
                 sender_connection->async_write(
                     call_for_each(std::move(handlers), std::move(parcels)),
                     util::bind(&parcelport_impl::send_pending_parcels_trampoline,
-                        this, _1, _2, _3));
+                        this, _1, _2, _3, lane));
             }
             else
             {
@@ -963,13 +1022,13 @@ namespace hpx { namespace parcelset
                     call_for_each(
                         std::move(handled_handlers), std::move(handled_parcels)),
                     util::bind(&parcelport_impl::send_pending_parcels_trampoline,
-                        this, _1, _2, _3));
+                        this, _1, _2, _3, lane));
 
                 // give back unhandled parcels
                 parcels.erase(parcels.begin(), parcels.begin()+num_parcels);
                 handlers.erase(handlers.begin(), handlers.begin()+num_parcels);
 
-                enqueue_parcels(parcel_locality_id, std::move(parcels),
+                enqueue_parcels(lane, parcel_locality_id, std::move(parcels),
                     std::move(handlers), std::move(new_gids));
             }
 
@@ -981,6 +1040,28 @@ namespace hpx { namespace parcelset
             }
         }
 
+        // accumulate the time the given parcels have spent since they were
+        // handed to the parcel layer
+        void record_queue_time(parcel_lane lane, parcel const* parcels,
+            std::size_t num_parcels)
+        {
+            double now = util::high_resolution_timer::now();
+
+            boost::int64_t queue_time = 0;
+            for (std::size_t i = 0; i != num_parcels; ++i)
+            {
+                double start_time = parcels[i].start_time();
+                if (start_time != 0 && start_time < now)
+                {
+                    queue_time += static_cast<boost::int64_t>(
+                        (now - start_time) * 1e9);
+                }
+            }
+
+            queue_time_[lane] += queue_time;
+            queue_count_[lane] += static_cast<boost::int64_t>(num_parcels);
+        }
+
     public:
         std::size_t get_next_num_thread()
         {
@@ -991,8 +1072,9 @@ namespace hpx { namespace parcelset
         /// The pool of io_service objects used to perform asynchronous operations.
         util::io_service_pool io_service_pool_;
 
-        /// The connection cache for sending connections
-        util::connection_cache<connection, locality> connection_cache_;
+        /// The connection caches for sending connections, one for each lane
+        connection_cache_type connection_cache_;
+        connection_cache_type priority_connection_cache_;
 
         typedef hpx::lcos::local::spinlock mutex_type;
 
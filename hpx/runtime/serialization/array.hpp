@@ -173,4 +173,22 @@ namespace hpx { namespace serialization
     }
 }}
 
+namespace hpx { namespace traits
+{
+    // fixed size arrays of bitwise serializable elements are bitwise
+    // serializable themselves, this allows containers of those to be
+    // serialized as a single chunk
+    template <typename T, std::size_t N>
+    struct is_bitwise_serializable<boost::array<T, N> >
+      : is_bitwise_serializable<T>
+    {};
+
+#ifdef HPX_HAVE_CXX11_STD_ARRAY
+    template <typename T, std::size_t N>
+    struct is_bitwise_serializable<std::array<T, N> >
+      : is_bitwise_serializable<T>
+    {};
+#endif
+}}
+
 #endif // HPX_SERIALIZATION_ARRAY_HPP
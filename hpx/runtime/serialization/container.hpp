@@ -14,6 +14,9 @@
 #include <hpx/runtime/serialization/binary_filter.hpp>
 #include <hpx/util/assert.hpp>
 
+#include <cstddef>
+#include <memory>
+
 namespace hpx { namespace serialization
 {
     struct erased_output_container
@@ -40,6 +43,8 @@ namespace hpx { namespace serialization
         virtual void set_filter(binary_filter* filter) = 0;
         virtual void load_binary(void * address, std::size_t count) = 0;
         virtual void load_binary_chunk(void * address, std::size_t count) = 0;
+        virtual void* adopt_binary_chunk(std::size_t count,
+            std::size_t alignment, std::shared_ptr<void>& owner) = 0;
     };
 }}
 
@@ -33,12 +33,17 @@ namespace hpx { namespace serialization
             std::map<boost::uint64_t, detail::ptr_helper_ptr>
             pointer_tracker;
 
+        // The memory of a zero-copy chunk can be adopted by the
+        // de-serialized objects if the corresponding entry of 'chunk_owners'
+        // manages its lifetime.
         template <typename Container>
         input_archive(Container & buffer,
             std::size_t inbound_data_size = 0,
-            const std::vector<serialization_chunk>* chunks = nullptr)
+            const std::vector<serialization_chunk>* chunks = nullptr,
+            const std::vector<std::shared_ptr<void> >* chunk_owners = nullptr)
           : base_type(0U)
-          , buffer_(new input_container<Container>(buffer, chunks, inbound_data_size))
+          , buffer_(new input_container<Container>(buffer, chunks,
+                inbound_data_size, chunk_owners))
         {
             // endianness needs to be saves separately as it is needed to
             // properly interpret the flags
@@ -118,6 +123,22 @@ namespace hpx { namespace serialization
             return size_;
         }
 
+        // Try to take over the memory holding the next chunk of binary data
+        // instead of copying it (see serialize_buffer). Returns nullptr if
+        // the data has to be loaded using load_binary_chunk.
+        void* adopt_binary_chunk(std::size_t count, std::size_t alignment,
+            std::shared_ptr<void>& owner)
+        {
+            if (0 == count || disable_data_chunking())
+                return nullptr;
+
+            void* data = buffer_->adopt_binary_chunk(count, alignment, owner);
+            if (data != nullptr)
+                size_ += count;
+
+            return data;
+        }
+
         // this function is needed to avoid a MSVC linker error
         std::size_t current_pos() const
         {
@@ -143,7 +164,8 @@ namespace hpx { namespace serialization
                 "Can not bitwise serialize a class that is abstract");
             if(disable_array_optimization())
             {
-                access::serialize(*this, t, 0);
+                load_bitwise_serialize(t,
+                    hpx::traits::detail::has_serialize_function<T>());
             }
             else
             {
@@ -151,6 +173,20 @@ namespace hpx { namespace serialization
             }
         }
 
+        template <typename T>
+        void load_bitwise_serialize(T & t, std::true_type)
+        {
+            access::serialize(*this, t, 0);
+        }
+
+        // types which are bitwise serializable without providing a
+        // serialization function are copied as a whole
+        template <typename T>
+        void load_bitwise_serialize(T & t, std::false_type)
+        {
+            load_binary(&t, sizeof(t));
+        }
+
         template <class T>
         void load_nonintrusively_polymorphic(T& t, std::false_type)
         {
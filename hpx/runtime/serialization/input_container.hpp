@@ -15,6 +15,7 @@
 #include <hpx/util/assert.hpp>
 
 #include <cstddef> // for size_t
+#include <cstdint> // for uintptr_t
 #include <cstring> // for memcpy
 #include <memory>
 #include <vector>
@@ -49,15 +50,18 @@ namespace hpx { namespace serialization
         input_container(Container const& cont, std::size_t inbound_data_size)
           : cont_(cont), current_(0), filter_(),
             decompressed_size_(inbound_data_size),
-            chunks_(nullptr), current_chunk_(std::size_t(-1)), current_chunk_size_(0)
+            chunks_(nullptr), current_chunk_(std::size_t(-1)), current_chunk_size_(0),
+            chunk_owners_(nullptr)
         {}
 
         input_container(Container const& cont,
                 std::vector<serialization_chunk> const* chunks,
-                std::size_t inbound_data_size)
+                std::size_t inbound_data_size,
+                std::vector<std::shared_ptr<void> > const* chunk_owners = nullptr)
           : cont_(cont), current_(0), filter_(),
             decompressed_size_(inbound_data_size),
-            chunks_(nullptr), current_chunk_(std::size_t(-1)), current_chunk_size_(0)
+            chunks_(nullptr), current_chunk_(std::size_t(-1)), current_chunk_size_(0),
+            chunk_owners_(chunk_owners)
         {
             if (chunks && chunks->size() != 0)
             {
@@ -154,6 +158,46 @@ namespace hpx { namespace serialization
             }
         }
 
+        // Hand out the memory of the next zero-copy chunk instead of copying
+        // it. The memory stays valid as long as 'owner' is alive. Returns
+        // nullptr if the chunk can't be adopted, nothing is consumed in this
+        // case.
+        void* adopt_binary_chunk(std::size_t count, std::size_t alignment,
+            std::shared_ptr<void>& owner) // override
+        {
+            if (filter_.get() || chunks_ == nullptr ||
+                chunk_owners_ == nullptr ||
+                count < HPX_ZERO_COPY_SERIALIZATION_THRESHOLD)
+            {
+                return nullptr;
+            }
+
+            HPX_ASSERT(current_chunk_ != std::size_t(-1));
+            HPX_ASSERT(get_chunk_type(current_chunk_) == chunk_type_pointer);
+
+            if (current_chunk_ >= chunk_owners_->size() ||
+                !(*chunk_owners_)[current_chunk_])
+            {
+                return nullptr;
+            }
+
+            if (get_chunk_size(current_chunk_) != count)
+            {
+                HPX_THROW_EXCEPTION(serialization_error
+                  , "input_container::adopt_binary_chunk"
+                  , "archive data bstream data chunk size mismatch");
+                return nullptr;
+            }
+
+            void* data = get_chunk_data(current_chunk_).pos_;
+            if (reinterpret_cast<std::uintptr_t>(data) % alignment != 0)
+                return nullptr;
+
+            owner = (*chunk_owners_)[current_chunk_];
+            ++current_chunk_;
+            return data;
+        }
+
         Container const& cont_;
         std::size_t current_;
         std::unique_ptr<binary_filter> filter_;
@@ -162,6 +206,9 @@ namespace hpx { namespace serialization
         std::vector<serialization_chunk> const* chunks_;
         std::size_t current_chunk_;
         std::size_t current_chunk_size_;
+
+        // keep the memory referenced by each of the zero-copy chunks alive
+        std::vector<std::shared_ptr<void> > const* chunk_owners_;
     };
 }}
 
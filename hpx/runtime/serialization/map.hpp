@@ -17,18 +17,6 @@
 
 namespace hpx
 {
-    namespace traits
-    {
-        template <typename Key, typename Value>
-        struct is_bitwise_serializable<std::pair<Key, Value> >
-          : std::integral_constant<
-                bool,
-                is_bitwise_serializable<Key>::value
-             && is_bitwise_serializable<Value>::value
-            >
-        {};
-    }
-
     namespace serialization
     {
         namespace detail
@@ -174,7 +174,8 @@ namespace hpx { namespace serialization
                 "Can not bitwise serialize a class that is abstract");
             if(disable_array_optimization())
             {
-                access::serialize(*this, t, 0);
+                save_bitwise_serialize(t,
+                    hpx::traits::detail::has_serialize_function<T>());
             }
             else
             {
@@ -182,6 +183,20 @@ namespace hpx { namespace serialization
             }
         }
 
+        template <typename T>
+        void save_bitwise_serialize(T const & t, std::true_type)
+        {
+            access::serialize(*this, t, 0);
+        }
+
+        // types which are bitwise serializable without providing a
+        // serialization function are copied as a whole
+        template <typename T>
+        void save_bitwise_serialize(T const & t, std::false_type)
+        {
+            save_binary(&t, sizeof(t));
+        }
+
         template <typename T>
         void save_nonintrusively_polymorphic(T const & t, std::false_type)
         {
@@ -11,13 +11,17 @@
 #include <hpx/runtime/serialization/array.hpp>
 #include <hpx/runtime/serialization/serialize.hpp>
 #include <hpx/throw_exception.hpp>
+#include <hpx/traits/is_bitwise_serializable.hpp>
 #include <hpx/traits/supports_streaming_with_any.hpp>
 #include <hpx/util/bind.hpp>
 
 #include <boost/shared_array.hpp>
 
 #include <algorithm>
+#include <cstddef>
+#include <memory>
 #include <type_traits>
+#include <utility>
 
 namespace hpx { namespace serialization
 {
@@ -30,6 +34,9 @@ namespace hpx { namespace serialization
 
         static void no_deleter(T*) {}
 
+        // keeps the memory alive which was adopted from an archive
+        static void owner_deleter(T*, std::shared_ptr<void> const&) {}
+
         template <typename Deallocator>
         static void deleter(T* p, Deallocator dealloc, std::size_t size)
         {
@@ -252,12 +259,54 @@ namespace hpx { namespace serialization
         }
 
         ///////////////////////////////////////////////////////////////////////
+        // Large arrays of bitwise serializable data are received into buffers
+        // of their own (zero-copy chunks), those can be adopted directly
+        // instead of being copied into newly allocated memory. This is not
+        // done if a custom allocator was specified.
+        typedef std::integral_constant<bool,
+                hpx::traits::is_bitwise_serializable<T>::value &&
+                std::is_same<Allocator, std::allocator<T> >::value
+            > can_adopt_data;
+
+        template <typename Archive>
+        bool load_in_place(Archive& ar, std::false_type)
+        {
+            return false;
+        }
+
+        template <typename Archive>
+        bool load_in_place(Archive& ar, std::true_type)
+        {
+#ifdef BOOST_BIG_ENDIAN
+            bool archive_endianess_differs = ar.endian_little();
+#else
+            bool archive_endianess_differs = ar.endian_big();
+#endif
+            if (ar.disable_array_optimization() || archive_endianess_differs)
+                return false;
+
+            std::shared_ptr<void> owner;
+            void* data = ar.adopt_binary_chunk(size_ * sizeof(T),
+                std::alignment_of<T>::value, owner);
+            if (data == nullptr)
+                return false;
+
+            using util::placeholders::_1;
+            data_ = boost::shared_array<T>(static_cast<T*>(data),
+                util::bind(&serialize_buffer::owner_deleter, _1,
+                    std::move(owner)));
+            return true;
+        }
+
         template <typename Archive>
         void load(Archive& ar, const unsigned int version)
         {
             using util::placeholders::_1;
             ar >> size_ >> alloc_; //-V128
 
+            if (size_ != 0 && load_in_place(ar, can_adopt_data()))
+                return;
+
             data_.reset(alloc_.allocate(size_),
                 util::bind(&serialize_buffer::deleter<allocator_type>, _1,
                     alloc_, size_));
@@ -7,6 +7,7 @@
 #define HPX_SERIALIZATION_VECTOR_HPP
 
 #include <hpx/config.hpp>
+#include <hpx/runtime/serialization/array.hpp>
 #include <hpx/runtime/serialization/serialize.hpp>
 #include <hpx/traits/is_bitwise_serializable.hpp>
 
@@ -46,14 +47,13 @@ namespace hpx { namespace serialization
             else
             {
                 // bitwise load ...
-                typedef typename std::vector<T, Allocator>::value_type value_type;
                 typedef typename std::vector<T, Allocator>::size_type size_type;
                 size_type size;
                 ar >> size; //-V128
                 if(size == 0) return;
 
                 v.resize(size);
-                load_binary(ar, &v[0], v.size() * sizeof(value_type));
+                ar >> hpx::serialization::make_array(v.data(), v.size());
             }
         }
     }
@@ -115,9 +115,11 @@ namespace hpx { namespace serialization
             }
             else
             {
-                // bitwise save ...
+                // bitwise save, large vectors are eligible for zero-copy
+                // chunking
                 typedef typename std::vector<T, Allocator>::value_type value_type;
-                save_binary(ar, &v[0], v.size() * sizeof(value_type));
+                ar << hpx::serialization::make_array(
+                    const_cast<value_type*>(v.data()), v.size());
             }
         }
     }
@@ -139,7 +139,10 @@ namespace hpx { namespace threads { namespace coroutines
             m_pimpl->bind_args(&arg);
             m_pimpl->bind_result_pointer(&ptr);
 
-            m_pimpl->invoke();
+            if (m_pimpl->is_stackless())
+                m_pimpl->invoke_stackless();
+            else
+                m_pimpl->invoke();
 
             return std::move(*m_pimpl->result());
         }
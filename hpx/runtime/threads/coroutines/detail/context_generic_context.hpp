@@ -199,17 +199,15 @@ namespace hpx { namespace threads { namespace coroutines
                     (stack_size == -1) ?
                     alloc_.minimum_stacksize() : std::size_t(stack_size)
                 )
-              , stack_pointer_(alloc_.allocate(stack_size_))
+              , stack_pointer_(stack_size_ != 0 ?
+                    alloc_.allocate(stack_size_) : nullptr)
             {
-#if BOOST_VERSION < 105600
-                boost::context::fcontext_t* ctx =
-                    boost::context::make_fcontext(stack_pointer_, stack_size_, funp_);
+                // a context without a stack gets one attached only while its
+                // coroutine is running
+                if (stack_pointer_ == nullptr)
+                    return;
 
-                std::swap(*ctx, ctx_);
-#else
-                ctx_ =
-                    boost::context::make_fcontext(stack_pointer_, stack_size_, funp_);
-#endif
+                make_context();
             }
 
             ~fcontext_context_impl()
@@ -220,7 +218,7 @@ namespace hpx { namespace threads { namespace coroutines
                 if (ctx_ && stack_pointer_)
 #endif
                 {
-                    alloc_.deallocate(stack_pointer_, stack_size_);
+                    alloc_.deallocate(stack_pointer_, get_allocated_stacksize());
 #if BOOST_VERSION < 105600
                     ctx_.fc_stack.size = 0;
                     ctx_.fc_stack.sp = 0;
@@ -228,6 +226,51 @@ namespace hpx { namespace threads { namespace coroutines
                 }
             }
 
+            // Stackless contexts (created with a stack size of zero) are
+            // given a stack while their coroutine is running. The spare stack
+            // is used if given, otherwise a new stack is allocated.
+            void attach_stack(void* spare)
+            {
+                HPX_ASSERT(stack_size_ == 0 && stack_pointer_ == nullptr);
+
+                stack_pointer_ = spare ?
+                    spare : alloc_.allocate(get_spare_stack_size());
+                make_context();
+            }
+
+            // Take the stack away from a stackless context, the returned
+            // stack can be attached to any other stackless context.
+            void* detach_stack()
+            {
+                HPX_ASSERT(stack_size_ == 0 && stack_pointer_ != nullptr);
+
+                void* stack = stack_pointer_;
+                stack_pointer_ = nullptr;
+#if BOOST_VERSION < 105600
+                ctx_.fc_stack.size = 0;
+                ctx_.fc_stack.sp = 0;
+#else
+                ctx_ = 0;
+#endif
+#if defined(HPX_GENERIC_CONTEXT_USE_SEGMENTED_STACKS)
+                // segmented stacks are bound to the allocator which created
+                // them, those can't be handed to another context
+                alloc_.deallocate(stack, get_spare_stack_size());
+                stack = nullptr;
+#endif
+                return stack;
+            }
+
+            bool has_stack() const
+            {
+                return stack_pointer_ != nullptr;
+            }
+
+            static void free_spare_stack(void* stack)
+            {
+                stack_allocator().deallocate(stack, get_spare_stack_size());
+            }
+
             // Return the size of the reserved stack address space.
             std::ptrdiff_t get_stacksize() const
             {
@@ -237,7 +280,10 @@ namespace hpx { namespace threads { namespace coroutines
             std::ptrdiff_t get_available_stack_space()
             {
 #if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
-                return stack_size_ -
+                if (stack_pointer_ == nullptr)
+                    return (std::numeric_limits<std::ptrdiff_t>::max)();
+
+                return get_allocated_stacksize() -
                     (reinterpret_cast<std::size_t>(stack_pointer_) - get_stack_ptr());
 #else
                 return (std::numeric_limits<std::ptrdiff_t>::max)();
@@ -285,6 +331,26 @@ namespace hpx { namespace threads { namespace coroutines
 #endif
             }
 
+        private:
+            std::size_t get_allocated_stacksize() const
+            {
+                return stack_size_ != 0 ? stack_size_ : get_spare_stack_size();
+            }
+
+            void make_context()
+            {
+#if BOOST_VERSION < 105600
+                boost::context::fcontext_t* ctx =
+                    boost::context::make_fcontext(stack_pointer_,
+                        get_allocated_stacksize(), funp_);
+
+                std::swap(*ctx, ctx_);
+#else
+                ctx_ = boost::context::make_fcontext(stack_pointer_,
+                    get_allocated_stacksize(), funp_);
+#endif
+            }
+
         private:
             intptr_t cb_;
             void (*funp_)(intptr_t);
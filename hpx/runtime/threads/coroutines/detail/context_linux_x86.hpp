@@ -22,6 +22,7 @@
 
 #include <cstddef>
 #include <cstdlib>
+#include <limits>
 #include <stdexcept>
 #include <sys/param.h>
 
@@ -153,7 +154,8 @@ namespace hpx { namespace threads { namespace coroutines
               : m_stack_size(stack_size == -1
                   ? static_cast<std::ptrdiff_t>(default_stack_size)
                   : stack_size),
-                m_stack(nullptr)
+                m_stack(nullptr),
+                m_cb(&cb)
             {
                 if (0 != (m_stack_size % EXEC_PAGESIZE))
                 {
@@ -163,34 +165,27 @@ namespace hpx { namespace threads { namespace coroutines
                             % m_stack_size % EXEC_PAGESIZE));
                 }
 
-                if (0 >= m_stack_size)
+                if (0 > m_stack_size)
                 {
                     throw std::runtime_error(
                         boost::str(boost::format("stack size of %1% is invalid") %
                             m_stack_size));
                 }
 
-                m_stack = posix::alloc_stack(static_cast<std::size_t>(m_stack_size));
-                HPX_ASSERT(m_stack);
-                posix::watermark_stack(m_stack, static_cast<std::size_t>(m_stack_size));
-
                 typedef void fun(Functor*);
                 fun * funp = trampoline;
+                m_funp = nasty_cast<void*>(funp);
 
-                m_sp = (static_cast<void**>(m_stack)
-                    + static_cast<std::size_t>(m_stack_size) / sizeof(void*))
-                    - context_size;
+                // a context without a stack gets one attached only while its
+                // coroutine is running
+                if (0 == m_stack_size)
+                    return;
 
-                m_sp[backup_cb_idx] = m_sp[cb_idx] = &cb;
-                m_sp[backup_funp_idx] = m_sp[funp_idx] = nasty_cast<void*>(funp);
+                m_stack = posix::alloc_stack(static_cast<std::size_t>(m_stack_size));
+                HPX_ASSERT(m_stack);
+                posix::watermark_stack(m_stack, static_cast<std::size_t>(m_stack_size));
 
-#if defined(HPX_HAVE_VALGRIND) && !defined(NVALGRIND)
-                {
-                    void * eos = static_cast<char*>(m_stack) + m_stack_size;
-                    m_sp[valgrind_id_idx] = reinterpret_cast<void*>(
-                        VALGRIND_STACK_REGISTER(m_stack, eos));
-                }
-#endif
+                init_stack();
             }
 
             ~x86_linux_context_impl()
@@ -201,8 +196,50 @@ namespace hpx { namespace threads { namespace coroutines
                     VALGRIND_STACK_DEREGISTER(
                         reinterpret_cast<std::size_t>(m_sp[valgrind_id_idx]));
 #endif
-                    posix::free_stack(m_stack, static_cast<std::size_t>(m_stack_size));
+                    posix::free_stack(m_stack, get_allocated_stacksize());
+                }
+            }
+
+            // Stackless contexts (created with a stack size of zero) are
+            // given a stack while their coroutine is running. The spare stack
+            // is used if given, otherwise a new stack is allocated.
+            void attach_stack(void* spare)
+            {
+                HPX_ASSERT(0 == m_stack_size && !m_stack);
+
+                m_stack = spare;
+                if (!m_stack)
+                {
+                    m_stack = posix::alloc_stack(get_spare_stack_size());
+                    HPX_ASSERT(m_stack);
+                    posix::watermark_stack(m_stack, get_spare_stack_size());
                 }
+                init_stack();
+            }
+
+            // Take the stack away from a stackless context, the returned
+            // stack can be attached to any other stackless context.
+            void* detach_stack()
+            {
+                HPX_ASSERT(0 == m_stack_size && m_stack);
+
+#if defined(HPX_HAVE_VALGRIND) && !defined(NVALGRIND)
+                VALGRIND_STACK_DEREGISTER(
+                    reinterpret_cast<std::size_t>(m_sp[valgrind_id_idx]));
+#endif
+                void* stack = m_stack;
+                m_stack = nullptr;
+                return stack;
+            }
+
+            bool has_stack() const
+            {
+                return m_stack != nullptr;
+            }
+
+            static void free_spare_stack(void* stack)
+            {
+                posix::free_stack(stack, get_spare_stack_size());
             }
 
             // Return the size of the reserved stack address space.
@@ -215,8 +252,7 @@ namespace hpx { namespace threads { namespace coroutines
             {
                 if (m_stack)
                 {
-                    if (posix::reset_stack(
-                        m_stack, static_cast<std::size_t>(m_stack_size)))
+                    if (posix::reset_stack(m_stack, get_allocated_stacksize()))
                         increment_stack_unbind_count();
                 }
             }
@@ -229,7 +265,7 @@ namespace hpx { namespace threads { namespace coroutines
 
                     // On rebind, we initialize our stack to ensure a virgin stack
                     m_sp = (static_cast<void**>(m_stack)
-                        + static_cast<std::size_t>(m_stack_size) / sizeof(void*))
+                        + get_allocated_stacksize() / sizeof(void*))
                         - context_size;
 
                     m_sp[cb_idx] = m_sp[backup_cb_idx];
@@ -239,6 +275,9 @@ namespace hpx { namespace threads { namespace coroutines
 
             std::ptrdiff_t get_available_stack_space()
             {
+                if (!m_stack)
+                    return (std::numeric_limits<std::ptrdiff_t>::max)();
+
                 return get_stack_ptr() - reinterpret_cast<std::size_t>(m_stack) -
                     context_size;
             }
@@ -292,6 +331,32 @@ namespace hpx { namespace threads { namespace coroutines
             {}
 
         private:
+            std::size_t get_allocated_stacksize() const
+            {
+                return 0 != m_stack_size ?
+                    static_cast<std::size_t>(m_stack_size) :
+                    get_spare_stack_size();
+            }
+
+            void init_stack()
+            {
+                std::size_t const size = get_allocated_stacksize();
+
+                m_sp = (static_cast<void**>(m_stack) + size / sizeof(void*))
+                    - context_size;
+
+                m_sp[backup_cb_idx] = m_sp[cb_idx] = m_cb;
+                m_sp[backup_funp_idx] = m_sp[funp_idx] = m_funp;
+
+#if defined(HPX_HAVE_VALGRIND) && !defined(NVALGRIND)
+                {
+                    void * eos = static_cast<char*>(m_stack) + size;
+                    m_sp[valgrind_id_idx] = reinterpret_cast<void*>(
+                        VALGRIND_STACK_REGISTER(m_stack, eos));
+                }
+#endif
+            }
+
 #if defined(__x86_64__)
             /** structure of context_data:
              * 13: backup address of function to execute
@@ -346,6 +411,8 @@ namespace hpx { namespace threads { namespace coroutines
 
             std::ptrdiff_t m_stack_size;
             void* m_stack;
+            void* m_cb;
+            void* m_funp;
         };
 
         typedef x86_linux_context_impl context_impl;
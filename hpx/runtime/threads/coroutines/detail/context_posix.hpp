@@ -212,11 +212,17 @@ namespace hpx { namespace threads { namespace coroutines
             explicit ucontext_context_impl(Functor & cb, std::ptrdiff_t stack_size)
               : m_stack_size(stack_size == -1 ? (std::ptrdiff_t)default_stack_size
                     : stack_size),
-                m_stack(alloc_stack(m_stack_size)),
+                m_stack(m_stack_size != 0 ? alloc_stack(m_stack_size) : nullptr),
                 cb_(&cb)
             {
-                HPX_ASSERT(m_stack);
                 funp_ = &trampoline<Functor>;
+
+                // a context without a stack gets one attached only while its
+                // coroutine is running
+                if (m_stack_size == 0)
+                    return;
+
+                HPX_ASSERT(m_stack);
                 int error = HPX_COROUTINE_MAKE_CONTEXT(
                     &m_ctx, m_stack, m_stack_size, funp_, cb_, nullptr);
                 HPX_UNUSED(error);
@@ -226,7 +232,43 @@ namespace hpx { namespace threads { namespace coroutines
             ~ucontext_context_impl()
             {
                 if (m_stack)
-                    free_stack(m_stack, m_stack_size);
+                    free_stack(m_stack, get_allocated_stacksize());
+            }
+
+            // Stackless contexts (created with a stack size of zero) are
+            // given a stack while their coroutine is running. The spare stack
+            // is used if given, otherwise a new stack is allocated.
+            void attach_stack(void* spare)
+            {
+                HPX_ASSERT(m_stack_size == 0 && !m_stack);
+
+                m_stack = spare ? spare : alloc_stack(get_spare_stack_size());
+                HPX_ASSERT(m_stack);
+                int error = HPX_COROUTINE_MAKE_CONTEXT(&m_ctx, m_stack,
+                    get_spare_stack_size(), funp_, cb_, nullptr);
+                HPX_UNUSED(error);
+                HPX_ASSERT(error == 0);
+            }
+
+            // Take the stack away from a stackless context, the returned
+            // stack can be attached to any other stackless context.
+            void* detach_stack()
+            {
+                HPX_ASSERT(m_stack_size == 0 && m_stack);
+
+                void* stack = m_stack;
+                m_stack = nullptr;
+                return stack;
+            }
+
+            bool has_stack() const
+            {
+                return m_stack != nullptr;
+            }
+
+            static void free_spare_stack(void* stack)
+            {
+                free_stack(stack, get_spare_stack_size());
             }
 
             // Return the size of the reserved stack address space.
@@ -238,6 +280,9 @@ namespace hpx { namespace threads { namespace coroutines
             std::ptrdiff_t get_available_stack_space()
             {
 #if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
+                if (!m_stack)
+                    return (std::numeric_limits<std::ptrdiff_t>::max)();
+
                 return get_stack_ptr() - reinterpret_cast<std::size_t>(m_stack);
 #else
                 return (std::numeric_limits<std::ptrdiff_t>::max)();
@@ -253,8 +298,7 @@ namespace hpx { namespace threads { namespace coroutines
             {
                 if (m_stack)
                 {
-                    if (posix::reset_stack(
-                        m_stack, static_cast<std::size_t>(m_stack_size)))
+                    if (posix::reset_stack(m_stack, get_allocated_stacksize()))
                         increment_stack_unbind_count();
                 }
             }
@@ -266,8 +310,8 @@ namespace hpx { namespace threads { namespace coroutines
                     // just reset the context stack pointer to its initial value at
                     // the stack start
                     increment_stack_recycle_count();
-                    int error = HPX_COROUTINE_MAKE_CONTEXT(
-                        &m_ctx, m_stack, m_stack_size, funp_, cb_, nullptr);
+                    int error = HPX_COROUTINE_MAKE_CONTEXT(&m_ctx, m_stack,
+                        get_allocated_stacksize(), funp_, cb_, nullptr);
                     HPX_UNUSED(error);
                     HPX_ASSERT(error == 0);
                 }
@@ -309,6 +353,13 @@ namespace hpx { namespace threads { namespace coroutines
             }
 
         private:
+            std::size_t get_allocated_stacksize() const
+            {
+                return m_stack_size != 0 ?
+                    static_cast<std::size_t>(m_stack_size) :
+                    get_spare_stack_size();
+            }
+
             // declare m_stack_size first so we can use it to initialize m_stack
             std::ptrdiff_t m_stack_size;
             void * m_stack;
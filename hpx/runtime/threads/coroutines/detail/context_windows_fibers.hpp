@@ -197,23 +197,15 @@ namespace hpx { namespace threads { namespace coroutines
              */
             template<typename Functor>
             explicit fibers_context_impl(Functor& cb, std::ptrdiff_t stack_size)
-              : fibers_context_impl_base(
-                    CreateFiberEx(stack_size == -1 ? default_stack_size : stack_size,
-                        stack_size == -1 ? default_stack_size : stack_size, 0,
-                        static_cast<LPFIBER_START_ROUTINE>(&trampoline<Functor>),
-                        static_cast<LPVOID>(&cb))
-                    ),
-                stacksize_(stack_size == -1 ? default_stack_size : stack_size)
+              : fibers_context_impl_base(nullptr),
+                stacksize_(stack_size == -1 ? default_stack_size : stack_size),
+                funp_(static_cast<LPFIBER_START_ROUTINE>(&trampoline<Functor>)),
+                cb_(static_cast<LPVOID>(&cb))
             {
-                if (0 == m_ctx)
-                {
-                    boost::throw_exception(boost::system::system_error(
-                        boost::system::error_code(
-                            GetLastError(),
-                            boost::system::system_category()
-                            )
-                        ));
-                }
+                // a context without a stack (fiber) gets one attached only
+                // while its coroutine is running
+                if (0 != stacksize_)
+                    create_fiber(stacksize_);
             }
 
             ~fibers_context_impl()
@@ -222,6 +214,35 @@ namespace hpx { namespace threads { namespace coroutines
                     DeleteFiber(m_ctx);
             }
 
+            // Stackless contexts (created with a stack size of zero) are
+            // given a stack while their coroutine is running. A fiber can't
+            // be moved to another context, thus a new fiber is created each
+            // time.
+            void attach_stack(void* spare)
+            {
+                HPX_ASSERT(0 == stacksize_ && 0 == m_ctx && !spare);
+                create_fiber(
+                    static_cast<std::ptrdiff_t>(get_spare_stack_size()));
+            }
+
+            void* detach_stack()
+            {
+                HPX_ASSERT(0 == stacksize_ && 0 != m_ctx);
+                DeleteFiber(m_ctx);
+                m_ctx = 0;
+                return nullptr;
+            }
+
+            bool has_stack() const
+            {
+                return 0 != m_ctx;
+            }
+
+            static void free_spare_stack(void* stack)
+            {
+                HPX_ASSERT(!stack);
+            }
+
             // Return the size of the reserved stack address space.
             std::ptrdiff_t get_stacksize() const
             {
@@ -261,7 +282,23 @@ namespace hpx { namespace threads { namespace coroutines
             static void thread_shutdown() {}
 
         private:
+            void create_fiber(std::ptrdiff_t stack_size)
+            {
+                m_ctx = CreateFiberEx(stack_size, stack_size, 0, funp_, cb_);
+                if (0 == m_ctx)
+                {
+                    boost::throw_exception(boost::system::system_error(
+                        boost::system::error_code(
+                            GetLastError(),
+                            boost::system::system_category()
+                            )
+                        ));
+                }
+            }
+
             std::ptrdiff_t stacksize_;
+            LPFIBER_START_ROUTINE funp_;
+            LPVOID cb_;
         };
 
         typedef fibers_context_impl context_impl;
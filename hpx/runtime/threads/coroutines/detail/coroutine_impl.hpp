@@ -127,6 +127,20 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
 
         HPX_EXPORT void operator()();
 
+        // Resume a stackless coroutine, it borrows the spare stack of the
+        // calling OS thread (or gets a new one) for as long as it hasn't
+        // exited. Note that this still switches to the borrowed stack, a
+        // stackless thread saves the allocation of its stack only, not the
+        // context switch.
+        HPX_EXPORT void invoke_stackless();
+
+        // A coroutine created with a stack size of zero does not own a stack,
+        // it is given one only while it is running or suspended.
+        bool is_stackless() const
+        {
+            return this->get_stacksize() == 0;
+        }
+
     public:
         result_type * result()
         {
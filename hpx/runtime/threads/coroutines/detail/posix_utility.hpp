@@ -57,6 +57,10 @@
 #include <sys/param.h>
 
 #include <stdexcept>
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+#include <hpx/runtime/threads/coroutines/detail/stack_pool.hpp>
+#endif
 #endif
 
 #if defined(__FreeBSD__)
@@ -80,7 +84,8 @@ namespace posix
 #if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) \
  && _POSIX_MAPPED_FILES > 0
 
-    inline void* alloc_stack(std::size_t size)
+    // map a new stack (including its guard page) into the address space
+    inline void* map_stack(std::size_t size)
     {
         void* real_stack = ::mmap(nullptr,
             size + EXEC_PAGESIZE,
@@ -149,7 +154,8 @@ namespace posix
         return false;
     }
 
-    inline void free_stack(void* stack, std::size_t size)
+    // release a stack created by map_stack() back to the operating system
+    inline void unmap_stack(void* stack, std::size_t size)
     {
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
         if (use_guard_pages) {
@@ -164,6 +170,18 @@ namespace posix
 #endif
     }
 
+    // all stacks are handed out by and returned to the (NUMA-local) stack
+    // pool, which falls back to map_stack()/unmap_stack() as needed
+    inline void* alloc_stack(std::size_t size)
+    {
+        return stack_pool::allocate(size);
+    }
+
+    inline void free_stack(void* stack, std::size_t size)
+    {
+        stack_pool::deallocate(stack, size);
+    }
+
 #else  // non-mmap()
 
     //this should be a fine default.
@@ -0,0 +1,59 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_RUNTIME_THREADS_COROUTINES_DETAIL_STACK_POOL_HPP
+#define HPX_RUNTIME_THREADS_COROUTINES_DETAIL_STACK_POOL_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+
+#include <boost/cstdint.hpp>
+
+#include <cstddef>
+
+namespace hpx { namespace threads { namespace coroutines { namespace detail {
+namespace posix
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The stack pool keeps coroutine stacks which are not in use anymore for
+    // later reuse, which avoids the mmap()/mprotect()/munmap() system calls
+    // otherwise needed for each created and destroyed stack. Stacks are kept
+    // in separate free lists for each NUMA domain and stack size. A stack is
+    // returned to the free list of the NUMA domain of the worker thread
+    // releasing it, as its pages were most likely touched (and therefore
+    // allocated) by that worker thread.
+    //
+    // For each free list, the first 'low watermark' stacks are kept as they
+    // are, the pages of any stack beyond that are handed back to the
+    // operating system using madvise(MADV_FREE) (the mapping and the guard
+    // page are kept, though). Stacks beyond the 'high watermark' are
+    // unmapped. Setting the high watermark to zero disables the pool.
+    struct stack_pool
+    {
+        // Return a stack of the given size (the size does not include the
+        // guard page).
+        HPX_EXPORT static void* allocate(std::size_t size);
+
+        // Give back a stack which was returned from allocate().
+        HPX_EXPORT static void deallocate(void* stack, std::size_t size);
+
+        // Configure the number of stacks kept for each NUMA domain and stack
+        // size.
+        HPX_EXPORT static void set_watermarks(std::size_t low_watermark,
+            std::size_t high_watermark);
+
+        // performance counter data
+        HPX_EXPORT static boost::int64_t get_hit_count(bool reset);
+        HPX_EXPORT static boost::int64_t get_miss_count(bool reset);
+        HPX_EXPORT static boost::int64_t get_pooled_count(bool reset);
+        HPX_EXPORT static boost::int64_t get_resident_size(bool reset);
+    };
+}
+}}}}
+
+#endif
+
+#endif /*HPX_RUNTIME_THREADS_COROUTINES_DETAIL_STACK_POOL_HPP*/
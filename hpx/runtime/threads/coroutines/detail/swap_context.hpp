@@ -29,6 +29,10 @@
 #ifndef HPX_RUNTIME_THREADS_COROUTINES_DETAIL_SWAP_CONTEXT_HPP
 #define HPX_RUNTIME_THREADS_COROUTINES_DETAIL_SWAP_CONTEXT_HPP
 
+#include <hpx/config.hpp>
+
+#include <cstddef>
+
 namespace hpx { namespace threads { namespace coroutines { namespace detail
 {
     class default_hint {};
@@ -38,6 +42,10 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
     /////////////////////////////////////////////////////////////////////////////
     // This is the base class of all context implementations
     struct context_impl_base {};
+
+    // Return the size of the stacks lent to stackless coroutines, this is the
+    // configured size of small stacks (hpx.stacks.small_size).
+    HPX_EXPORT std::size_t get_spare_stack_size();
 }}}}
 
 #endif /*HPX_RUNTIME_THREADS_COROUTINES_DETAIL_SWAP_CONTEXT_HPP*/
@@ -272,6 +272,7 @@ namespace hpx { namespace threads { namespace detail
 
         // spin for some time after queues have become empty
         bool may_exit = false;
+        bool backing_off = false;
         thread_data* thrd = nullptr;
         thread_data* next_thrd = nullptr;
 
@@ -287,6 +288,13 @@ namespace hpx { namespace threads { namespace detail
                 idle_loop_count = 0;
                 ++busy_loop_count;
 
+                // start over with spinning next time this thread goes idle
+                if (backing_off)
+                {
+                    scheduler.SchedulingPolicy::reset_idle_backoff(num_thread);
+                    backing_off = false;
+                }
+
                 may_exit = false;
 
                 // Only pending HPX threads will be executed.
@@ -455,7 +463,18 @@ namespace hpx { namespace threads { namespace detail
                     !callbacks.background_.empty())
                 {
                     if (callbacks.background_())
+                    {
                         idle_loop_count = 0;
+
+                        // start over with spinning, more work (or messages)
+                        // are likely to arrive soon
+                        if (backing_off)
+                        {
+                            scheduler.SchedulingPolicy::reset_idle_backoff(
+                                num_thread);
+                            backing_off = false;
+                        }
+                    }
                 }
 
                 // call back into invoking context
@@ -477,7 +496,18 @@ namespace hpx { namespace threads { namespace detail
                     !callbacks.background_.empty())
                 {
                     if (callbacks.background_())
+                    {
                         idle_loop_count = 0;
+
+                        // start over with spinning, more work (or messages)
+                        // are likely to arrive soon
+                        if (backing_off)
+                        {
+                            scheduler.SchedulingPolicy::reset_idle_backoff(
+                                num_thread);
+                            backing_off = false;
+                        }
+                    }
                 }
             }
             else if ((scheduler.get_scheduler_mode() & policies::fast_idle_mode) ||
@@ -489,7 +519,10 @@ namespace hpx { namespace threads { namespace detail
 
                 // call back into invoking context
                 if (!callbacks.outer_.empty())
+                {
                     callbacks.outer_();
+                    backing_off = true;
+                }
 
                 // break if we were idling after 'may_exit'
                 if (may_exit)
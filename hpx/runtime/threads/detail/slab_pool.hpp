@@ -0,0 +1,231 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_RUNTIME_THREADS_DETAIL_SLAB_POOL_OCT_06_2016_1138AM)
+#define HPX_RUNTIME_THREADS_DETAIL_SLAB_POOL_OCT_06_2016_1138AM
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/threads/detail/thread_num_tss.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/spinlock.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace hpx { namespace threads { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The slab_pool hands out (uninitialized) memory for objects of type T.
+    // The memory is allocated in slabs holding a fixed number of objects and
+    // is never given back before the pool is destroyed.
+    //
+    // A pool is owned by one OS thread (see set_owner()). The owner
+    // allocates from and frees to a private free list without any
+    // synchronization. All other OS threads return objects to a lock-free
+    // 'remote' free list, the owner takes over all of those objects at once
+    // whenever its private list has run empty. Objects requested by other OS
+    // threads are handed out from a shared free list protected by a
+    // spinlock. A pool without an owner behaves as if all accesses were
+    // remote.
+    template <typename T>
+    class slab_pool
+    {
+    private:
+        HPX_NON_COPYABLE(slab_pool);
+
+        struct free_node
+        {
+            free_node* next_;
+        };
+
+        typedef typename std::aligned_storage<
+                (sizeof(T) > sizeof(free_node) ? sizeof(T) : sizeof(free_node)),
+                std::alignment_of<T>::value
+            >::type storage_type;
+
+        typedef hpx::util::spinlock mutex_type;
+
+    public:
+        explicit slab_pool(std::size_t slab_size = 64)
+          : slab_size_(slab_size != 0 ? slab_size : 1),
+            owner_(nullptr),
+            local_(nullptr),
+            remote_(nullptr),
+            shared_(nullptr),
+            capacity_(0),
+            local_allocated_(0), local_freed_(0),
+            shared_allocated_(0), remote_freed_(0)
+        {}
+
+        ~slab_pool()
+        {
+            for (storage_type* slab : slabs_)
+                delete [] slab;
+        }
+
+        // Make the calling OS thread the owner of this pool.
+        void set_owner()
+        {
+            owner_.store(thread_num_tss_.get_os_thread_key(),
+                boost::memory_order_release);
+        }
+
+        // Give up the ownership of this pool, must be called by the owner
+        // before it exits (the address identifying it could be reused by
+        // another OS thread otherwise). Its private free list is handed over
+        // to all other OS threads.
+        void reset_owner()
+        {
+            if (!is_owner())
+                return;
+
+            owner_.store(nullptr, boost::memory_order_release);
+
+            free_node* n = local_;
+            local_ = nullptr;
+            if (n == nullptr)
+                return;
+
+            free_node* last = n;
+            while (last->next_ != nullptr)
+                last = last->next_;
+
+            std::lock_guard<mutex_type> l(mtx_);
+            last->next_ = shared_;
+            shared_ = n;
+        }
+
+        T* allocate()
+        {
+            free_node* n = nullptr;
+            if (is_owner())
+            {
+                n = local_;
+                if (n == nullptr)
+                {
+                    // take over all objects freed by other OS threads
+                    n = remote_.exchange(nullptr, boost::memory_order_acquire);
+                    if (n == nullptr)
+                        n = allocate_slab();
+                }
+                local_ = n->next_;
+                increment(local_allocated_);
+            }
+            else
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                n = shared_;
+                if (n == nullptr)
+                {
+                    n = remote_.exchange(nullptr, boost::memory_order_acquire);
+                    if (n == nullptr)
+                        n = allocate_slab();
+                }
+                shared_ = n->next_;
+                ++shared_allocated_;
+            }
+            return reinterpret_cast<T*>(n);
+        }
+
+        void deallocate(T* p)
+        {
+            HPX_ASSERT(p != nullptr);
+
+            free_node* n = reinterpret_cast<free_node*>(p);
+            if (is_owner())
+            {
+                n->next_ = local_;
+                local_ = n;
+                increment(local_freed_);
+                return;
+            }
+
+            free_node* head = remote_.load(boost::memory_order_relaxed);
+            do {
+                n->next_ = head;
+            } while (!remote_.compare_exchange_weak(head, n,
+                boost::memory_order_release, boost::memory_order_relaxed));
+            ++remote_freed_;
+        }
+
+        // Return the number of objects the slabs of this pool can hold
+        boost::int64_t get_capacity() const
+        {
+            return capacity_.load(boost::memory_order_relaxed);
+        }
+
+        // Return the number of objects currently handed out by this pool
+        boost::int64_t get_count() const
+        {
+            return local_allocated_.load(boost::memory_order_relaxed) +
+                shared_allocated_.load(boost::memory_order_relaxed) -
+                local_freed_.load(boost::memory_order_relaxed) -
+                remote_freed_.load(boost::memory_order_relaxed);
+        }
+
+    private:
+        bool is_owner() const
+        {
+            void const* key = thread_num_tss_.get_os_thread_key();
+            return key != nullptr &&
+                key == owner_.load(boost::memory_order_relaxed);
+        }
+
+        // counters which are modified by the owner only
+        static void increment(boost::atomic<boost::int64_t>& counter)
+        {
+            counter.store(counter.load(boost::memory_order_relaxed) + 1,
+                boost::memory_order_relaxed);
+        }
+
+        // Allocate a new slab, returns the list of its objects.
+        free_node* allocate_slab()
+        {
+            storage_type* slab = new storage_type[slab_size_];
+
+            free_node* head = nullptr;
+            for (std::size_t i = slab_size_; i != 0; --i)
+            {
+                free_node* n = reinterpret_cast<free_node*>(&slab[i - 1]);
+                n->next_ = head;
+                head = n;
+            }
+
+            {
+                std::lock_guard<mutex_type> l(slabs_mtx_);
+                slabs_.push_back(slab);
+            }
+            capacity_ += slab_size_;
+
+            return head;
+        }
+
+        std::size_t const slab_size_;
+        boost::atomic<void const*> owner_;
+
+        free_node* local_;                      // accessed by the owner only
+        boost::atomic<free_node*> remote_;      // objects freed by others
+
+        mutex_type mtx_;
+        free_node* shared_;                     // protected by mtx_
+
+        mutex_type slabs_mtx_;
+        std::vector<storage_type*> slabs_;      // protected by slabs_mtx_
+
+        // performance counter data
+        boost::atomic<boost::int64_t> capacity_;
+        boost::atomic<boost::int64_t> local_allocated_;
+        boost::atomic<boost::int64_t> local_freed_;
+        boost::atomic<boost::int64_t> shared_allocated_;
+        boost::atomic<boost::int64_t> remote_freed_;
+    };
+}}}
+
+#endif
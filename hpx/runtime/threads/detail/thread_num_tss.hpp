@@ -14,7 +14,7 @@
 namespace hpx { namespace threads { namespace detail
 {
     ///////////////////////////////////////////////////////////////////////////
-    class thread_num_tss
+    class HPX_EXPORT thread_num_tss
     {
     public:
         std::size_t set_tss_threadnum(std::size_t num);
@@ -23,6 +23,11 @@ namespace hpx { namespace threads { namespace detail
 
         std::size_t get_worker_thread_num() const;
 
+        // Return a key uniquely identifying the calling OS thread among all
+        // running OS threads, this is nullptr for OS threads which are not
+        // managed by the thread-manager.
+        void const* get_os_thread_key() const;
+
     private:
         // the TSS holds the number associated with a given OS thread
         struct tls_tag {};
@@ -30,7 +35,7 @@ namespace hpx { namespace threads { namespace detail
     };
 
     // the TSS holds the number associated with a given OS thread
-    extern thread_num_tss thread_num_tss_;
+    extern HPX_EXPORT thread_num_tss thread_num_tss_;
 
     ///////////////////////////////////////////////////////////////////////////
     struct reset_tss_helper
@@ -127,6 +127,22 @@ namespace hpx { namespace threads { namespace detail
         std::int64_t get_num_stolen_to_pending(std::size_t num, bool reset);
         std::int64_t get_num_stolen_from_staged(std::size_t num, bool reset);
         std::int64_t get_num_stolen_to_staged(std::size_t num, bool reset);
+        std::int64_t get_num_steals(std::size_t level, std::size_t num,
+            bool reset);
+#endif
+
+        std::int64_t get_thread_data_count(std::size_t num, bool reset);
+        std::int64_t get_thread_data_capacity(std::size_t num, bool reset);
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        std::int64_t get_parked_time(std::size_t num, bool reset);
+        std::int64_t get_wakeup_count(std::size_t num, bool reset);
+        std::int64_t get_average_wakeup_latency(std::size_t num, bool reset);
+#endif
+
+#if defined(HPX_HAVE_DEADLINE_SCHEDULER)
+        std::int64_t get_deadline_thread_count(bool reset);
+        std::int64_t get_missed_deadline_count(bool reset);
 #endif
 
         std::int64_t get_thread_count(thread_state_enum state,
@@ -33,7 +33,9 @@ namespace hpx { namespace threads { namespace executors
             default_executor();
 
             default_executor(thread_priority priority,
-                thread_stacksize stacksize, std::size_t os_thread);
+                thread_stacksize stacksize, std::size_t os_thread,
+                thread_affinity_hint hint = thread_affinity_hint(),
+                std::uint64_t deadline = 0);
 
             // Schedule the specified function for execution in this executor.
             // Depending on the subclass implementation, this may block in some
@@ -78,9 +80,16 @@ namespace hpx { namespace threads { namespace executors
                 threads::detail::executor_parameter p, error_code& ec) const;
 
         private:
+            thread_id_type register_thread(closure_type&& f,
+                util::thread_description const& description,
+                threads::thread_state_enum initial_state, bool run_now,
+                threads::thread_stacksize stacksize, error_code& ec);
+
             thread_stacksize stacksize_;
             thread_priority priority_;
             std::size_t os_thread_;
+            thread_affinity_hint hint_;
+            std::uint64_t deadline_;        // [ns] relative, 0: none
         };
     }
 
@@ -107,6 +116,28 @@ namespace hpx { namespace threads { namespace executors
           : scheduled_executor(new detail::default_executor(
                 thread_priority_default, thread_stacksize_default, os_thread))
         {}
+
+        /// All threads created by this executor carry the given affinity
+        /// hint, they will preferably be run on the same worker thread.
+        default_executor(thread_affinity_hint hint,
+                thread_priority priority = thread_priority_default,
+                thread_stacksize stacksize = thread_stacksize_default)
+          : scheduled_executor(new detail::default_executor(
+                priority, stacksize, std::size_t(-1), hint))
+        {}
+
+        /// All threads created by this executor have to finish within the
+        /// given time (measured from their creation). The deadline is used
+        /// for ordering the threads by the deadline scheduler
+        /// (--hpx:queuing=deadline) and is ignored otherwise.
+        default_executor(util::steady_duration const& deadline,
+                thread_priority priority = thread_priority_default,
+                thread_stacksize stacksize = thread_stacksize_default)
+          : scheduled_executor(new detail::default_executor(
+                priority, stacksize, std::size_t(-1), thread_affinity_hint(),
+                std::uint64_t(std::chrono::duration_cast<
+                    std::chrono::nanoseconds>(deadline.value()).count())))
+        {}
     };
 }}}
 
@@ -0,0 +1,202 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_THREADMANAGER_SCHEDULING_DEADLINE_QUEUE_OCT_04_2016_0214PM)
+#define HPX_THREADMANAGER_SCHEDULING_DEADLINE_QUEUE_OCT_04_2016_0214PM
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DEADLINE_SCHEDULER)
+#include <hpx/runtime/threads/policies/local_priority_queue_scheduler.hpp>
+#include <hpx/runtime/threads/thread_data.hpp>
+#include <hpx/runtime/threads/thread_init_data.hpp>
+#include <hpx/runtime/threads_fwd.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/spinlock.hpp>
+#include <hpx/util/tuple.hpp>
+
+#include <boost/cstdint.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace threads { namespace policies
+{
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // extract the deadline from the items stored in the thread queues
+        inline std::uint64_t get_deadline(thread_data const* thrd)
+        {
+            return thrd->get_deadline();
+        }
+
+        inline std::uint64_t get_deadline(thread_init_data const& data)
+        {
+            return data.deadline;
+        }
+
+        template <typename ...Ts>
+        inline std::uint64_t get_deadline(util::tuple<Ts...> const* t)
+        {
+            return get_deadline(util::get<0>(*t));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Earliest deadline first: the items are kept in a binary heap ordered by
+    // the deadline of the referenced thread, all items without a deadline are
+    // ordered after those and are handed out in FIFO order. Pushing and
+    // popping an item is O(log n) in the number of queued items.
+    template <typename T>
+    struct deadline_queue_backend
+    {
+        typedef hpx::util::spinlock mutex_type;
+        typedef T value_type;
+        typedef T& reference;
+        typedef T const& const_reference;
+        typedef std::uint64_t size_type;
+
+        deadline_queue_backend(
+            size_type initial_size = 0
+          , size_type num_thread = size_type(-1)
+            )
+          : sequence_(0)
+        {
+            heap_.reserve((std::min)(std::size_t(initial_size),
+                std::size_t(initial_heap_size)));
+        }
+
+        bool push(const_reference val, bool /*other_end*/ = false)
+        {
+            std::uint64_t deadline = detail::get_deadline(val);
+            if (deadline == 0)
+                deadline = std::uint64_t(-1);
+
+            std::lock_guard<mutex_type> l(mtx_);
+            heap_.push_back(entry(deadline, sequence_++, val));
+            std::push_heap(heap_.begin(), heap_.end());
+            return true;
+        }
+
+        bool pop(reference val, bool /*steal*/ = true)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (heap_.empty())
+                return false;
+
+            std::pop_heap(heap_.begin(), heap_.end());
+            val = heap_.back().value_;
+            heap_.pop_back();
+            return true;
+        }
+
+        bool empty()
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            return heap_.empty();
+        }
+
+    private:
+        enum { initial_heap_size = 256 };
+
+        struct entry
+        {
+            entry(std::uint64_t deadline, std::uint64_t sequence,
+                    const_reference value)
+              : deadline_(deadline), sequence_(sequence), value_(value)
+            {}
+
+            // std::push_heap builds a max-heap, the entry with the earliest
+            // deadline (and the lowest sequence number) has to come first
+            friend bool operator<(entry const& lhs, entry const& rhs)
+            {
+                if (lhs.deadline_ != rhs.deadline_)
+                    return lhs.deadline_ > rhs.deadline_;
+                return lhs.sequence_ > rhs.sequence_;
+            }
+
+            std::uint64_t deadline_;
+            std::uint64_t sequence_;
+            value_type value_;
+        };
+
+        mutex_type mtx_;
+        std::vector<entry> heap_;
+        std::uint64_t sequence_;      // protected by mtx_
+    };
+
+    struct deadline_fifo
+    {
+        template <typename T>
+        struct apply
+        {
+            typedef deadline_queue_backend<T> type;
+        };
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The deadline_queue_scheduler is a local_priority_queue_scheduler which
+    /// orders the pending threads of each of its queues by their deadline
+    /// (earliest deadline first). Threads without a deadline are run after
+    /// all threads with a deadline. The thread priorities are respected as
+    /// usual: high priority threads are still run before all other threads,
+    /// low priority threads only if no other work is available.
+    template <typename Mutex
+            , typename PendingQueuing
+            , typename StagedQueuing
+            , typename TerminatedQueuing
+             >
+    class deadline_queue_scheduler
+      : public local_priority_queue_scheduler<
+            Mutex, PendingQueuing, StagedQueuing, TerminatedQueuing
+        >
+    {
+    public:
+        typedef local_priority_queue_scheduler<
+            Mutex, PendingQueuing, StagedQueuing, TerminatedQueuing
+        > base_type;
+
+        typedef typename base_type::init_parameter_type
+            init_parameter_type;
+
+        deadline_queue_scheduler(init_parameter_type const& init,
+                bool deferred_initialization = true)
+          : base_type(init, deferred_initialization)
+        {}
+
+        static std::string get_scheduler_name()
+        {
+            return "deadline_queue_scheduler";
+        }
+
+        /// Destroy the passed thread as it has been terminated
+        bool destroy_thread(threads::thread_data* thrd,
+            boost::int64_t& busy_count)
+        {
+            std::uint64_t deadline = thrd->get_deadline();
+            if (deadline != 0)
+            {
+                ++this->deadline_threads_;
+                if (util::high_resolution_clock::now() > deadline)
+                    ++this->missed_deadlines_;
+            }
+            return this->base_type::destroy_thread(thrd, busy_count);
+        }
+    };
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
+
+#endif
@@ -1,4 +1,4 @@
-//  Copyright (c) 2007-2013 Hartmut Kaiser
+//  Copyright (c) 2007-2016 Hartmut Kaiser
 //  Copyright (c)      2011 Thomas Heller
 //
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
@@ -9,18 +9,29 @@
 
 #include <hpx/config.hpp>
 #include <hpx/exception_fwd.hpp>
+#include <hpx/runtime/threads/cpu_mask.hpp>
+#include <hpx/runtime/threads/policies/affinity_data.hpp>
 #include <hpx/runtime/threads/policies/scheduler_base.hpp>
 #include <hpx/runtime/threads/policies/thread_queue.hpp>
 #include <hpx/runtime/threads/thread_data.hpp>
+#include <hpx/runtime/threads/topology.hpp>
 #include <hpx/runtime/threads_fwd.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util/logging.hpp>
 
+#include <boost/algorithm/string/classification.hpp>
+#include <boost/algorithm/string/split.hpp>
 #include <boost/atomic.hpp>
 #include <boost/exception_ptr.hpp>
+#include <boost/lexical_cast.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <map>
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <hpx/config/warnings_prefix.hpp>
@@ -29,7 +40,15 @@ namespace hpx { namespace threads { namespace policies
 {
     ///////////////////////////////////////////////////////////////////////////
     /// The hierarchy_scheduler maintains a tree of queues of work items
-    /// (threads). Every OS threads walks that tree to obtain new work
+    /// (threads). Every OS thread owns one of the leaves of that tree, new
+    /// work is added to the root. Whenever the queue of an OS thread runs
+    /// empty it pulls a batch of work from its parent, which in turn refills
+    /// itself from its own parent, and so on.
+    ///
+    /// By default the shape of the tree follows the machine topology: the
+    /// OS threads running on the same core, the same NUMA domain, and the
+    /// same socket share a parent node. Alternatively, the arity of the tree
+    /// can be given for each of its levels.
     template <typename Mutex
             , typename PendingQueuing
             , typename StagedQueuing
@@ -55,12 +74,14 @@ namespace hpx { namespace threads { namespace policies
 
         // the scheduler type takes two initialization parameters:
         //    the number of queues
-        //    the maxcount per queue
+        //    the arity of the levels of the tree of queues (from the leaves
+        //    to the root, the last value is used for all remaining levels),
+        //    the tree is derived from the machine topology if this is empty
         struct init_parameter
         {
             init_parameter()
               : num_queues_(1),
-                arity_(1),
+                arities_(1, 1),
                 max_queue_thread_count_(max_thread_count),
                 numa_sensitive_(false),
                 description_("hierarchy_scheduler")
@@ -71,7 +92,19 @@ namespace hpx { namespace threads { namespace policies
                     bool numa_sensitive = false,
                     char const* description = "hierarchy_scheduler")
               : num_queues_(num_queues),
-                arity_(arity),
+                arities_(arity != 0 ? 1 : 0, arity),
+                max_queue_thread_count_(max_queue_thread_count),
+                numa_sensitive_(numa_sensitive),
+                description_(description)
+            {}
+
+            init_parameter(std::size_t num_queues,
+                    std::vector<std::size_t> const& arities,
+                    std::size_t max_queue_thread_count = max_thread_count,
+                    bool numa_sensitive = false,
+                    char const* description = "hierarchy_scheduler")
+              : num_queues_(num_queues),
+                arities_(arities),
                 max_queue_thread_count_(max_queue_thread_count),
                 numa_sensitive_(numa_sensitive),
                 description_(description)
@@ -79,14 +112,14 @@ namespace hpx { namespace threads { namespace policies
 
             init_parameter(std::size_t num_queues, char const* description)
               : num_queues_(num_queues),
-                arity_(2),
+                arities_(1, 2),
                 max_queue_thread_count_(max_thread_count),
                 numa_sensitive_(false),
                 description_(description)
             {}
 
             std::size_t num_queues_;
-            std::size_t arity_;
+            std::vector<std::size_t> arities_;
             std::size_t max_queue_thread_count_;
             bool numa_sensitive_;
             char const* description_;
@@ -107,6 +140,9 @@ namespace hpx { namespace threads { namespace policies
             flag_type & operator=(bool b) { v.store(b); return *this;}
             bool operator==(bool b) { return v == b; }
             operator bool() { return v; }
+
+            // returns true if the flag was not set before
+            bool try_set() { return !v.exchange(true); }
         };
 
         typedef std::vector<flag_type > level_flag_type;
@@ -116,70 +152,191 @@ namespace hpx { namespace threads { namespace policies
 
         typedef typename tree_type::size_type size_type;
         typedef typename tree_type::difference_type difference_type;
-        size_type d;
-
-        void init_tree(size_type n, std::size_t max_queue_thread_count)
-        {
-            //std::cout << "level " << tree.size() << " " << n << " ";
-            if(n==0) return;
-            if(n==1)
-            {
-                //std::cout << "added 1 queue\n";
-                tree.push_back(
-                    level_type(
-                        1
-                      , new thread_queue_type(max_queue_thread_count)
-                    )
-                );
-                work_flag_tree.push_back(
-                    level_flag_type(
-                        1
-                    )
-                );
-                work_flag_tree.back()[0] = false;
-                task_flag_tree.push_back(
-                    level_flag_type(
-                        1
-                    )
-                );
-                task_flag_tree.back()[0] = false;
-                return;
+
+        // the index of the parent of each node (for all levels but the root)
+        typedef std::vector<size_type> level_index_type;
+        std::vector<level_index_type> parents;
+
+        // the number of children of each node (for all levels but the leaves)
+        std::vector<level_index_type> num_children;
+
+        // the part of the machine hierarchy represented by each level (see
+        // steal_level), moving work from a node on level i to one of its
+        // children is accounted for as a steal operation of this kind
+        std::vector<std::size_t> level_kinds;
+
+        // Add a new level of queues on top of the current tree. The new level
+        // is given by its queues, 'parents' holds the index of the new parent
+        // for each of the nodes of the current top level.
+        void add_level(level_type const& level,
+            level_index_type const& parents_of_top, std::size_t kind)
+        {
+            HPX_ASSERT(!tree.empty());
+            HPX_ASSERT(parents_of_top.size() == tree.back().size());
+
+            level_index_type children(level.size(), 0);
+            for (size_type i = 0; i != parents_of_top.size(); ++i)
+            {
+                HPX_ASSERT(parents_of_top[i] < level.size());
+                ++children[parents_of_top[i]];
             }
 
+            parents.push_back(parents_of_top);
+            num_children.push_back(children);
+            level_kinds.push_back(kind);
+
+            tree.push_back(level);
+            work_flag_tree.push_back(level_flag_type(level.size()));
+            task_flag_tree.push_back(level_flag_type(level.size()));
+        }
+
+        // The leaves are numbered after the OS thread owning them, the inner
+        // nodes are shared by all OS threads below them.
+        level_type create_level(size_type n, bool leaves = false) const
+        {
             level_type level(n);
+            for (size_type i = 0; i != n; ++i)
+            {
+                level[i] = new thread_queue_type(
+                    leaves ? std::size_t(i) : std::size_t(-1),
+                    max_queue_thread_count_);
+            }
+            return level;
+        }
+
+        std::size_t get_arity(size_type level) const
+        {
+            HPX_ASSERT(!arities_.empty());
+            std::size_t arity = arities_[(std::min)(
+                std::size_t(level), arities_.size() - 1)];
+            return (std::max)(arity, std::size_t(2));
+        }
+
+        void init_tree(size_type n)
+        {
+            HPX_ASSERT(n != 0);
+
+            // the leaves, one for each OS thread
+            tree.push_back(create_level(n, true));
             work_flag_tree.push_back(level_flag_type(n));
             task_flag_tree.push_back(level_flag_type(n));
-            for(size_type i = 0; i < n; ++i)
+            level_kinds.push_back(steal_level_core);
+
+            if (n == 1)
+                return;
+
+            if (arities_.empty())
             {
-                level.at(i) = new thread_queue_type(max_queue_thread_count);
-                work_flag_tree.back()[i] = false;
-                task_flag_tree.back()[i] = false;
+                // the tree is derived from the topology as soon as the
+                // affinity of the OS threads is known (see init()), use a
+                // flat tree for now
+                add_level(create_level(1), level_index_type(n, 0),
+                    steal_level_machine);
+                return;
             }
 
-            tree.push_back(level);
-            //std::cout << "added " << n << " queues\n";
-            if(n<d)
+            while (tree.back().size() > 1)
             {
-                init_tree(1, max_thread_count); //-V106
+                size_type top = tree.back().size();
+                std::size_t arity = get_arity(tree.size() - 1);
+
+                level_index_type parents_of_top(top);
+                for (size_type i = 0; i != top; ++i)
+                    parents_of_top[i] = i / arity;
+
+                size_type num_nodes = (top + arity - 1) / arity;
+                std::size_t kind = num_nodes == 1 ? steal_level_machine :
+                    (std::min)(std::size_t(tree.size() - 1),
+                        std::size_t(steal_level_machine));
+
+                add_level(create_level(num_nodes), parents_of_top, kind);
             }
-            else if(n%d == 0)
+        }
+
+        // Insert the levels representing the cores, the NUMA domains, and
+        // the sockets of the machine between the leaves and the root of the
+        // (flat) tree. Levels which wouldn't group any nodes are skipped.
+        void init_topology_tree()
+        {
+            HPX_ASSERT(tree.size() == 2 && tree.back().size() == 1);
+
+            level_type leaves = tree.front();
+            level_type root = tree.back();
+
+            tree.clear();
+            work_flag_tree.clear();
+            task_flag_tree.clear();
+            parents.clear();
+            num_children.clear();
+            level_kinds.clear();
+
+            tree.push_back(leaves);
+            work_flag_tree.push_back(level_flag_type(leaves.size()));
+            task_flag_tree.push_back(level_flag_type(leaves.size()));
+            level_kinds.push_back(steal_level_core);
+
+            // the PU each of the nodes of the top level is associated with
+            std::vector<std::size_t> pus(leaves.size());
+            for (size_type i = 0; i != leaves.size(); ++i)
+                pus[i] = get_pu_num(i);
+
+            for (std::size_t kind = steal_level_core;
+                 kind != steal_level_machine; ++kind)
             {
-                init_tree(n/d, max_thread_count); //-V106
+                // group the nodes of the top level by the first PU of the
+                // domain they belong to
+                typedef std::map<std::size_t, size_type> group_map;
+                group_map groups;
+                level_index_type parents_of_top(pus.size());
+                std::vector<std::size_t> group_pus;
+                for (size_type i = 0; i != pus.size(); ++i)
+                {
+                    std::size_t key = find_first(
+                        get_domain_mask(kind, pus[i]));
+                    std::pair<typename group_map::iterator, bool> p =
+                        groups.insert(std::make_pair(key, groups.size()));
+                    if (p.second)
+                        group_pus.push_back(pus[i]);
+                    parents_of_top[i] = p.first->second;
+                }
+
+                if (groups.size() == 1 || groups.size() == pus.size())
+                    continue;
+
+                add_level(create_level(groups.size()), parents_of_top, kind);
+                pus.swap(group_pus);
             }
-            else
+
+            add_level(root, level_index_type(pus.size(), 0),
+                steal_level_machine);
+        }
+
+        mask_cref_type get_domain_mask(std::size_t kind, std::size_t pu) const
+        {
+            switch (kind)
             {
-                init_tree(n/d+1, max_thread_count); //-V106
+            case steal_level_core:
+                return topology_.get_core_affinity_mask(pu, numa_sensitive_);
+            case steal_level_numa_node:
+                return topology_.get_numa_node_affinity_mask(
+                    pu, numa_sensitive_);
+            default:
+                break;
             }
+            return topology_.get_socket_affinity_mask(pu, numa_sensitive_);
         }
 
         hierarchy_scheduler(init_parameter_type const& init,
                 bool deferred_initialization = true)
           : scheduler_base(init.num_queues_, init.description_),
-            d(init.arity_),
-            numa_sensitive_(init.numa_sensitive_)
+            arities_(init.arities_),
+            max_queue_thread_count_(init.max_queue_thread_count_),
+            numa_sensitive_(init.numa_sensitive_),
+            transfer_data_(init.num_queues_)
         {
             HPX_ASSERT(init.num_queues_ != 0);
-            init_tree(init.num_queues_, init.max_queue_thread_count_);
+            init_tree(init.num_queues_);
+            root_ = tree.back()[0];
         }
 
         ~hierarchy_scheduler()
@@ -194,6 +351,17 @@ namespace hpx { namespace threads { namespace policies
             }
         }
 
+        // derive the shape of the tree from the topology once the affinity
+        // of the OS threads is known
+        std::size_t init(init_affinity_data const& data,
+            topology const& topology)
+        {
+            std::size_t cores_used = scheduler_base::init(data, topology);
+            if (arities_.empty() && tree.size() == 2)
+                init_topology_tree();
+            return cores_used;
+        }
+
         bool numa_sensitive() const { return numa_sensitive_; }
 
         static std::string get_scheduler_name()
@@ -201,6 +369,39 @@ namespace hpx { namespace threads { namespace policies
             return "hierarchy_scheduler";
         }
 
+        // Parse the description of the shape of the tree of queues: either
+        // 'topology' (leaving the arities empty) or a comma separated list of
+        // the arities of the levels, all of which have to be larger than one.
+        // Returns false if the description is invalid.
+        static bool parse_arities(std::string const& desc,
+            std::vector<std::size_t>& arities)
+        {
+            arities.clear();
+            if (desc == "topology")
+                return true;
+
+            std::vector<std::string> tokens;
+            boost::split(tokens, desc, boost::is_any_of(","));
+            for (std::string const& token : tokens)
+            {
+                std::size_t arity = 0;
+                try {
+                    arity = boost::lexical_cast<std::size_t>(token);
+                }
+                catch (boost::bad_lexical_cast const&) {
+                    arity = 0;
+                }
+
+                if (arity < 2)
+                {
+                    arities.clear();
+                    return false;
+                }
+                arities.push_back(arity);
+            }
+            return true;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // Queries the current length of the queues (work items and new items).
         boost::int64_t get_queue_length(std::size_t num_thread = std::size_t(-1)) const
@@ -233,6 +434,46 @@ namespace hpx { namespace threads { namespace policies
             return result;
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Queries the occupancy of the slab allocators of the queues, the
+        // queues of the inner nodes are accounted for as part of the total
+        // only.
+        boost::int64_t get_thread_data_count(std::size_t num_thread) const
+        {
+            HPX_ASSERT(tree.size());
+            if (std::size_t(-1) != num_thread)
+            {
+                HPX_ASSERT(num_thread < tree[0].size());
+                return tree[0][num_thread]->get_thread_data_count();
+            }
+
+            boost::int64_t result = 0;
+            for (size_type i = 0; i != tree.size(); ++i)
+            {
+                for (size_type j = 0; j != tree[i].size(); ++j)
+                    result += tree[i][j]->get_thread_data_count();
+            }
+            return result;
+        }
+
+        boost::int64_t get_thread_data_capacity(std::size_t num_thread) const
+        {
+            HPX_ASSERT(tree.size());
+            if (std::size_t(-1) != num_thread)
+            {
+                HPX_ASSERT(num_thread < tree[0].size());
+                return tree[0][num_thread]->get_thread_data_capacity();
+            }
+
+            boost::int64_t result = 0;
+            for (size_type i = 0; i != tree.size(); ++i)
+            {
+                for (size_type j = 0; j != tree[i].size(); ++j)
+                    result += tree[i][j]->get_thread_data_capacity();
+            }
+            return result;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // Queries the current thread count of the queues.
         boost::int64_t get_thread_count(thread_state_enum state = unknown,
@@ -532,6 +773,27 @@ namespace hpx { namespace threads { namespace policies
             }
             return num_stolen_threads;
         }
+
+        boost::int64_t get_num_steals(std::size_t level, std::size_t num_thread,
+            bool reset)
+        {
+            HPX_ASSERT(level < num_steal_levels);
+
+            boost::int64_t num_steals = 0;
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t i = 0; i != transfer_data_.size(); ++i)
+                {
+                    num_steals += util::get_and_reset_value(
+                        transfer_data_[i].transfers_[level], reset);
+                }
+                return num_steals;
+            }
+
+            HPX_ASSERT(num_thread < transfer_data_.size());
+            return util::get_and_reset_value(
+                transfer_data_[num_thread].transfers_[level], reset);
+        }
 #endif
 
         ///////////////////////////////////////////////////////////////////////
@@ -572,57 +834,54 @@ namespace hpx { namespace threads { namespace policies
             thread_state_enum initial_state, bool run_now, error_code& ec,
             std::size_t num_thread)
         {
-            HPX_ASSERT(tree.size());
-            HPX_ASSERT(tree.back().size());
-            tree.back()[0]->create_thread(data, id, initial_state,
-                run_now, ec);
+            HPX_ASSERT(root_);
+            root_->create_thread(data, id, initial_state, run_now, ec);
         }
 
-        void transfer_threads(
-            size_type idx
-          , size_type parent
-          , size_type level
-          , std::size_t num_thread
-        )
+        // Move a batch of work items from the parent of the given node to the
+        // node itself, refilling the parent from its own parent first if it
+        // has run empty. Only one OS thread refills a node at any time, all
+        // others return right away instead of waiting for it to finish.
+        void transfer_threads(size_type level, size_type idx,
+            std::size_t num_thread)
         {
-            if(level == tree.size())
-                return;
+            if (level + 1 >= tree.size())
+                return;         // the root has no parent
 
-            HPX_ASSERT(level > 0);
-            HPX_ASSERT(level < tree.size());
-            HPX_ASSERT(idx < tree.at(level).size());
-            HPX_ASSERT(parent < tree.at(level-1).size());
+            HPX_ASSERT(idx < tree[level].size());
 
-            thread_queue_type * tq = tree[level][idx];
-            boost::int64_t num = tq->get_pending_queue_length();
-            thread_queue_type * dest = tree[level-1][parent];
-            if(num == 0)
+            size_type parent = parents[level][idx];
+            thread_queue_type* src = tree[level + 1][parent];
+            if (src->get_pending_queue_length() == 0)
             {
-                if(work_flag_tree[level][idx] == false)
-                {
-                    work_flag_tree[level][idx] = true;
-                    transfer_threads(idx/d, idx, level + 1, num_thread);
-                    work_flag_tree[level][idx] = false;
-                }
-                else
-                {
-                    while(work_flag_tree[level][idx])
-                    {
-#if defined(HPX_WINDOWS)
-                        Sleep(1);
-#elif defined(BOOST_HAS_PTHREADS)
-                        sched_yield();
-#else
-#endif
-                    }
-                }
+                flag_type& f = work_flag_tree[level + 1][parent];
+                if (!f.try_set())
+                    return;     // somebody else is refilling the parent
+
+                transfer_threads(level + 1, parent, num_thread);
+                f = false;
             }
 
-            boost::int64_t count = tq->get_pending_queue_length()/d + 1;
-            dest->move_work_items_from(tq, count);
+            // every child gets its share of the work of the parent
+            boost::int64_t count = src->get_pending_queue_length() /
+                num_children[level + 1][parent] + 1;
+
+            thread_queue_type* dest = tree[level][idx];
+            boost::int64_t moved = 0;
+            threads::thread_data* thrd = nullptr;
+            while (moved != count && src->get_next_thread(thrd, true))
+            {
+                dest->schedule_thread(thrd);
+                ++moved;
+            }
 
-            tq->increment_num_stolen_from_pending(std::size_t(count));
-            dest->increment_num_stolen_to_pending(std::size_t(count));
+            if (moved != 0)
+            {
+                src->increment_num_stolen_from_pending(std::size_t(moved));
+                dest->increment_num_stolen_to_pending(std::size_t(moved));
+                transfer_data_[num_thread].increment_num_transfers(
+                    level_kinds[level + 1]);
+            }
         }
 
         /// Return the next thread to be executed, return false if none is
@@ -633,13 +892,12 @@ namespace hpx { namespace threads { namespace policies
             HPX_ASSERT(tree.size());
             HPX_ASSERT(num_thread < tree[0].size());
 
-            //std::cout << "get next thread " << num_thread << "\n";
             thread_queue_type * tq = tree[0][num_thread];
 
             // check if we need to collect new work from parents
             if (tq->get_pending_queue_length() == 0)
             {
-                transfer_threads(num_thread/d, num_thread, 1, num_thread);
+                transfer_threads(0, num_thread, num_thread);
             }
 
             bool result = tq->get_next_thread(thrd);
@@ -655,18 +913,16 @@ namespace hpx { namespace threads { namespace policies
         void schedule_thread(threads::thread_data* thrd, std::size_t num_thread,
             thread_priority /*priority*/ = thread_priority_normal)
         {
-            HPX_ASSERT(tree.size());
-            HPX_ASSERT(tree.back().size());
-            tree.back()[0]->schedule_thread(thrd);
+            HPX_ASSERT(root_);
+            root_->schedule_thread(thrd);
         }
 
         void schedule_thread_last(threads::thread_data* thrd,
             std::size_t num_thread,
             thread_priority priority = thread_priority_normal)
         {
-            HPX_ASSERT(tree.size());
-            HPX_ASSERT(tree.back().size());
-            tree.back()[0]->schedule_thread(thrd, true);
+            HPX_ASSERT(root_);
+            root_->schedule_thread(thrd, true);
         }
 
         /// Destroy the passed thread as it has been terminated
@@ -683,51 +939,31 @@ namespace hpx { namespace threads { namespace policies
             return false;
         }
 
-        void transfer_tasks(
-            size_type idx
-          , size_type parent
-          , size_type level
-        )
+        // Move a batch of staged tasks from the parent of the given node to
+        // the node itself, same as transfer_threads above.
+        void transfer_tasks(size_type level, size_type idx)
         {
-            HPX_ASSERT(level > 0);
-            if(level == tree.size())
-                return;
-
-            HPX_ASSERT(level > 0);
-            HPX_ASSERT(level < tree.size());
-            HPX_ASSERT(idx < tree.at(level).size());
-            HPX_ASSERT(parent < tree.at(level-1).size());
+            if (level + 1 >= tree.size())
+                return;         // the root has no parent
 
-            thread_queue_type * tq = tree[level][idx];
+            HPX_ASSERT(idx < tree[level].size());
 
-            boost::int64_t num = tq->get_staged_queue_length();
-            if(num == 0)
+            size_type parent = parents[level][idx];
+            thread_queue_type* src = tree[level + 1][parent];
+            if (src->get_staged_queue_length() == 0)
             {
-                if(task_flag_tree[level][idx] == false)
-                {
-                    task_flag_tree[level][idx] = true;
-                    transfer_tasks(idx/d, idx, level + 1);
-                    task_flag_tree[level][idx] = false;
-                }
-                else
-                {
-                    while(task_flag_tree[level][idx])
-                    {
-#if defined(HPX_WINDOWS)
-                    Sleep(1);
-#elif defined(BOOST_HAS_PTHREADS)
-                    sched_yield();
-#else
-#endif
-                    }
-                }
+                flag_type& f = task_flag_tree[level + 1][parent];
+                if (!f.try_set())
+                    return;     // somebody else is refilling the parent
+
+                transfer_tasks(level + 1, parent);
+                f = false;
             }
 
-            thread_queue_type * dest = tree[level-1][parent];
-            dest->move_task_items_from(
-                tq
-              , tq->get_staged_queue_length()/d + 1
-            );
+            thread_queue_type* dest = tree[level][idx];
+            dest->move_task_items_from(src, dest->get_staged_queue_length() +
+                src->get_staged_queue_length() /
+                    num_children[level + 1][parent] + 1);
         }
 
         /// This is a function which gets called periodically by the thread
@@ -744,7 +980,7 @@ namespace hpx { namespace threads { namespace policies
             thread_queue_type * tq = tree[0][num_thread];
             if(tq->get_staged_queue_length() == 0)
             {
-                transfer_tasks(num_thread/d, num_thread, 1);
+                transfer_tasks(0, num_thread);
             }
 
             bool result = tq->wait_or_add_new(running, idle_loop_count, added);
@@ -772,7 +1008,37 @@ namespace hpx { namespace threads { namespace policies
         }
 
     private:
+        std::vector<std::size_t> arities_;
+        std::size_t max_queue_thread_count_;
         bool numa_sensitive_;
+
+        // new work is added to the root of the tree
+        thread_queue_type* root_;
+
+        // per worker thread counters of the batches of work moved down the
+        // tree, for each level of the machine hierarchy
+        struct transfer_data
+        {
+            transfer_data()
+            {
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+                for (std::size_t i = 0; i != num_steal_levels; ++i)
+                    transfers_[i].store(0);
+#endif
+            }
+
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+            void increment_num_transfers(std::size_t level)
+            {
+                ++transfers_[level];
+            }
+
+            boost::atomic<boost::int64_t> transfers_[num_steal_levels];
+#else
+            void increment_num_transfers(std::size_t level) {}
+#endif
+        };
+        std::vector<transfer_data> transfer_data_;
     };
 
 }}}
@@ -780,4 +1046,3 @@ namespace hpx { namespace threads { namespace policies
 #include <hpx/config/warnings_suffix.hpp>
 
 #endif
-
@@ -15,6 +15,7 @@
 #include <hpx/runtime/threads/topology.hpp>
 #include <hpx/runtime/threads_fwd.hpp>
 #include <hpx/throw_exception.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util/logging.hpp>
 
 #include <boost/atomic.hpp>
@@ -52,6 +53,7 @@ namespace hpx { namespace threads { namespace policies
             , typename PendingQueuing
             , typename StagedQueuing
             , typename TerminatedQueuing
+            , typename ThreadMap
              >
     class local_priority_queue_scheduler : public scheduler_base
     {
@@ -68,7 +70,7 @@ namespace hpx { namespace threads { namespace policies
         typedef std::false_type has_periodic_maintenance;
 
         typedef thread_queue<
-            Mutex, PendingQueuing, StagedQueuing, TerminatedQueuing
+            Mutex, PendingQueuing, StagedQueuing, TerminatedQueuing, ThreadMap
         > thread_queue_type;
 
         // the scheduler type takes two initialization parameters:
@@ -121,37 +123,33 @@ namespace hpx { namespace threads { namespace policies
             max_queue_thread_count_(init.max_queue_thread_count_),
             queues_(init.num_queues_),
             high_priority_queues_(init.num_high_priority_queues_),
-            low_priority_queue_(init.max_queue_thread_count_),
+            low_priority_queue_(std::size_t(-1), init.max_queue_thread_count_),
             curr_queue_(0),
             numa_sensitive_(init.numa_sensitive_),
-#if !defined(HPX_NATIVE_MIC)        // we know that the MIC has one NUMA domain only
-            steals_in_numa_domain_(),
-            steals_outside_numa_domain_(),
-#endif
-#if !defined(HPX_HAVE_MORE_THAN_64_THREADS) || defined(HPX_HAVE_MAX_CPU_COUNT)
-            numa_domain_masks_(init.num_queues_),
-            outside_numa_domain_masks_(init.num_queues_)
-#else
-            numa_domain_masks_(init.num_queues_, topology_.get_machine_affinity_mask()),
-            outside_numa_domain_masks_(init.num_queues_,
-                topology_.get_machine_affinity_mask())
-#endif
+            steal_data_(init.num_queues_),
+            affinity_map_(affinity_map_size)
         {
-#if !defined(HPX_NATIVE_MIC)        // we know that the MIC has one NUMA domain only
-            resize(steals_in_numa_domain_, init.num_queues_);
-            resize(steals_outside_numa_domain_, init.num_queues_);
-#endif
+            for (std::size_t i = 0; i != affinity_map_size; ++i)
+                affinity_map_[i].store(std::size_t(-1));
+
+            for (std::size_t i = 0; i != init.num_queues_; ++i)
+            {
+                // seed the victim selection differently for each worker
+                steal_data_[i].seed_ =
+                    static_cast<boost::uint32_t>(i + 1) * 2654435761u;
+            }
             if (!deferred_initialization)
             {
                 BOOST_ASSERT(init.num_queues_ != 0);
                 for (std::size_t i = 0; i < init.num_queues_; ++i)
-                    queues_[i] = new thread_queue_type(init.max_queue_thread_count_);
+                    queues_[i] = new thread_queue_type(
+                        i, init.max_queue_thread_count_);
 
                 BOOST_ASSERT(init.num_high_priority_queues_ != 0);
                 BOOST_ASSERT(init.num_high_priority_queues_ <= init.num_queues_);
                 for (std::size_t i = 0; i < init.num_high_priority_queues_; ++i) {
-                    high_priority_queues_[i] =
-                        new thread_queue_type(init.max_queue_thread_count_);
+                    high_priority_queues_[i] = new thread_queue_type(
+                        i, init.max_queue_thread_count_);
                 }
             }
         }
@@ -414,6 +412,27 @@ namespace hpx { namespace threads { namespace policies
             }
             return num_stolen_threads;
         }
+
+        boost::int64_t get_num_steals(std::size_t level, std::size_t num_thread,
+            bool reset)
+        {
+            HPX_ASSERT(level < num_steal_levels);
+
+            boost::int64_t num_steals = 0;
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t i = 0; i != steal_data_.size(); ++i)
+                {
+                    num_steals += util::get_and_reset_value(
+                        steal_data_[i].steals_[level], reset);
+                }
+                return num_steals;
+            }
+
+            HPX_ASSERT(num_thread < steal_data_.size());
+            return util::get_and_reset_value(
+                steal_data_[num_thread].steals_[level], reset);
+        }
 #endif
 
         ///////////////////////////////////////////////////////////////////////
@@ -465,7 +484,12 @@ namespace hpx { namespace threads { namespace policies
             std::size_t queue_size = queues_.size();
 
             if (std::size_t(-1) == num_thread)
-                num_thread = curr_queue_++ % queue_size;
+            {
+                if (data.affinity_hint != std::size_t(-1))
+                    num_thread = get_affinity_target(data.affinity_hint);
+                else
+                    num_thread = curr_queue_++ % queue_size;
+            }
 
             if (num_thread >= queue_size)
                 num_thread %= queue_size;
@@ -501,6 +525,25 @@ namespace hpx { namespace threads { namespace policies
         /// available
         virtual bool get_next_thread(std::size_t num_thread,
             boost::int64_t& idle_loop_count, threads::thread_data*& thrd)
+        {
+            if (!get_next_thread_impl(num_thread, thrd))
+                return false;
+
+            // remember where the data of this thread is going to be touched
+            std::size_t hint = thrd->get_affinity_hint();
+            if (hint != std::size_t(-1))
+            {
+                boost::atomic<std::size_t>& slot =
+                    affinity_map_[get_affinity_slot(hint)];
+                if (slot.load(boost::memory_order_relaxed) != num_thread)
+                    slot.store(num_thread, boost::memory_order_relaxed);
+            }
+            return true;
+        }
+
+    protected:
+        bool get_next_thread_impl(std::size_t num_thread,
+            threads::thread_data*& thrd)
         {
             std::size_t queues_size = queues_.size();
             std::size_t high_priority_queues = high_priority_queues_.size();
@@ -536,117 +579,54 @@ namespace hpx { namespace threads { namespace policies
                     return false;
             }
 
-            if (numa_sensitive_ != 0)   // limited or no stealing across domains
+            // steal threads from other queues, walking up the machine
+            // hierarchy
+            steal_data& sd = steal_data_[num_thread];
+            for (std::size_t level = 0; level != num_steal_levels; ++level)
             {
-
-                // steal thread from other queue of same NUMA domain
-                std::size_t pu_number = get_pu_num(num_thread);
-#if !defined(HPX_NATIVE_MIC)        // we know that the MIC has one NUMA domain only
-                if (test(steals_in_numa_domain_, pu_number)) //-V600 //-V111
-#endif
+                std::vector<std::size_t> const& victims = sd.victims_[level];
+                std::size_t const num_victims = victims.size();
+                if (num_victims == 0)
+                    continue;
+
+                // threads with an affinity hint are migrated outside of the
+                // NUMA domain only if the victim is overloaded
+                bool const near = level <= steal_level_numa_node;
+
+                // start at a random victim to spread contention
+                std::size_t const start = sd.random(num_victims);
+                for (std::size_t i = 0; i != num_victims; ++i)
                 {
-                    mask_cref_type this_numa_domain =
-                        numa_domain_masks_[num_thread];
-                    for (std::size_t i = 1; i != queues_size; ++i)
-                    {
-                        // FIXME: Do a better job here.
-                        std::size_t const idx = (i + num_thread) % queues_size;
-
-                        HPX_ASSERT(idx != num_thread);
-
-                        std::size_t pu_num = get_pu_num(idx);
-                        if (!test(this_numa_domain, pu_num)) //-V560 //-V600 //-V111
-                            continue;
-
-                        if (idx < high_priority_queues &&
-                            num_thread < high_priority_queues)
-                        {
-                            thread_queue_type* q = high_priority_queues_[idx];
-                            if (q->get_next_thread(thrd))
-                            {
-                                q->increment_num_stolen_from_pending();
-                                this_high_priority_queue->
-                                    increment_num_stolen_to_pending();
-                                return true;
-                            }
-                        }
-
-                        if (queues_[idx]->get_next_thread(thrd))
-                        {
-                            queues_[idx]->increment_num_stolen_from_pending();
-                            this_queue->increment_num_stolen_to_pending();
-                            return true;
-                        }
-                    }
-                }
-
-#if !defined(HPX_NATIVE_MIC)        // we know that the MIC has one NUMA domain only
-                // if nothing found, ask everybody else
-                if (test(steals_outside_numa_domain_, pu_number)) //-V600 //-V111
-                {
-                    mask_cref_type numa_domain =
-                        outside_numa_domain_masks_[num_thread];
-                    for (std::size_t i = 1; i != queues_size; ++i)
-                    {
-                        // FIXME: Do a better job here.
-                        std::size_t const idx = (i + num_thread) % queues_size;
-
-                        HPX_ASSERT(idx != num_thread);
-
-                        std::size_t pu_num = get_pu_num(idx);
-                        if (!test(numa_domain, pu_num)) //-V560 //-V600 //-V111
-                            continue;
-
-                        if (idx < high_priority_queues &&
-                            num_thread < high_priority_queues)
-                        {
-                            thread_queue_type* q = high_priority_queues_[idx];
-                            if (q->get_next_thread(thrd))
-                            {
-                                q->increment_num_stolen_from_pending();
-                                this_high_priority_queue->
-                                    increment_num_stolen_to_pending();
-                                return true;
-                            }
-                        }
-
-                        if (queues_[idx]->get_next_thread(thrd))
-                        {
-                            queues_[idx]->increment_num_stolen_from_pending();
-                            this_queue->increment_num_stolen_to_pending();
-                            return true;
-                        }
-                    }
-                }
-#endif
-            }
-
-            else // not NUMA-sensitive
-            {
-                for (std::size_t i = 1; i != queues_size; ++i)
-                {
-                    // FIXME: Do a better job here.
-                    std::size_t const idx = (i + num_thread) % queues_size;
-
+                    std::size_t const idx = victims[(start + i) % num_victims];
                     HPX_ASSERT(idx != num_thread);
 
                     if (idx < high_priority_queues &&
                         num_thread < high_priority_queues)
                     {
                         thread_queue_type* q = high_priority_queues_[idx];
-                        if (q->get_next_thread(thrd))
+                        std::size_t stolen = this_high_priority_queue->
+                            steal_next_threads(q, thrd);
+                        if (0 != stolen)
                         {
-                            q->increment_num_stolen_from_pending();
+                            q->increment_num_stolen_from_pending(stolen);
                             this_high_priority_queue->
-                                increment_num_stolen_to_pending();
+                                increment_num_stolen_to_pending(stolen);
+                            sd.increment_num_steals(level);
                             return true;
                         }
                     }
 
-                    if (queues_[idx]->get_next_thread(thrd))
+                    bool const steal_affine = near ||
+                        queues_[idx]->get_queue_length() >
+                            affine_steal_threshold;
+
+                    std::size_t stolen = this_queue->steal_next_threads(
+                        queues_[idx], thrd, steal_affine);
+                    if (0 != stolen)
                     {
-                        queues_[idx]->increment_num_stolen_from_pending();
-                        this_queue->increment_num_stolen_to_pending();
+                        queues_[idx]->increment_num_stolen_from_pending(stolen);
+                        this_queue->increment_num_stolen_to_pending(stolen);
+                        sd.increment_num_steals(level);
                         return true;
                     }
                 }
@@ -655,13 +635,20 @@ namespace hpx { namespace threads { namespace policies
             return low_priority_queue_.get_next_thread(thrd);
         }
 
+    public:
         /// Schedule the passed thread
         void schedule_thread(threads::thread_data* thrd,
             std::size_t num_thread,
             thread_priority priority = thread_priority_normal)
         {
             if (std::size_t(-1) == num_thread)
-                num_thread = curr_queue_++ % queues_.size();
+            {
+                std::size_t hint = thrd->get_affinity_hint();
+                if (hint != std::size_t(-1))
+                    num_thread = get_affinity_target(hint);
+                else
+                    num_thread = curr_queue_++ % queues_.size();
+            }
 
             if (priority == thread_priority_critical ||
                 priority == thread_priority_boost)
@@ -683,7 +670,13 @@ namespace hpx { namespace threads { namespace policies
             thread_priority priority = thread_priority_normal)
         {
             if (std::size_t(-1) == num_thread)
-                num_thread = curr_queue_++ % queues_.size();
+            {
+                std::size_t hint = thrd->get_affinity_hint();
+                if (hint != std::size_t(-1))
+                    num_thread = get_affinity_target(hint);
+                else
+                    num_thread = curr_queue_++ % queues_.size();
+            }
 
             if (priority == thread_priority_critical ||
                 priority == thread_priority_boost)
@@ -754,6 +747,20 @@ namespace hpx { namespace threads { namespace policies
             return count;
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Queries the occupancy of the slab allocators of the queues.
+        boost::int64_t get_thread_data_count(std::size_t num_thread) const
+        {
+            return accumulate_queues(num_thread,
+                &thread_queue_type::get_thread_data_count);
+        }
+
+        boost::int64_t get_thread_data_capacity(std::size_t num_thread) const
+        {
+            return accumulate_queues(num_thread,
+                &thread_queue_type::get_thread_data_capacity);
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // Queries the current thread count of the queues.
         boost::int64_t get_thread_count(thread_state_enum state = unknown,
@@ -961,7 +968,6 @@ namespace hpx { namespace threads { namespace policies
         virtual bool wait_or_add_new(std::size_t num_thread, bool running,
             boost::int64_t& idle_loop_count)
         {
-            std::size_t queues_size = queues_.size();
             HPX_ASSERT(num_thread < queues_.size());
 
             std::size_t added = 0;
@@ -984,113 +990,21 @@ namespace hpx { namespace threads { namespace policies
                 running, idle_loop_count, added) && result;
             if (0 != added) return result;
 
-            if (numa_sensitive_ != 0)   // limited or no cross domain stealing
-            {
-                // steal work items: first try to steal from other cores in
-                // the same NUMA node
-
-                std::size_t pu_number = get_pu_num(num_thread);
-#if !defined(HPX_NATIVE_MIC)        // we know that the MIC has one NUMA domain only
-                if (test(steals_in_numa_domain_, pu_number)) //-V600 //-V111
-#endif
-                {
-                    mask_cref_type numa_domain_mask =
-                        numa_domain_masks_[num_thread];
-
-                    for (std::size_t i = 1; i != queues_size; ++i)
-                    {
-                        // FIXME: Do a better job here.
-                        std::size_t const idx = (i + num_thread) % queues_size;
-
-                        HPX_ASSERT(idx != num_thread);
-
-                        std::size_t pu_num = get_pu_num(idx);
-                        if (!test(numa_domain_mask, pu_num)) //-V600
-                            continue;
-
-                        if (idx < high_priority_queues &&
-                            num_thread < high_priority_queues)
-                        {
-                            thread_queue_type* q =  high_priority_queues_[idx];
-                            result = this_high_priority_queue->
-                                wait_or_add_new(running, idle_loop_count,
-                                    added, q)
-                              && result;
-
-                            if (0 != added)
-                            {
-                                q->increment_num_stolen_from_staged(added);
-                                this_high_priority_queue->
-                                    increment_num_stolen_to_staged(added);
-                                return result;
-                            }
-                        }
-
-                        result = this_queue->wait_or_add_new(running,
-                            idle_loop_count, added, queues_[idx]) && result;
-                        if (0 != added)
-                        {
-                            queues_[idx]->increment_num_stolen_from_staged(added);
-                            this_queue->increment_num_stolen_to_staged(added);
-                            return result;
-                        }
-                    }
-                }
-
-#if !defined(HPX_NATIVE_MIC)        // we know that the MIC has one NUMA domain only
-                // if nothing found, ask everybody else
-                if (test(steals_outside_numa_domain_, pu_number)) //-V600 //-V111
-                {
-                    mask_cref_type numa_domain_mask =
-                        outside_numa_domain_masks_[num_thread];
-                    for (std::size_t i = 1; i != queues_size; ++i)
-                    {
-                        // FIXME: Do a better job here.
-                        std::size_t const idx = (i + num_thread) % queues_size;
-
-                        HPX_ASSERT(idx != num_thread);
-
-                        std::size_t pu_num = get_pu_num(idx);
-                        if (!test(numa_domain_mask, pu_num)) //-V600
-                            continue;
-
-                        if (idx < high_priority_queues &&
-                            num_thread < high_priority_queues)
-                        {
-                            thread_queue_type* q =  high_priority_queues_[idx];
-                            result = this_high_priority_queue->
-                                wait_or_add_new(running, idle_loop_count,
-                                    added, q)
-                               && result;
-                            if (0 != added)
-                            {
-                                q->increment_num_stolen_from_staged(added);
-                                this_high_priority_queue->
-                                    increment_num_stolen_to_staged(added);
-                                return result;
-                            }
-                        }
-
-                        result = this_queue->wait_or_add_new(running,
-                            idle_loop_count, added, queues_[idx]) && result;
-                        if (0 != added)
-                        {
-                            queues_[idx]->increment_num_stolen_from_staged(added);
-                            this_queue->increment_num_stolen_to_staged(added);
-                            return result;
-                        }
-                    }
-                }
-#endif
-            }
-
-            else // not NUMA-sensitive
+            // steal work items from other queues, walking up the machine
+            // hierarchy
+            steal_data& sd = steal_data_[num_thread];
+            for (std::size_t level = 0; level != num_steal_levels; ++level)
             {
-                for (std::size_t i = 1; i != queues_size; ++i)
+                std::vector<std::size_t> const& victims = sd.victims_[level];
+                std::size_t const num_victims = victims.size();
+                if (num_victims == 0)
+                    continue;
+
+                // start at a random victim to spread contention
+                std::size_t const start = sd.random(num_victims);
+                for (std::size_t i = 0; i != num_victims; ++i)
                 {
-                    // FIXME: Do a better job here.
-                    std::size_t const idx = (i + num_thread) % queues_size;
-
+                    std::size_t const idx = victims[(start + i) % num_victims];
                     HPX_ASSERT(idx != num_thread);
 
                     if (idx < high_priority_queues &&
@@ -1105,6 +1019,7 @@ namespace hpx { namespace threads { namespace policies
                             q->increment_num_stolen_from_staged(added);
                             this_high_priority_queue->
                                 increment_num_stolen_to_staged(added);
+                            sd.increment_num_steals(level);
                             return result;
                         }
                     }
@@ -1115,6 +1030,7 @@ namespace hpx { namespace threads { namespace policies
                     {
                         queues_[idx]->increment_num_stolen_from_staged(added);
                         this_queue->increment_num_stolen_to_staged(added);
+                        sd.increment_num_steals(level);
                         return result;
                     }
                 }
@@ -1159,13 +1075,13 @@ namespace hpx { namespace threads { namespace policies
         {
             if (nullptr == queues_[num_thread])
             {
-                queues_[num_thread] =
-                    new thread_queue_type(max_queue_thread_count_);
+                queues_[num_thread] = new thread_queue_type(
+                    num_thread, max_queue_thread_count_);
 
                 if (num_thread < high_priority_queues_.size())
                 {
-                    high_priority_queues_[num_thread] =
-                        new thread_queue_type(max_queue_thread_count_);
+                    high_priority_queues_[num_thread] = new thread_queue_type(
+                        num_thread, max_queue_thread_count_);
                 }
             }
 
@@ -1177,39 +1093,54 @@ namespace hpx { namespace threads { namespace policies
 
             queues_[num_thread]->on_start_thread(num_thread);
 
-            // pre-calculate certain constants for the given thread number
+            // pre-calculate the victims for work stealing, grouped by their
+            // distance in the machine hierarchy
             std::size_t num_pu = get_pu_num(num_thread);
-            mask_cref_type machine_mask = topology_.get_machine_affinity_mask();
             mask_cref_type core_mask =
-                topology_.get_thread_affinity_mask(num_pu, numa_sensitive_ != 0);
+                topology_.get_core_affinity_mask(num_pu, numa_sensitive_ != 0);
             mask_cref_type node_mask =
                 topology_.get_numa_node_affinity_mask(num_pu, numa_sensitive_ != 0);
+            mask_cref_type socket_mask =
+                topology_.get_socket_affinity_mask(num_pu, numa_sensitive_ != 0);
 
-            if (any(core_mask) && any(node_mask))
+            bool steal_in_numa_domain = true;
+            bool steal_outside_numa_domain = true;
+            if (numa_sensitive_ != 0)   // limited or no cross domain stealing
             {
-#if !defined(HPX_NATIVE_MIC)        // we know that the MIC has one NUMA domain only
-                set(steals_in_numa_domain_, num_pu);
-#endif
-                numa_domain_masks_[num_thread] = node_mask;
+                mask_cref_type thread_mask =
+                    topology_.get_thread_affinity_mask(num_pu, true);
+                steal_in_numa_domain = any(thread_mask) && any(node_mask);
+
+                // we allow the thread on the boundary of the NUMA domain to
+                // steal from other domains
+                std::size_t first = find_first(node_mask);
+                steal_outside_numa_domain = numa_sensitive_ != 2 &&
+                    (first != std::size_t(-1) ?
+                        test(thread_mask, first) : any(thread_mask));
             }
 
-            // we allow the thread on the boundary of the NUMA domain to steal
-            mask_type first_mask = mask_type();
-            resize(first_mask, mask_size(core_mask));
-
-            std::size_t first = find_first(node_mask);
-            if (first != std::size_t(-1))
-                set(first_mask, first);
-            else
-                first_mask = core_mask;
+            steal_data& sd = steal_data_[num_thread];
+            for (std::size_t level = 0; level != num_steal_levels; ++level)
+                sd.victims_[level].clear();
 
-            if (numa_sensitive_ != 2 && any(first_mask & core_mask))
+            for (std::size_t i = 1; i != queues_.size(); ++i)
             {
-#if !defined(HPX_NATIVE_MIC)        // we know that the MIC has one NUMA domain only
-                set(steals_outside_numa_domain_, num_pu);
-#endif
-                outside_numa_domain_masks_[num_thread] =
-                    not_(node_mask) & machine_mask;
+                std::size_t const idx = (i + num_thread) % queues_.size();
+                std::size_t const pu_num = get_pu_num(idx);
+
+                std::size_t level = steal_level_machine;
+                if (test(core_mask, pu_num)) //-V600
+                    level = steal_level_core;
+                else if (test(node_mask, pu_num)) //-V600
+                    level = steal_level_numa_node;
+                else if (test(socket_mask, pu_num)) //-V600
+                    level = steal_level_socket;
+
+                if (level <= steal_level_numa_node ?
+                        steal_in_numa_domain : steal_outside_numa_domain)
+                {
+                    sd.victims_[level].push_back(idx);
+                }
             }
         }
 
@@ -1239,6 +1170,57 @@ namespace hpx { namespace threads { namespace policies
         }
 
     protected:
+        // sum up the given value for all queues of the given worker thread
+        // (or for all queues)
+        boost::int64_t accumulate_queues(std::size_t num_thread,
+            boost::int64_t (thread_queue_type::*f)() const) const
+        {
+            boost::int64_t count = 0;
+            if (std::size_t(-1) != num_thread)
+            {
+                HPX_ASSERT(num_thread < queues_.size());
+
+                if (num_thread < high_priority_queues_.size())
+                    count = (high_priority_queues_[num_thread]->*f)();
+
+                if (num_thread == queues_.size()-1)
+                    count += (low_priority_queue_.*f)();
+
+                return count + (queues_[num_thread]->*f)();
+            }
+
+            for (std::size_t i = 0; i != high_priority_queues_.size(); ++i)
+                count += (high_priority_queues_[i]->*f)();
+
+            count += (low_priority_queue_.*f)();
+
+            for (std::size_t i = 0; i != queues_.size(); ++i)
+                count += (queues_[i]->*f)();
+
+            return count;
+        }
+
+        // map the key of an affinity hint onto a slot of the affinity map
+        static std::size_t get_affinity_slot(std::size_t key)
+        {
+            // Fibonacci hashing spreads consecutive keys (partition indices)
+            // as well as aligned addresses
+            boost::uint64_t h =
+                boost::uint64_t(key) * boost::uint64_t(11400714819323198485ull);
+            return std::size_t(h >> (64 - affinity_map_bits));
+        }
+
+        // Return the worker thread which most recently ran a thread with the
+        // given affinity hint. Hints not seen before are distributed evenly.
+        std::size_t get_affinity_target(std::size_t key) const
+        {
+            std::size_t num_thread = affinity_map_[get_affinity_slot(key)].
+                load(boost::memory_order_relaxed);
+            if (num_thread >= queues_.size())
+                num_thread = key % queues_.size();
+            return num_thread;
+        }
+
         std::size_t max_queue_thread_count_;
         std::vector<thread_queue_type*> queues_;
         std::vector<thread_queue_type*> high_priority_queues_;
@@ -1246,12 +1228,56 @@ namespace hpx { namespace threads { namespace policies
         boost::atomic<std::size_t> curr_queue_;
         std::size_t numa_sensitive_;
 
-#if !defined(HPX_NATIVE_MIC)        // we know that the MIC has one NUMA domain only
-        mask_type steals_in_numa_domain_;
-        mask_type steals_outside_numa_domain_;
+        // per worker thread data used for work stealing, this is accessed
+        // by the owning worker thread only (except for the counters)
+        struct steal_data
+        {
+            steal_data()
+              : seed_(0)
+            {
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+                for (std::size_t i = 0; i != num_steal_levels; ++i)
+                    steals_[i].store(0);
+#endif
+            }
+
+            // return a pseudo random number in [0, n) (xorshift)
+            std::size_t random(std::size_t n)
+            {
+                boost::uint32_t x = seed_;
+                x ^= x << 13;
+                x ^= x >> 17;
+                x ^= x << 5;
+                seed_ = x;
+                return x % n;
+            }
+
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+            void increment_num_steals(std::size_t level)
+            {
+                ++steals_[level];
+            }
+
+            boost::atomic<boost::int64_t> steals_[num_steal_levels];
+#else
+            void increment_num_steals(std::size_t level) {}
 #endif
-        std::vector<mask_type> numa_domain_masks_;
-        std::vector<mask_type> outside_numa_domain_masks_;
+
+            // the queues to steal from for each level of the machine hierarchy
+            std::vector<std::size_t> victims_[num_steal_levels];
+            boost::uint32_t seed_;
+        };
+        std::vector<steal_data> steal_data_;
+
+        // the worker thread which most recently ran a thread carrying a
+        // given affinity hint (the keys are hashed, collisions are benign)
+        enum { affinity_map_bits = 12 };
+        enum { affinity_map_size = 1 << affinity_map_bits };
+        std::vector<boost::atomic<std::size_t> > affinity_map_;
+
+        // threads with an affinity hint are stolen by remote worker threads
+        // only if the victim's queue is longer than this
+        enum { affine_steal_threshold = 4 };
     };
 }}}
 
@@ -48,6 +48,7 @@ namespace hpx { namespace threads { namespace policies
             , typename PendingQueuing
             , typename StagedQueuing
             , typename TerminatedQueuing
+            , typename ThreadMap
              >
     class local_queue_scheduler : public scheduler_base
     {
@@ -64,7 +65,7 @@ namespace hpx { namespace threads { namespace policies
         typedef std::false_type has_periodic_maintenance;
 
         typedef thread_queue<
-            Mutex, PendingQueuing, StagedQueuing, TerminatedQueuing
+            Mutex, PendingQueuing, StagedQueuing, TerminatedQueuing, ThreadMap
         > thread_queue_type;
 
         // the scheduler type takes two initialization parameters:
@@ -133,7 +134,8 @@ namespace hpx { namespace threads { namespace policies
             {
                 BOOST_ASSERT(init.num_queues_ != 0);
                 for (std::size_t i = 0; i < init.num_queues_; ++i)
-                    queues_[i] = new thread_queue_type(init.max_queue_thread_count_);
+                    queues_[i] = new thread_queue_type(
+                        i, init.max_queue_thread_count_);
             }
         }
 
@@ -479,6 +481,36 @@ namespace hpx { namespace threads { namespace policies
             return count;
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Queries the occupancy of the slab allocators of the queues.
+        boost::int64_t get_thread_data_count(std::size_t num_thread) const
+        {
+            if (std::size_t(-1) != num_thread)
+            {
+                HPX_ASSERT(num_thread < queues_.size());
+                return queues_[num_thread]->get_thread_data_count();
+            }
+
+            boost::int64_t count = 0;
+            for (std::size_t i = 0; i != queues_.size(); ++i)
+                count += queues_[i]->get_thread_data_count();
+            return count;
+        }
+
+        boost::int64_t get_thread_data_capacity(std::size_t num_thread) const
+        {
+            if (std::size_t(-1) != num_thread)
+            {
+                HPX_ASSERT(num_thread < queues_.size());
+                return queues_[num_thread]->get_thread_data_capacity();
+            }
+
+            boost::int64_t count = 0;
+            for (std::size_t i = 0; i != queues_.size(); ++i)
+                count += queues_[i]->get_thread_data_capacity();
+            return count;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // Queries the current thread count of the queues.
         boost::int64_t get_thread_count(thread_state_enum state = unknown,
@@ -721,8 +753,8 @@ namespace hpx { namespace threads { namespace policies
         {
             if (nullptr == queues_[num_thread])
             {
-                queues_[num_thread] =
-                    new thread_queue_type(max_queue_thread_count_);
+                queues_[num_thread] = new thread_queue_type(
+                    num_thread, max_queue_thread_count_);
             }
 
             queues_[num_thread]->on_start_thread(num_thread);
@@ -11,6 +11,10 @@
 #include <hpx/config.hpp>
 
 #include <hpx/util/lockfree/deque.hpp>
+#if defined(HPX_HAVE_CHASE_LEV_SCHEDULER)
+#include <hpx/runtime/threads/detail/thread_num_tss.hpp>
+#include <hpx/util/lockfree/chase_lev_deque.hpp>
+#endif
 #include <boost/cstdint.hpp>
 #include <boost/lockfree/queue.hpp>
 #include <boost/lockfree/stack.hpp>
@@ -183,6 +187,89 @@ struct lockfree_abp_lifo
 
 #endif // HPX_HAVE_ABP_SCHEDULER
 
+///////////////////////////////////////////////////////////////////////////////
+// LIFO for the owning OS thread + FIFO stealing at the opposite end.
+#if defined(HPX_HAVE_CHASE_LEV_SCHEDULER)
+struct lockfree_chase_lev;
+
+// The Chase-Lev deque allows only the OS thread owning the queue to push
+// items, any other OS thread (and items explicitly pushed to the other end)
+// goes through an additional FIFO queue. The owning thread takes items from
+// its deque without any atomic read-modify-write operations.
+template <typename T>
+struct lockfree_chase_lev_backend
+{
+    typedef hpx::util::lockfree::chase_lev_deque<T> container_type;
+    typedef boost::lockfree::queue<T> overflow_container_type;
+    typedef T value_type;
+    typedef T& reference;
+    typedef T const& const_reference;
+    typedef boost::uint64_t size_type;
+
+    lockfree_chase_lev_backend(
+        size_type initial_size = 0
+      , size_type num_thread = size_type(-1)
+        )
+      : queue_(std::size_t(initial_size))
+      , overflow_queue_(std::size_t(initial_size))
+      , num_thread_(std::size_t(num_thread))
+    {}
+
+    bool push(const_reference val, bool other_end = false)
+    {
+        if (!other_end && is_owner())
+        {
+            queue_.push(val);
+            return true;
+        }
+        return overflow_queue_.push(val);
+    }
+
+    bool pop(reference val, bool /*steal*/ = true)
+    {
+        // the owner takes the item pushed most recently, everybody else
+        // steals the oldest one
+        if (is_owner())
+        {
+            if (queue_.pop(val))
+                return true;
+        }
+        else if (queue_.steal(val))
+        {
+            return true;
+        }
+        return overflow_queue_.pop(val);
+    }
+
+    bool empty()
+    {
+        return queue_.empty() && overflow_queue_.empty();
+    }
+
+  private:
+    bool is_owner() const
+    {
+        return num_thread_ != std::size_t(-1) &&
+            threads::detail::thread_num_tss_.get_worker_thread_num() ==
+                num_thread_;
+    }
+
+    container_type queue_;
+    overflow_container_type overflow_queue_;
+    std::size_t num_thread_;
+};
+
+struct lockfree_chase_lev
+{
+    template <typename T>
+    struct apply
+    {
+        typedef lockfree_chase_lev_backend<T> type;
+    };
+};
+
+#endif // HPX_HAVE_CHASE_LEV_SCHEDULER
+
 }}}
 
 #endif // HPX_FB3518C8_4493_450E_A823_A9F8A3185B2D
@@ -19,6 +19,8 @@
 #include <hpx/runtime/threads/topology.hpp>
 #include <hpx/state.hpp>
 #include <hpx/util/assert.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
 #if defined(HPX_HAVE_SCHEDULER_LOCAL_STORAGE)
 #include <hpx/runtime/threads/coroutines/detail/tss.hpp>
 #endif
@@ -28,11 +30,13 @@
 #include <boost/thread/condition_variable.hpp>
 #include <boost/thread/locks.hpp>
 #include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
 
 #include <boost/atomic.hpp>
 
 #include <algorithm>
 #include <chrono>
+#include <cstddef>
 #include <memory>
 #include <mutex>
 #include <utility>
@@ -61,9 +65,49 @@ namespace hpx { namespace threads { namespace policies
             }
             boost::atomic<boost::int32_t>& counter_;
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        // The data needed to put one idle worker thread to sleep and to wake
+        // it up again as soon as new work is scheduled for it.
+        struct idle_backoff_data
+        {
+            idle_backoff_data()
+              : idle_count_(0), may_park_(true), parked_(false),
+                notified_(false), notify_time_(0), parked_time_(0),
+                wakeups_(0), wakeup_latency_(0), wakeup_latency_count_(0)
+            {}
+
+            boost::mutex mtx_;
+            boost::condition_variable cond_;
+
+            std::size_t idle_count_;        // accessed by the worker only
+            boost::atomic<bool> may_park_;
+            boost::atomic<bool> parked_;
+            bool notified_;                 // protected by mtx_
+            boost::uint64_t notify_time_;   // protected by mtx_
+
+            // performance counter data
+            boost::atomic<boost::int64_t> parked_time_;
+            boost::atomic<boost::int64_t> wakeups_;
+            boost::atomic<boost::int64_t> wakeup_latency_;
+            boost::atomic<boost::int64_t> wakeup_latency_count_;
+        };
     }
 #endif
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// The levels of the machine hierarchy used by the schedulers to select
+    /// victims for work stealing, ordered by increasing distance from the
+    /// stealing worker thread
+    enum steal_level
+    {
+        steal_level_core = 0,       ///< PUs of the same core (SMT siblings)
+        steal_level_numa_node = 1,  ///< cores of the same NUMA domain
+        steal_level_socket = 2,     ///< NUMA domains of the same socket
+        steal_level_machine = 3,    ///< everything else (remote sockets)
+        num_steal_levels = 4
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     /// The scheduler_base defines the interface to be implemented by all
     /// scheduler policies
@@ -80,7 +124,13 @@ namespace hpx { namespace threads { namespace policies
           , affinity_data_(num_threads)
           , mode_(mode)
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-          , wait_count_(0)
+          , idle_data_(num_threads)
+          , num_parked_(0)
+          , max_idle_backoff_time_(HPX_IDLE_BACKOFF_TIME_MAX)
+#endif
+#if defined(HPX_HAVE_DEADLINE_SCHEDULER)
+          , deadline_threads_(0)
+          , missed_deadlines_(0)
 #endif
           , states_(num_threads)
           , description_(description)
@@ -116,15 +166,88 @@ namespace hpx { namespace threads { namespace policies
             return affinity_data_.init(data, topology);
         }
 
-        void idle_callback(std::size_t /*num_thread*/)
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        // number of calls to idle_callback yielding the OS thread before the
+        // worker thread is put to sleep
+        enum { idle_backoff_yield_count = 8 };
+#endif
+
+        /// This function gets called by the scheduling loop after the worker
+        /// thread has been spinning on empty queues for a while. The worker
+        /// thread first yields its core a couple of times and is then put to
+        /// sleep (with an exponentially increasing timeout), until it gets
+        /// woken up by do_some_work.
+        void idle_callback(std::size_t num_thread)
         {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-            // Put this thread to sleep for some time, additionally it gets
-            // woken up on new work.
-            boost::chrono::milliseconds period(++wait_count_);
+            if (num_thread >= idle_data_.size())
+                return;
 
-            boost::unique_lock<boost::mutex> l(mtx_);
-            cond_.wait_for(l, period);
+            detail::idle_backoff_data& d = idle_data_[num_thread];
+            if (++d.idle_count_ <= idle_backoff_yield_count ||
+                !d.may_park_.load(boost::memory_order_relaxed))
+            {
+                boost::this_thread::yield();
+                return;
+            }
+
+            std::size_t exponent = (std::min)(
+                d.idle_count_ - idle_backoff_yield_count - 1, std::size_t(20));
+            boost::chrono::milliseconds period((std::min)(
+                std::size_t(1) << exponent, max_idle_backoff_time_.load()));
+
+            boost::unique_lock<boost::mutex> l(d.mtx_);
+
+            d.parked_.store(true);
+            ++num_parked_;
+
+            // Work scheduled before this thread was marked as being parked
+            // did not cause a wakeup, make sure there is none. Never park
+            // threads which are supposed to shut down.
+            if (!d.notified_ && this->get_queue_length(num_thread) == 0 &&
+                states_[num_thread].load() == state_running)
+            {
+                boost::uint64_t start = util::high_resolution_clock::now();
+                d.cond_.wait_for(l, period);
+                d.parked_time_ += util::high_resolution_clock::now() - start;
+            }
+
+            --num_parked_;
+            d.parked_.store(false);
+
+            if (d.notified_)
+            {
+                // we have been woken up because of new work, start over
+                // with spinning
+                d.notified_ = false;
+                d.idle_count_ = 0;
+
+                ++d.wakeups_;
+                ++d.wakeup_latency_count_;
+                d.wakeup_latency_ +=
+                    util::high_resolution_clock::now() - d.notify_time_;
+            }
+#endif
+        }
+
+        /// This function gets called by the scheduling loop whenever the
+        /// worker thread found work after it has been backing off.
+        void reset_idle_backoff(std::size_t num_thread)
+        {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+            if (num_thread < idle_data_.size())
+                idle_data_[num_thread].idle_count_ = 0;
+#endif
+        }
+
+        /// Worker threads which are responsible for polling the parcelports
+        /// (or anything else not generating HPX work when new data arrives)
+        /// must not be put to sleep, they still yield their core when idle.
+        void set_may_park(std::size_t num_thread, bool may_park)
+        {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+            if (num_thread < idle_data_.size())
+                idle_data_[num_thread].may_park_.store(may_park);
 #endif
         }
 
@@ -145,15 +268,100 @@ namespace hpx { namespace threads { namespace policies
         void do_some_work(std::size_t num_thread)
         {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-            wait_count_.store(0, boost::memory_order_release);
+            // The work has been added already, this (sequentially consistent)
+            // load is ordered with the parking thread marking itself as being
+            // parked before it checks its queues for a last time.
+            if (num_parked_.load() == 0)
+                return;
+
+            std::size_t const size = idle_data_.size();
+            std::size_t first = 0;
+            if (num_thread != std::size_t(-1))
+            {
+                // the new work was scheduled on the given worker thread
+                num_thread %= size;
+                if (wake_up(idle_data_[num_thread]))
+                    return;
+
+                // That worker thread is busy, wake up one of the parked
+                // worker threads instead, it will steal the new work. Start
+                // looking at the neighbor of the busy worker thread.
+                first = num_thread + 1;
+            }
 
-            if (num_thread == std::size_t(-1))
-                cond_.notify_all();
-            else
-                cond_.notify_one();
+            // the work can be picked up by any worker thread, wake up one
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                if (wake_up(idle_data_[(first + i) % size]))
+                    break;
+            }
 #endif
         }
 
+        /// Wake up all parked worker threads (for instance on shutdown).
+        void do_some_work_all()
+        {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+            for (detail::idle_backoff_data& d : idle_data_)
+                wake_up(d);
+#endif
+        }
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        void set_max_idle_backoff_time(std::size_t max_idle_backoff_time)
+        {
+            max_idle_backoff_time_.store(
+                (std::max)(max_idle_backoff_time, std::size_t(1)));
+        }
+
+        // performance counter data
+        boost::int64_t get_parked_time(std::size_t num_thread, bool reset)
+        {
+            boost::int64_t result = 0;
+            for (std::size_t i = 0; i != idle_data_.size(); ++i)
+            {
+                if (num_thread == std::size_t(-1) || num_thread == i)
+                {
+                    result += util::get_and_reset_value(
+                        idle_data_[i].parked_time_, reset);
+                }
+            }
+            return result;
+        }
+
+        boost::int64_t get_wakeup_count(std::size_t num_thread, bool reset)
+        {
+            boost::int64_t result = 0;
+            for (std::size_t i = 0; i != idle_data_.size(); ++i)
+            {
+                if (num_thread == std::size_t(-1) || num_thread == i)
+                {
+                    result += util::get_and_reset_value(
+                        idle_data_[i].wakeups_, reset);
+                }
+            }
+            return result;
+        }
+
+        boost::int64_t get_average_wakeup_latency(std::size_t num_thread,
+            bool reset)
+        {
+            boost::int64_t wakeups = 0;
+            boost::int64_t latency = 0;
+            for (std::size_t i = 0; i != idle_data_.size(); ++i)
+            {
+                if (num_thread == std::size_t(-1) || num_thread == i)
+                {
+                    wakeups += util::get_and_reset_value(
+                        idle_data_[i].wakeup_latency_count_, reset);
+                    latency += util::get_and_reset_value(
+                        idle_data_[i].wakeup_latency_, reset);
+                }
+            }
+            return wakeups == 0 ? 0 : latency / wakeups;
+        }
+#endif
+
         // allow to access/manipulate states
         boost::atomic<hpx::state>& get_state(std::size_t num_thread)
         {
@@ -245,8 +453,31 @@ namespace hpx { namespace threads { namespace policies
             bool reset) = 0;
         virtual boost::int64_t get_num_stolen_to_staged(std::size_t num_thread,
             bool reset) = 0;
+
+        // Schedulers which select their victims based on the machine
+        // hierarchy report the number of successful steal operations per
+        // level (see steal_level).
+        virtual boost::int64_t get_num_steals(std::size_t level,
+            std::size_t num_thread, bool reset)
+        {
+            return 0;
+        }
 #endif
 
+        // Schedulers report the number of thread objects allocated from the
+        // slab allocators of the queues of the given worker thread (or of all
+        // queues) and the number of thread objects those can hold.
+        virtual boost::int64_t get_thread_data_count(
+            std::size_t num_thread) const
+        {
+            return 0;
+        }
+        virtual boost::int64_t get_thread_data_capacity(
+            std::size_t num_thread) const
+        {
+            return 0;
+        }
+
         virtual boost::int64_t get_queue_length(
             std::size_t num_thread = std::size_t(-1)) const = 0;
 
@@ -298,16 +529,53 @@ namespace hpx { namespace threads { namespace policies
 
         virtual void reset_thread_distribution() {}
 
+#if defined(HPX_HAVE_DEADLINE_SCHEDULER)
+        // performance counter data for schedulers supporting deadlines
+        boost::int64_t get_deadline_thread_count(bool reset)
+        {
+            return util::get_and_reset_value(deadline_threads_, reset);
+        }
+
+        boost::int64_t get_missed_deadline_count(bool reset)
+        {
+            return util::get_and_reset_value(missed_deadlines_, reset);
+        }
+#endif
+
     protected:
         topology const& topology_;
         detail::affinity_data affinity_data_;
         boost::atomic<scheduler_mode> mode_;
 
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        // Wake up the given worker thread if it is parked, returns whether
+        // the thread was parked.
+        bool wake_up(detail::idle_backoff_data& d)
+        {
+            if (!d.parked_.load())
+                return false;
+
+            boost::unique_lock<boost::mutex> l(d.mtx_);
+            if (!d.notified_)
+            {
+                d.notified_ = true;
+                d.notify_time_ = util::high_resolution_clock::now();
+            }
+            d.cond_.notify_one();
+            return true;
+        }
+
         // support for suspension on idle queues
-        boost::mutex mtx_;
-        boost::condition_variable cond_;
-        boost::atomic<boost::uint32_t> wait_count_;
+        std::vector<detail::idle_backoff_data> idle_data_;
+        boost::atomic<std::size_t> num_parked_;
+        boost::atomic<std::size_t> max_idle_backoff_time_;    // [ms]
+#endif
+
+#if defined(HPX_HAVE_DEADLINE_SCHEDULER)
+        // number of terminated threads which had a deadline, and how many of
+        // those completed after their deadline
+        boost::atomic<boost::int64_t> deadline_threads_;
+        boost::atomic<boost::int64_t> missed_deadlines_;
 #endif
 
         std::vector<boost::atomic<hpx::state> > states_;
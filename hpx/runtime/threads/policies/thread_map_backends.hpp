@@ -0,0 +1,416 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_THREADMANAGER_THREAD_MAP_BACKENDS_SEP_28_2016_0312PM)
+#define HPX_THREADMANAGER_THREAD_MAP_BACKENDS_SEP_28_2016_0312PM
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/threads/thread_data.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/lockfree/stack.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace std
+{
+    template <>
+    struct hash< ::hpx::threads::thread_id_type>
+    {
+        typedef ::hpx::threads::thread_id_type argument_type;
+        typedef std::size_t result_type;
+
+        std::size_t operator()(::hpx::threads::thread_id_type const& v) const
+        {
+            std::hash<std::size_t> hasher_;
+            return hasher_(reinterpret_cast<std::size_t>(v.get()));
+        }
+    };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace threads { namespace policies
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // // Thread map back-end interface:
+    //
+    // The thread map keeps track of all thread objects owned by a
+    // thread_queue (it holds the reference which keeps them alive) and
+    // recycles terminated thread objects for later reuse.
+    //
+    // struct thread_map_backend
+    // {
+    //     typedef ... const_iterator;     // iterates over thread_id_type's
+    //
+    //     // Set to true if the back-end has to be protected by the mutex of
+    //     // the owning thread_queue.
+    //     static bool const requires_lock = ...;
+    //
+    //     // Take a recycled thread object with the given stack size, the
+    //     // returned object is registered as being in use.
+    //     bool get_recycled(std::ptrdiff_t stacksize, thread_id_type& thrd);
+    //
+    //     // Register a newly allocated thread object.
+    //     bool add(thread_id_type const& thrd);
+    //
+    //     // The given (terminated) thread object is kept for later reuse.
+    //     void recycle(thread_data* thrd);
+    //
+    //     // The given (terminated) thread object is not needed anymore.
+    //     void remove(thread_data* thrd);
+    //
+    //     // Called after a sequence of remove() operations, gives the
+    //     // back-end a chance to release the removed thread objects.
+    //     void cleanup();
+    //
+    //     const_iterator begin() const;
+    //     const_iterator end() const;
+    // };
+    //
+    // The functions remove(), cleanup(), and the iteration over the map are
+    // always invoked while holding the mutex of the owning thread_queue.
+
+    namespace detail
+    {
+        // Map the given stack size onto one of the stack size classes, returns
+        // -1 if the stack size doesn't match any of the known classes.
+        inline int get_stacksize_class(std::ptrdiff_t stacksize)
+        {
+            if (stacksize == get_stack_size(thread_stacksize_small))
+                return 0;
+            if (stacksize == get_stack_size(thread_stacksize_medium))
+                return 1;
+            if (stacksize == get_stack_size(thread_stacksize_large))
+                return 2;
+            if (stacksize == get_stack_size(thread_stacksize_huge))
+                return 3;
+            if (stacksize == get_stack_size(thread_stacksize_nostack))
+                return 4;
+
+            switch(stacksize) {
+            case thread_stacksize_small:
+                return 0;
+
+            case thread_stacksize_medium:
+                return 1;
+
+            case thread_stacksize_large:
+                return 2;
+
+            case thread_stacksize_huge:
+                return 3;
+
+            case thread_stacksize_nostack:
+                return 4;
+
+            default:
+                break;
+            }
+            return -1;
+        }
+
+        enum { num_stacksize_classes = 5 };
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // This back-end stores all thread objects in a hash set and keeps the
+    // recycled thread objects in stacks (one for each stack size class). All
+    // operations have to be protected by the queue's mutex.
+    class locking_thread_map
+    {
+    private:
+        typedef std::unordered_set<thread_id_type> thread_map_type;
+
+    public:
+        typedef thread_map_type::const_iterator const_iterator;
+
+        static bool const requires_lock = true;
+
+        bool get_recycled(std::ptrdiff_t stacksize, thread_id_type& thrd)
+        {
+            int size_class = detail::get_stacksize_class(stacksize);
+            HPX_ASSERT(size_class != -1);
+
+            // Check for an unused thread object, the most recently recycled
+            // one is reused first.
+            std::vector<thread_id_type>& heap = thread_heaps_[size_class];
+            if (heap.empty())
+                return false;
+
+            // Take ownership of the thread object.
+            thrd = std::move(heap.back());
+            heap.pop_back();
+
+            return add(thrd);
+        }
+
+        bool add(thread_id_type const& thrd)
+        {
+            // add the new entry to the map of all threads
+            return thread_map_.insert(thrd).second;
+        }
+
+        void recycle(thread_data* thrd)
+        {
+            thread_map_type::iterator it = thread_map_.find(thrd);
+
+            // this thread has to be in this map
+            HPX_ASSERT(it != thread_map_.end());
+
+            int size_class = detail::get_stacksize_class(thrd->get_stack_size());
+            HPX_ASSERT(size_class != -1);
+
+            thread_heaps_[size_class].push_back(*it);
+            thread_map_.erase(it);
+        }
+
+        void remove(thread_data* thrd)
+        {
+            // this thread has to be in this map
+            HPX_ASSERT(thread_map_.find(thrd) != thread_map_.end());
+
+            bool deleted = thread_map_.erase(thrd) != 0;
+            HPX_ASSERT(deleted);
+            HPX_UNUSED(deleted);
+        }
+
+        void cleanup() {}
+
+        const_iterator begin() const { return thread_map_.begin(); }
+        const_iterator end() const { return thread_map_.end(); }
+
+    private:
+        thread_map_type thread_map_;
+        std::vector<thread_id_type> thread_heaps_[detail::num_stacksize_classes];
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // This back-end links all thread objects into an intrusive list which
+    // holds the reference keeping them alive. New thread objects are pushed
+    // onto the front of that list without locking, terminated thread objects
+    // are handed out again from lock-free free lists (one for each stack size
+    // class). Thus creating and recycling threads doesn't need to be protected
+    // by the queue's mutex.
+    //
+    // Removed thread objects are unlinked (and released) in one sweep over
+    // the list from cleanup(), the unlinked list nodes are kept for reuse.
+    //
+    // Iterating over this map will expose recycled thread objects as well,
+    // those are always in 'terminated' state.
+    class lockfree_thread_map
+    {
+    private:
+        struct node
+        {
+            node()
+              : next_(nullptr)
+            {}
+
+            thread_id_type thrd_;
+            node* next_;
+        };
+
+        typedef boost::lockfree::stack<thread_data*> heap_type;
+        typedef boost::lockfree::stack<node*> node_heap_type;
+
+        enum { max_free_nodes = 1024 };
+
+    public:
+        class const_iterator
+          : public std::iterator<std::forward_iterator_tag, thread_id_type>
+        {
+        public:
+            const_iterator(node const* n = nullptr)
+              : node_(n)
+            {}
+
+            thread_id_type const& operator*() const { return node_->thrd_; }
+            thread_id_type const* operator->() const { return &node_->thrd_; }
+
+            const_iterator& operator++()
+            {
+                node_ = node_->next_;
+                return *this;
+            }
+            const_iterator operator++(int)
+            {
+                const_iterator tmp(*this);
+                node_ = node_->next_;
+                return tmp;
+            }
+
+            friend bool operator==(const_iterator const& lhs,
+                const_iterator const& rhs)
+            {
+                return lhs.node_ == rhs.node_;
+            }
+            friend bool operator!=(const_iterator const& lhs,
+                const_iterator const& rhs)
+            {
+                return lhs.node_ != rhs.node_;
+            }
+
+        private:
+            node const* node_;
+        };
+
+        static bool const requires_lock = false;
+
+        lockfree_thread_map()
+          : head_(nullptr), free_nodes_(max_free_nodes)
+        {
+            for (std::size_t i = 0; i != detail::num_stacksize_classes; ++i)
+                thread_heaps_[i] = new heap_type(128);
+        }
+
+        ~lockfree_thread_map()
+        {
+            for (std::size_t i = 0; i != detail::num_stacksize_classes; ++i)
+                delete thread_heaps_[i];
+
+            // this releases the references to all thread objects
+            node* n = head_.load(boost::memory_order_acquire);
+            while (n != nullptr)
+            {
+                node* next = n->next_;
+                delete n;
+                n = next;
+            }
+
+            node* free = nullptr;
+            while (free_nodes_.pop(free))
+                delete free;
+        }
+
+        bool get_recycled(std::ptrdiff_t stacksize, thread_id_type& thrd)
+        {
+            int size_class = detail::get_stacksize_class(stacksize);
+            HPX_ASSERT(size_class != -1);
+
+            thread_data* p = nullptr;
+            if (!thread_heaps_[size_class]->pop(p))
+                return false;
+
+            // the object is still linked into the list, no need to add it
+            thrd = thread_id_type(p);
+            return true;
+        }
+
+        bool add(thread_id_type const& thrd)
+        {
+            node* n = nullptr;
+            if (!free_nodes_.pop(n))
+                n = new node;
+            n->thrd_ = thrd;
+
+            // The head is never dereferenced here, thus it is safe for
+            // cleanup() to concurrently unlink (and even delete) it.
+            node* head = head_.load(boost::memory_order_relaxed);
+            do {
+                n->next_ = head;
+            } while (!head_.compare_exchange_weak(head, n,
+                boost::memory_order_release, boost::memory_order_relaxed));
+            return true;
+        }
+
+        void recycle(thread_data* thrd)
+        {
+            int size_class = detail::get_stacksize_class(thrd->get_stack_size());
+            HPX_ASSERT(size_class != -1);
+
+            thread_heaps_[size_class]->push(thrd);
+        }
+
+        void remove(thread_data* thrd)
+        {
+            // the thread object is unlinked by the next call to cleanup()
+            removed_.push_back(thrd);
+        }
+
+        void cleanup()
+        {
+            if (removed_.empty())
+                return;
+
+            std::sort(removed_.begin(), removed_.end());
+
+            node* prev = nullptr;
+            node* n = head_.load(boost::memory_order_acquire);
+            while (n != nullptr)
+            {
+                node* next = n->next_;
+                if (std::binary_search(
+                        removed_.begin(), removed_.end(), n->thrd_.get()))
+                {
+                    unlink(prev, n);
+                    release(n);
+                }
+                else
+                {
+                    prev = n;
+                }
+                n = next;
+            }
+            removed_.clear();
+        }
+
+        const_iterator begin() const
+        {
+            return const_iterator(head_.load(boost::memory_order_acquire));
+        }
+        const_iterator end() const
+        {
+            return const_iterator();
+        }
+
+    private:
+        // Unlink the given node from the list, prev is the node in front of
+        // it (nullptr if n was the head of the list when it was visited).
+        void unlink(node*& prev, node* n)
+        {
+            if (prev == nullptr)
+            {
+                node* expected = n;
+                if (head_.compare_exchange_strong(expected, n->next_,
+                        boost::memory_order_acq_rel))
+                {
+                    return;
+                }
+
+                // new nodes have been pushed in front of this one in the
+                // meantime
+                prev = expected;
+                while (prev->next_ != n)
+                    prev = prev->next_;
+            }
+            prev->next_ = n->next_;
+        }
+
+        // Drop the reference to the thread object and keep the node for
+        // later reuse.
+        void release(node* n)
+        {
+            n->thrd_.reset();
+            n->next_ = nullptr;
+            if (!free_nodes_.bounded_push(n))
+                delete n;
+        }
+
+    private:
+        boost::atomic<node*> head_;
+        heap_type* thread_heaps_[detail::num_stacksize_classes];
+        node_heap_type free_nodes_;
+        std::vector<thread_data*> removed_;
+    };
+}}}
+
+#endif
@@ -11,6 +11,7 @@
 #include <hpx/error_code.hpp>
 #include <hpx/runtime/threads/policies/lockfree_queue_backends.hpp>
 #include <hpx/runtime/threads/policies/queue_helpers.hpp>
+#include <hpx/runtime/threads/policies/thread_map_backends.hpp>
 #include <hpx/runtime/threads/thread_data.hpp>
 #include <hpx/throw_exception.hpp>
 #include <hpx/util/assert.hpp>
@@ -30,30 +31,11 @@
 
 #include <cstddef>
 #include <functional>
-#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
-#include <unordered_set>
 #include <utility>
 
-///////////////////////////////////////////////////////////////////////////////
-namespace std
-{
-    template <>
-    struct hash< ::hpx::threads::thread_id_type>
-    {
-        typedef ::hpx::threads::thread_id_type argument_type;
-        typedef std::size_t result_type;
-
-        std::size_t operator()(::hpx::threads::thread_id_type const& v) const
-        {
-            std::hash<std::size_t> hasher_;
-            return hasher_(reinterpret_cast<std::size_t>(v.get()));
-        }
-    };
-}
-
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace threads { namespace policies
 {
@@ -104,10 +86,16 @@ namespace hpx { namespace threads { namespace policies
     //         typedef ... type;
     //     };
     // };
+    //
+    // The ThreadMap parameter selects the back-end used to keep track of all
+    // thread objects owned by the queue (see thread_map_backends.hpp). The
+    // lockfree_thread_map back-end allows to create, terminate and recycle
+    // threads without acquiring the queue's mutex.
     template <typename Mutex = boost::mutex,
         typename PendingQueuing = lockfree_lifo,
         typename StagedQueuing = lockfree_lifo,
-        typename TerminatedQueuing = lockfree_fifo>
+        typename TerminatedQueuing = lockfree_fifo,
+        typename ThreadMap = locking_thread_map>
     class thread_queue
     {
     private:
@@ -123,7 +111,7 @@ namespace hpx { namespace threads { namespace policies
         };
 
         // this is the type of a map holding all threads (except depleted ones)
-        typedef std::unordered_set<thread_id_type> thread_map_type;
+        typedef ThreadMap thread_map_type;
 
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
         typedef
@@ -153,72 +141,40 @@ namespace hpx { namespace threads { namespace policies
         void create_thread_object(threads::thread_id_type& thrd,
             threads::thread_init_data& data, thread_state_enum state, Lock& lk)
         {
-            HPX_ASSERT(lk.owns_lock());
-            HPX_ASSERT(data.stacksize != 0);
-
-            std::ptrdiff_t stacksize = data.stacksize;
-
-            std::list<thread_id_type>* heap = nullptr;
-
-            if (stacksize == get_stack_size(thread_stacksize_small))
-            {
-                heap = &thread_heap_small_;
-            }
-            else if (stacksize == get_stack_size(thread_stacksize_medium))
-            {
-                heap = &thread_heap_medium_;
-            }
-            else if (stacksize == get_stack_size(thread_stacksize_large))
-            {
-                heap = &thread_heap_large_;
-            }
-            else if (stacksize == get_stack_size(thread_stacksize_huge))
-            {
-                heap = &thread_heap_huge_;
-            }
-            else {
-                switch(stacksize) {
-                case thread_stacksize_small:
-                    heap = &thread_heap_small_;
-                    break;
-
-                case thread_stacksize_medium:
-                    heap = &thread_heap_medium_;
-                    break;
-
-                case thread_stacksize_large:
-                    heap = &thread_heap_large_;
-                    break;
-
-                case thread_stacksize_huge:
-                    heap = &thread_heap_huge_;
-                    break;
-
-                default:
-                    break;
-                }
-            }
-            HPX_ASSERT(heap);
+            HPX_ASSERT(!thread_map_type::requires_lock || lk.owns_lock());
+            HPX_ASSERT(data.stacksize >= 0);
 
             // Check for an unused thread object.
-            if (!heap->empty())
+            if (thread_map_.get_recycled(data.stacksize, thrd))
             {
-                // Take ownership of the thread object and rebind it.
-                thrd = heap->front();
-                heap->pop_front();
+                // Rebind the thread object we took ownership of.
                 thrd->rebind(data,
                     state == pending_do_not_schedule ? pending : state);
+                ++thread_map_count_;
+                return;
             }
 
-            else
+            // Allocate a new thread object.
+            if (lk.owns_lock())
             {
                 hpx::util::unlock_guard<Lock> ull(lk);
-
-                // Allocate a new thread object.
                 thrd = threads::thread_data::create(
                     data, memory_pool_,
                     state == pending_do_not_schedule ? pending : state);
             }
+            else
+            {
+                thrd = threads::thread_data::create(
+                    data, memory_pool_,
+                    state == pending_do_not_schedule ? pending : state);
+            }
+
+            // add the new entry to the map of all threads
+            if (HPX_UNLIKELY(!thread_map_.add(thrd))) {
+                thrd.reset();
+                return;
+            }
+            ++thread_map_count_;
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -256,17 +212,12 @@ namespace hpx { namespace threads { namespace policies
 
                 delete task;
 
-                // add the new entry to the map of all threads
-                std::pair<thread_map_type::iterator, bool> p =
-                    thread_map_.insert(thrd);
-
-                if (HPX_UNLIKELY(!p.second)) {
+                if (HPX_UNLIKELY(!thrd)) {
                     HPX_THROW_EXCEPTION(hpx::out_of_memory,
                         "threadmanager::add_new",
                         "Couldn't add new thread to the thread map");
                     return 0;
                 }
-                ++thread_map_count_;
 
                 // only insert the thread into the work-items queue if it is in
                 // pending state
@@ -277,8 +228,6 @@ namespace hpx { namespace threads { namespace policies
                     schedule_thread(thrd.get());
                 }
 
-                // this thread has to be in the map now
-                HPX_ASSERT(thread_map_.find(thrd.get()) != thread_map_.end());
                 HPX_ASSERT(thrd->get_pool() == &memory_pool_);
             }
 
@@ -307,7 +256,8 @@ namespace hpx { namespace threads { namespace policies
             // if the map doesn't hold max_count threads yet add some
             // FIXME: why do we have this test? can max_count_ ever be zero?
             if (HPX_LIKELY(max_count_)) {
-                std::size_t count = thread_map_.size();
+                std::size_t count = static_cast<std::size_t>(
+                    thread_map_count_.load(boost::memory_order_relaxed));
                 if (max_count_ >= count + min_add_new_count) { //-V104
                     HPX_ASSERT(max_count_ - count <
                         static_cast<std::size_t>((std::numeric_limits
@@ -345,7 +295,8 @@ namespace hpx { namespace threads { namespace policies
             // if we are desperate (no work in the queues), add some even if the
             // map holds more than max_count
             if (HPX_LIKELY(max_count_)) {
-                std::size_t count = thread_map_.size();
+                std::size_t count = static_cast<std::size_t>(
+                    thread_map_count_.load(boost::memory_order_relaxed));
                 if (max_count_ >= count + min_add_new_count) { //-V104
                     HPX_ASSERT(max_count_ - count <
                         static_cast<std::size_t>((std::numeric_limits
@@ -353,8 +304,18 @@ namespace hpx { namespace threads { namespace policies
                     add_count = static_cast<boost::int64_t>(max_count_ - count);
                     if (add_count < min_add_new_count)
                         add_count = min_add_new_count;
-                    if (add_count > max_add_new_count)
+
+                    if (addfrom != this) {
+                        // we're stealing, take up to half of the victim's
+                        // staged tasks in one go
+                        boost::int64_t half = (addfrom->new_tasks_count_.load(
+                            boost::memory_order_relaxed) + 1) / 2;
+                        if (add_count > half)
+                            add_count = half;
+                    }
+                    else if (add_count > max_add_new_count) {
                         add_count = max_add_new_count;
+                    }
                 }
                 else if (work_items_.empty()) {
                     add_count = min_add_new_count;    // add this number of threads
@@ -370,50 +331,18 @@ namespace hpx { namespace threads { namespace policies
             return addednew != 0;
         }
 
-        void recycle_thread(thread_id_type thrd)
+        static thread_data* get_thread_data(thread_description* trd)
         {
-            std::ptrdiff_t stacksize = thrd->get_stack_size();
-
-            if (stacksize == get_stack_size(thread_stacksize_small))
-            {
-                thread_heap_small_.push_front(thrd);
-            }
-            else if (stacksize == get_stack_size(thread_stacksize_medium))
-            {
-                thread_heap_medium_.push_front(thrd);
-            }
-            else if (stacksize == get_stack_size(thread_stacksize_large))
-            {
-                thread_heap_large_.push_front(thrd);
-            }
-            else if (stacksize == get_stack_size(thread_stacksize_huge))
-            {
-                thread_heap_huge_.push_front(thrd);
-            }
-            else
-            {
-                switch(stacksize) {
-                case thread_stacksize_small:
-                    thread_heap_small_.push_front(thrd);
-                    break;
-
-                case thread_stacksize_medium:
-                    thread_heap_medium_.push_front(thrd);
-                    break;
-
-                case thread_stacksize_large:
-                    thread_heap_large_.push_front(thrd);
-                    break;
-
-                case thread_stacksize_huge:
-                    thread_heap_huge_.push_front(thrd);
-                    break;
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+            return util::get<0>(*trd);
+#else
+            return trd;
+#endif
+        }
 
-                default:
-                    HPX_ASSERT(false);
-                    break;
-                }
-            }
+        static bool has_affinity_hint(thread_data* thrd)
+        {
+            return thrd->get_affinity_hint() != std::size_t(-1);
         }
 
     public:
@@ -428,7 +357,7 @@ namespace hpx { namespace threads { namespace policies
             util::tick_counter tc(cleanup_terminated_time_);
 #endif
 
-            if (terminated_items_count_ == 0 && thread_map_.empty())
+            if (terminated_items_count_ == 0 && thread_map_count_ == 0)
                 return true;
 
             if (delete_all) {
@@ -438,16 +367,11 @@ namespace hpx { namespace threads { namespace policies
                 {
                     --terminated_items_count_;
 
-                    // this thread has to be in this map
-                    HPX_ASSERT(thread_map_.find(todelete) != thread_map_.end());
-
-                    bool deleted = thread_map_.erase(todelete) != 0;
-                    HPX_ASSERT(deleted);
-                    if (deleted) {
-                        --thread_map_count_;
-                        HPX_ASSERT(thread_map_count_ >= 0);
-                    }
+                    thread_map_.remove(todelete);
+                    --thread_map_count_;
+                    HPX_ASSERT(thread_map_count_ >= 0);
                 }
+                thread_map_.cleanup();
             }
             else {
                 // delete only this many threads
@@ -461,14 +385,7 @@ namespace hpx { namespace threads { namespace policies
                 {
                     --terminated_items_count_;
 
-                    thread_map_type::iterator it = thread_map_.find(todelete);
-
-                    // this thread has to be in this map
-                    HPX_ASSERT(it != thread_map_.end());
-
-                    recycle_thread(*it);
-
-                    thread_map_.erase(it);
+                    thread_map_.recycle(todelete);
                     --thread_map_count_;
                     HPX_ASSERT(thread_map_count_ >= 0);
 
@@ -481,7 +398,7 @@ namespace hpx { namespace threads { namespace policies
         bool cleanup_terminated_locked(bool delete_all = false)
         {
             return cleanup_terminated_locked_helper(delete_all) &&
-                thread_map_.empty();
+                thread_map_count_ == 0;
         }
 
     public:
@@ -495,7 +412,9 @@ namespace hpx { namespace threads { namespace policies
                 bool thread_map_is_empty = false;
                 while (true)
                 {
-                    std::lock_guard<mutex_type> lk(mtx_);
+                    std::unique_lock<mutex_type> lk(mtx_, std::defer_lock);
+                    if (thread_map_type::requires_lock)
+                        lk.lock();
                     if (cleanup_terminated_locked_helper(false))
                     {
                         thread_map_is_empty =
@@ -506,7 +425,9 @@ namespace hpx { namespace threads { namespace policies
                 return thread_map_is_empty;
             }
 
-            std::lock_guard<mutex_type> lk(mtx_);
+            std::unique_lock<mutex_type> lk(mtx_, std::defer_lock);
+            if (thread_map_type::requires_lock)
+                lk.lock();
             return cleanup_terminated_locked_helper(false) &&
                 (thread_map_count_ == 0) && (new_tasks_count_ == 0);
         }
@@ -523,6 +444,7 @@ namespace hpx { namespace threads { namespace policies
           : thread_map_count_(0),
             work_items_(128, queue_num),
             work_items_count_(0),
+            affine_work_items_count_(0),
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
             work_items_wait_(0),
             work_items_wait_count_(0),
@@ -539,10 +461,7 @@ namespace hpx { namespace threads { namespace policies
             new_tasks_wait_count_(0),
 #endif
             memory_pool_(64),
-            thread_heap_small_(),
-            thread_heap_medium_(),
-            thread_heap_large_(),
-            thread_heap_huge_(),
+            thread_map_(),
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
             add_new_time_(0),
             cleanup_terminated_time_(0),
@@ -563,6 +482,18 @@ namespace hpx { namespace threads { namespace policies
             max_count_ = (0 == max_count) ? max_thread_count : max_count; //-V105
         }
 
+        // Return the number of thread objects currently allocated from the
+        // slab allocator of this queue and the number of thread objects its
+        // slabs can hold.
+        boost::int64_t get_thread_data_count() const
+        {
+            return memory_pool_.get_count();
+        }
+        boost::int64_t get_thread_data_capacity() const
+        {
+            return memory_pool_.get_capacity();
+        }
+
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
         boost::uint64_t get_creation_time(bool reset)
         {
@@ -699,24 +630,19 @@ namespace hpx { namespace threads { namespace policies
                 // created, as it might have that the current HPX thread gets
                 // suspended.
                 {
-                    std::unique_lock<mutex_type> lk(mtx_);
+                    std::unique_lock<mutex_type> lk(mtx_, std::defer_lock);
+                    if (thread_map_type::requires_lock)
+                        lk.lock();
 
                     create_thread_object(thrd, data, initial_state, lk);
 
-                    // add a new entry in the map for this thread
-                    std::pair<thread_map_type::iterator, bool> p =
-                        thread_map_.insert(thrd);
-
-                    if (HPX_UNLIKELY(!p.second)) {
+                    if (HPX_UNLIKELY(!thrd)) {
                         HPX_THROWS_IF(ec, hpx::out_of_memory,
                             "threadmanager::register_thread",
                             "Couldn't add new thread to the map of threads");
                         return;
                     }
-                    ++thread_map_count_;
 
-                    // this thread has to be in the map now
-                    HPX_ASSERT(thread_map_.find(thrd.get()) != thread_map_.end());
                     HPX_ASSERT(thrd->get_pool() == &memory_pool_);
 
                     // push the new thread in the pending queue thread
@@ -756,6 +682,13 @@ namespace hpx { namespace threads { namespace policies
             {
                 --src->work_items_count_;
 
+                bool const affine = has_affinity_hint(get_thread_data(trd));
+                if (affine)
+                {
+                    --src->affine_work_items_count_;
+                    ++affine_work_items_count_;
+                }
+
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
                 if (maintain_queue_wait_times) {
                     boost::uint64_t now = util::high_resolution_clock::now();
@@ -823,6 +756,8 @@ namespace hpx { namespace threads { namespace policies
                 thrd = util::get<0>(*tdesc);
                 delete tdesc;
 
+                if (has_affinity_hint(thrd))
+                    --affine_work_items_count_;
                 return true;
             }
 #else
@@ -830,15 +765,57 @@ namespace hpx { namespace threads { namespace policies
                 work_items_.pop(thrd, steal))
             {
                 --work_items_count_;
+                if (has_affinity_hint(thrd))
+                    --affine_work_items_count_;
                 return true;
             }
 #endif
             return false;
         }
 
+        /// Steal up to half of the pending threads of the given queue. The
+        /// first of the stolen threads is returned, all others are moved over
+        /// to this queue. Returns the number of stolen threads.
+        ///
+        /// If steal_affine is false, queues holding threads which carry an
+        /// affinity hint are left alone.
+        std::size_t steal_next_threads(thread_queue* victim,
+            threads::thread_data*& thrd, bool steal_affine = true)
+        {
+            HPX_ASSERT(victim != this);
+
+            // The pending threads can't be inspected without dequeuing them
+            // (which would change their order), skip the victim instead.
+            // Hinted threads which are scheduled concurrently may still be
+            // stolen, which is benign.
+            if (!steal_affine && 0 != victim->affine_work_items_count_.load(
+                    boost::memory_order_relaxed))
+            {
+                return 0;
+            }
+
+            boost::int64_t count =
+                victim->work_items_count_.load(boost::memory_order_relaxed);
+            if (0 == count || !victim->get_next_thread(thrd, true))
+                return 0;
+
+            std::size_t stolen = 1;
+            std::size_t const max_stolen = std::size_t(count + 1) / 2;
+
+            threads::thread_data* next = nullptr;
+            while (stolen < max_stolen && victim->get_next_thread(next, true))
+            {
+                schedule_thread(next);
+                ++stolen;
+            }
+            return stolen;
+        }
+
         /// Schedule the passed thread
         void schedule_thread(threads::thread_data* thrd, bool other_end = false)
         {
+            if (has_affinity_hint(thrd))
+                ++affine_work_items_count_;
             ++work_items_count_;
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
             work_items_.push(new thread_description(
@@ -878,12 +855,11 @@ namespace hpx { namespace threads { namespace policies
             if (unknown == state)
                 return thread_map_count_ + new_tasks_count_ - terminated_items_count_;
 
-            // acquire lock only if absolutely necessary
             std::lock_guard<mutex_type> lk(mtx_);
 
             boost::int64_t num_threads = 0;
-            thread_map_type::const_iterator end = thread_map_.end();
-            for (thread_map_type::const_iterator it = thread_map_.begin();
+            typename thread_map_type::const_iterator end = thread_map_.end();
+            for (typename thread_map_type::const_iterator it = thread_map_.begin();
                  it != end; ++it)
             {
                 if ((*it)->get_state().state() == state)
@@ -896,8 +872,9 @@ namespace hpx { namespace threads { namespace policies
         void abort_all_suspended_threads()
         {
             std::lock_guard<mutex_type> lk(mtx_);
-            thread_map_type::iterator end =  thread_map_.end();
-            for (thread_map_type::iterator it = thread_map_.begin();
+
+            typename thread_map_type::const_iterator end = thread_map_.end();
+            for (typename thread_map_type::const_iterator it = thread_map_.begin();
                  it != end; ++it)
             {
                 if ((*it)->get_state().state() == suspended)
@@ -971,15 +948,20 @@ namespace hpx { namespace threads { namespace policies
         }
 
         ///////////////////////////////////////////////////////////////////////
-        void on_start_thread(std::size_t num_thread) {}
-        void on_stop_thread(std::size_t num_thread) {}
+        void on_start_thread(std::size_t num_thread)
+        {
+            // thread objects are allocated by the OS thread owning this queue
+            memory_pool_.set_owner();
+        }
+        void on_stop_thread(std::size_t num_thread)
+        {
+            memory_pool_.reset_owner();
+        }
         void on_error(std::size_t num_thread, boost::exception_ptr const& e) {}
 
     private:
         mutable mutex_type mtx_;                    ///< mutex protecting the members
 
-        thread_map_type thread_map_;
-        ///< mapping of thread id's to HPX-threads
         boost::atomic<boost::int64_t> thread_map_count_;
         ///< overall count of work items
 
@@ -987,6 +969,8 @@ namespace hpx { namespace threads { namespace policies
         ///< list of active work items
         boost::atomic<boost::int64_t> work_items_count_;
         ///< count of active work items
+        boost::atomic<boost::int64_t> affine_work_items_count_;
+        ///< count of active work items carrying an affinity hint
 
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
         boost::atomic<boost::int64_t> work_items_wait_;
@@ -1015,10 +999,9 @@ namespace hpx { namespace threads { namespace policies
         threads::thread_pool memory_pool_;          ///< OS thread local memory pools for
                                                     ///< HPX-threads
 
-        std::list<thread_id_type> thread_heap_small_;
-        std::list<thread_id_type> thread_heap_medium_;
-        std::list<thread_id_type> thread_heap_large_;
-        std::list<thread_id_type> thread_heap_huge_;
+        thread_map_type thread_map_;
+        ///< mapping of thread id's to HPX-threads, this has to be destroyed
+        ///< before the memory pool
 
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
         boost::uint64_t add_new_time_;
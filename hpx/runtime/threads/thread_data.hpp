@@ -12,6 +12,7 @@
 #include <hpx/runtime/get_locality_id.hpp>
 #include <hpx/runtime/threads/coroutines/coroutine.hpp>
 #include <hpx/runtime/threads/detail/combined_tagged_state.hpp>
+#include <hpx/runtime/threads/detail/slab_pool.hpp>
 #include <hpx/runtime/threads/thread_data_fwd.hpp>
 #include <hpx/runtime/threads/thread_init_data.hpp>
 #include <hpx/throw_exception.hpp>
@@ -20,7 +21,6 @@
 #include <hpx/util/atomic_count.hpp>
 #include <hpx/util/backtrace.hpp>
 #include <hpx/util/function.hpp>
-#include <hpx/util/lockfree/freelist.hpp>
 #include <hpx/util/logging.hpp>
 #include <hpx/util/spinlock_pool.hpp>
 #include <hpx/util/thread_description.hpp>
@@ -91,7 +91,7 @@ namespace hpx { namespace threads
         struct tag {};
         typedef util::spinlock_pool<tag> mutex_type;
 
-        typedef boost::lockfree::caching_freelist<thread_data> pool_type;
+        typedef detail::slab_pool<thread_data> pool_type;
 
         static boost::intrusive_ptr<thread_data> create(
             thread_init_data& init_data, pool_type& pool,
@@ -496,6 +496,21 @@ namespace hpx { namespace threads
             return stacksize_;
         }
 
+        /// Return the key of the affinity hint this thread was created with,
+        /// std::size_t(-1) if none was given
+        std::size_t get_affinity_hint() const
+        {
+            return affinity_hint_;
+        }
+
+        /// Return the point in time (in nanoseconds, as measured by the
+        /// util::high_resolution_clock) this thread should have completed
+        /// by, zero if the thread has no deadline
+        std::uint64_t get_deadline() const
+        {
+            return deadline_;
+        }
+
         pool_type* get_pool()
         {
             return pool_;
@@ -554,7 +569,7 @@ namespace hpx { namespace threads
             coroutine_.rebind(std::move(init_data.func),
                 std::move(init_data.target), this_());
 
-            HPX_ASSERT(init_data.stacksize != 0);
+            HPX_ASSERT(init_data.stacksize >= 0);
             HPX_ASSERT(coroutine_.is_ready());
         }
 
@@ -594,6 +609,8 @@ namespace hpx { namespace threads
             scheduler_base_(init_data.scheduler_base),
             count_(0),
             stacksize_(init_data.stacksize),
+            affinity_hint_(init_data.affinity_hint),
+            deadline_(init_data.deadline),
             coroutine_(std::move(init_data.func), std::move(init_data.target),
                 this_(), init_data.stacksize),
             pool_(&pool)
@@ -615,7 +632,7 @@ namespace hpx { namespace threads
             if (0 == parent_locality_id_)
                 parent_locality_id_ = get_locality_id();
 #endif
-            HPX_ASSERT(init_data.stacksize != 0);
+            HPX_ASSERT(init_data.stacksize >= 0);
             HPX_ASSERT(coroutine_.is_ready());
         }
 
@@ -649,6 +666,8 @@ namespace hpx { namespace threads
             ran_exit_funcs_ = false;
             exit_funcs_.clear();
             scheduler_base_ = init_data.scheduler_base;
+            affinity_hint_ = init_data.affinity_hint;
+            deadline_ = init_data.deadline;
 
             HPX_ASSERT(init_data.stacksize == get_stack_size());
 
@@ -720,6 +739,8 @@ namespace hpx { namespace threads
         util::atomic_count count_;
 
         std::ptrdiff_t stacksize_;
+        std::size_t affinity_hint_;
+        std::uint64_t deadline_;
 
         coroutine_type coroutine_;
         pool_type* pool_;
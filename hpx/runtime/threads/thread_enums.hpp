@@ -108,6 +108,10 @@ namespace hpx { namespace threads
         thread_stacksize_medium = 2,        ///< use medium sized stack size
         thread_stacksize_large = 3,         ///< use large stack size
         thread_stacksize_huge = 4,          ///< use very large stack size
+        thread_stacksize_nostack = 5,       ///< don't allocate a stack for
+                                            ///< the thread, it borrows a
+                                            ///< (small) stack from the worker
+                                            ///< thread while running
 
         thread_stacksize_default = thread_stacksize_small,  ///< use default stack size
         thread_stacksize_minimal = thread_stacksize_small,  ///< use minimally stack size
@@ -116,6 +120,26 @@ namespace hpx { namespace threads
 
     /// Get the readable string representing the the given stack size constant.
     HPX_API_EXPORT char const* get_stack_size_name(std::ptrdiff_t size);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Data affinity of a thread
+    ///
+    /// An affinity hint identifies the data a thread is going to work on (for
+    /// instance the index of a partition or the address of the data). The
+    /// scheduler tries to run all threads carrying the same hint on the worker
+    /// thread which most recently ran a thread with this hint, and it avoids
+    /// migrating those threads to distant worker threads while stealing work.
+    struct thread_affinity_hint
+    {
+        explicit thread_affinity_hint(std::size_t key = std::size_t(-1))
+          : key_(key)
+        {}
+
+        /// Return whether this hint refers to any data
+        bool valid() const { return key_ != std::size_t(-1); }
+
+        std::size_t key_;
+    };
 }}
 
 #endif
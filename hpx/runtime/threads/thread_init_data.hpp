@@ -15,7 +15,10 @@
 #include <hpx/runtime/threads_fwd.hpp>
 #include <hpx/util/thread_description.hpp>
 
+#include <boost/cstdint.hpp>
+
 #include <cstddef>
+#include <cstdint>
 #include <utility>
 
 namespace hpx { namespace threads
@@ -43,6 +46,8 @@ namespace hpx { namespace threads
             priority(thread_priority_normal),
             num_os_thread(std::size_t(-1)),
             stacksize(get_default_stack_size()),
+            affinity_hint(std::size_t(-1)),
+            deadline(0),
             target(),
             scheduler_base(nullptr)
         {}
@@ -62,6 +67,8 @@ namespace hpx { namespace threads
             priority(rhs.priority),
             num_os_thread(rhs.num_os_thread),
             stacksize(rhs.stacksize),
+            affinity_hint(rhs.affinity_hint),
+            deadline(rhs.deadline),
             target(std::move(rhs.target)),
             scheduler_base(rhs.scheduler_base)
         {}
@@ -87,6 +94,8 @@ namespace hpx { namespace threads
             priority(priority_), num_os_thread(os_thread),
             stacksize(stacksize_ == std::ptrdiff_t(-1) ?
                 get_default_stack_size() : stacksize_),
+            affinity_hint(std::size_t(-1)),
+            deadline(0),
             target(target_),
             scheduler_base(scheduler_base_)
         {}
@@ -108,6 +117,8 @@ namespace hpx { namespace threads
         thread_priority priority;
         std::size_t num_os_thread;
         std::ptrdiff_t stacksize;
+        std::size_t affinity_hint;      // key of thread_affinity_hint
+        std::uint64_t deadline;         // [ns] (high_resolution_clock), 0: none
 
         naming::id_type target;
 
@@ -30,11 +30,15 @@ namespace hpx
             struct lockfree_fifo;
             struct lockfree_lifo;
 
+            class locking_thread_map;
+            class lockfree_thread_map;
+
             // multi priority scheduler with work-stealing
             template <typename Mutex = boost::mutex
                     , typename PendingQueuing = lockfree_fifo
                     , typename StagedQueuing = lockfree_fifo
                     , typename TerminatedQueuing = lockfree_lifo
+                    , typename ThreadMap = locking_thread_map
                      >
             class HPX_EXPORT local_priority_queue_scheduler;
 
@@ -43,6 +47,7 @@ namespace hpx
                     , typename PendingQueuing = lockfree_fifo
                     , typename StagedQueuing = lockfree_fifo
                     , typename TerminatedQueuing = lockfree_lifo
+                    , typename ThreadMap = locking_thread_map
                      >
             class HPX_EXPORT local_queue_scheduler;
 
@@ -55,6 +60,19 @@ namespace hpx
             class HPX_EXPORT periodic_priority_queue_scheduler;
 #endif
 
+#if defined(HPX_HAVE_DEADLINE_SCHEDULER)
+            struct deadline_fifo;
+
+            // multi priority scheduler with work-stealing, orders the
+            // threads by their deadline (earliest deadline first)
+            template <typename Mutex = boost::mutex
+                    , typename PendingQueuing = deadline_fifo
+                    , typename StagedQueuing = lockfree_fifo
+                    , typename TerminatedQueuing = lockfree_lifo
+                     >
+            class HPX_EXPORT deadline_queue_scheduler;
+#endif
+
 #if defined(HPX_HAVE_STATIC_PRIORITY_SCHEDULER)
             // multi priority scheduler with no work-stealing
             template <typename Mutex = boost::mutex
@@ -101,6 +119,14 @@ namespace hpx
                 lockfree_lifo  // LIFO terminated queuing
             > fifo_priority_queue_scheduler;
 
+            typedef local_priority_queue_scheduler<
+                boost::mutex,
+                lockfree_fifo, // FIFO pending queuing
+                lockfree_fifo, // FIFO staged queuing
+                lockfree_lifo, // LIFO terminated queuing
+                lockfree_thread_map // lock-free thread bookkeeping
+            > lockfree_map_priority_queue_scheduler;
+
 #if defined(HPX_HAVE_ABP_SCHEDULER)
             struct lockfree_abp_fifo;
             struct lockfree_abp_lifo;
@@ -113,6 +139,24 @@ namespace hpx
             > abp_fifo_priority_queue_scheduler;
 #endif
 
+#if defined(HPX_HAVE_CHASE_LEV_SCHEDULER)
+            struct lockfree_chase_lev;
+
+            typedef local_priority_queue_scheduler<
+                boost::mutex,
+                lockfree_chase_lev, // LIFO + Chase-Lev stealing pending queuing
+                lockfree_fifo,      // FIFO staged queuing
+                lockfree_lifo       // LIFO terminated queuing
+            > chase_lev_priority_queue_scheduler;
+
+            typedef local_queue_scheduler<
+                boost::mutex,
+                lockfree_chase_lev, // LIFO + Chase-Lev stealing pending queuing
+                lockfree_fifo,      // FIFO staged queuing
+                lockfree_lifo       // LIFO terminated queuing
+            > chase_lev_queue_scheduler;
+#endif
+
             // define the default scheduler to use
             typedef fifo_priority_queue_scheduler queue_scheduler;
 
@@ -7,17 +7,88 @@
 #define HPX_TRAITS_IS_BITWISE_SERIALIZABLE_HPP
 
 #include <hpx/config.hpp>
+#include <hpx/runtime/serialization/serialization_fwd.hpp>
+#include <hpx/traits/has_member_xxx.hpp>
 
 #include <type_traits>
+#include <utility>
 
 namespace hpx { namespace traits
 {
+    namespace detail
+    {
+        HPX_HAS_MEMBER_XXX_TRAIT_DEF(serialize);
+
+        template <typename T, typename Enable = void>
+        struct has_free_serialize
+          : std::false_type
+        {};
+
+        template <typename T>
+        struct has_free_serialize<T,
+            decltype(static_cast<void>(serialize(
+                std::declval<hpx::serialization::output_archive&>(),
+                std::declval<T&>(), 0u)))>
+          : std::true_type
+        {};
+
+        // Types providing a serialization function of their own (member or
+        // free) are always serialized using that function.
+        template <typename T>
+        struct has_serialize_function
+          : std::integral_constant<bool,
+                has_serialize<T>::value || has_free_serialize<T>::value>
+        {};
+
+        // Non-empty trivially copyable classes without a serialization
+        // function are serialized bitwise by default (pointers are never
+        // detected as those are not classes). Note that this can't detect
+        // pointer members, types holding pointers have to either provide a
+        // serialization function or use HPX_IS_NOT_BITWISE_SERIALIZABLE.
+#if defined(HPX_HAVE_CXX11_STD_IS_TRIVIALLY_COPYABLE)
+        template <typename T, typename Enable = void>
+        struct is_implicitly_bitwise_serializable
+          : std::false_type
+        {};
+
+        template <typename T>
+        struct is_implicitly_bitwise_serializable<T,
+            typename std::enable_if<
+                std::is_class<T>::value && !std::is_empty<T>::value &&
+                std::is_trivially_copyable<T>::value
+            >::type>
+          : std::integral_constant<bool, !has_serialize_function<T>::value>
+        {};
+#else
+        template <typename T>
+        struct is_implicitly_bitwise_serializable
+          : std::false_type
+        {};
+#endif
+    }
+
     template <typename T>
     struct is_bitwise_serializable
-      : std::is_arithmetic<T>
+      : std::integral_constant<bool,
+            std::is_arithmetic<T>::value ||
+            detail::is_implicitly_bitwise_serializable<T>::value>
+    {};
+
+    // pairs are bitwise serializable if both of their members are, this
+    // includes the value_type of maps (with a const key)
+    template <typename T1, typename T2>
+    struct is_bitwise_serializable<std::pair<T1, T2> >
+      : std::integral_constant<bool,
+            is_bitwise_serializable<
+                typename std::remove_const<T1>::type>::value &&
+            is_bitwise_serializable<
+                typename std::remove_const<T2>::type>::value>
     {};
 }}
 
+// Marks the type T as bitwise serializable. This is needed only for types
+// which are not detected automatically, e.g. types providing a serialization
+// function which may still be copied bitwise.
 #define HPX_IS_BITWISE_SERIALIZABLE(T)                                        \
 namespace hpx { namespace traits {                                            \
     template <>                                                               \
@@ -27,4 +98,15 @@ namespace hpx { namespace traits {                                            \
 }}                                                                            \
 /**/
 
+// Excludes the type T from being serialized bitwise, this is needed for
+// trivially copyable types holding pointers.
+#define HPX_IS_NOT_BITWISE_SERIALIZABLE(T)                                    \
+namespace hpx { namespace traits {                                            \
+    template <>                                                               \
+    struct is_bitwise_serializable< T >                                       \
+      : std::false_type                                                       \
+    {};                                                                       \
+}}                                                                            \
+/**/
+
 #endif /*HPX_TRAITS_IS_BITWISE_SERIALIZABLE_HPP*/
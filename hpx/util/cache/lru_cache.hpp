@@ -354,6 +354,7 @@ namespace hpx { namespace util { namespace cache
                 if(ep(*jt))
                 {
                     ++erased;
+                    --current_size_;
 
                     storage_.erase(jt);
                     it = map_.erase(it);
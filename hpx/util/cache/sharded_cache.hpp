@@ -0,0 +1,364 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_UTIL_CACHE_SHARDED_CACHE_HPP
+#define HPX_UTIL_CACHE_SHARDED_CACHE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/cache/statistics/no_statistics.hpp>
+
+#include <boost/cstdint.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace util { namespace cache
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The \a hash_sharding policy stores each key in exactly one
+    ///        shard, selected by hashing the key.
+    template <typename Key, typename Hash = std::hash<Key> >
+    struct hash_sharding
+    {
+        std::size_t operator()(Key const& key, std::size_t num_shards) const
+        {
+            return Hash()(key) % num_shards;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \class sharded_cache sharded_cache.hpp hpx/util/cache/sharded_cache.hpp
+    ///
+    /// \brief The \a sharded_cache distributes its entries over a number of
+    ///        independent caches (shards), each of which is protected by a
+    ///        lock of its own. Concurrent accesses to keys stored in
+    ///        different shards don't contend with each other. The eviction
+    ///        policy of the underlying cache is applied per shard only.
+    ///
+    ///        Keys which can't be assigned to a single shard (for instance
+    ///        keys representing ranges) are stored once, in an additional
+    ///        cache shared by all shards and protected by a lock of its own.
+    ///        Whenever that cache changes, an immutable copy of its entries
+    ///        is published to all shards. Lookups which don't find a key in
+    ///        its shard fall back to the copy published to that shard, they
+    ///        don't acquire the lock of the shared cache. As a consequence,
+    ///        the shared cache evicts its entries in the order they were
+    ///        inserted.
+    ///
+    /// \tparam Cache         The type of the cache to use for each of the
+    ///                       shards, for instance \a lru_cache. It has to
+    ///                       provide the function \a holds_key.
+    /// \tparam Sharding      A function object type selecting the shard a
+    ///                       key is stored in. It is invoked with the key and
+    ///                       the number of shards and returns the index of
+    ///                       the shard, or the number of shards for keys
+    ///                       which have to be stored in the shared cache.
+    /// \tparam Mutex         The type of the lock protecting each shard.
+    template <
+        typename Cache,
+        typename Sharding = hash_sharding<typename Cache::key_type>,
+        typename Mutex = lcos::local::spinlock
+    >
+    class sharded_cache
+    {
+        HPX_NON_COPYABLE(sharded_cache);
+
+    public:
+        typedef typename Cache::key_type key_type;
+        typedef typename Cache::entry_type entry_type;
+        typedef typename Cache::statistics_type statistics_type;
+        typedef typename Cache::size_type size_type;
+        typedef Mutex mutex_type;
+
+    private:
+        // avoid false sharing between the locks of adjacent shards
+        enum { cache_line_size = 64 };
+
+        typedef std::map<key_type, entry_type> shared_entries_type;
+
+        struct shard
+        {
+            mutable mutex_type mtx_;
+            Cache cache_;
+
+            // the entries of the shared cache, empty if there are none
+            std::shared_ptr<shared_entries_type const> shared_entries_;
+
+            char pad_[cache_line_size];
+        };
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Construct an instance of a sharded_cache.
+        ///
+        /// \param num_shards [in] The number of independent shards to use.
+        /// \param sharding   [in] The function object mapping keys onto
+        ///                   shards.
+        explicit sharded_cache(std::size_t num_shards = 16,
+                Sharding const& sharding = Sharding())
+          : num_shards_(num_shards != 0 ? num_shards : 1)
+          , shards_(new shard[num_shards_ + 1])
+          , sharding_(sharding)
+        {}
+
+        /// \brief Return the number of shards used by this cache
+        std::size_t num_shards() const
+        {
+            return num_shards_;
+        }
+
+        /// \brief Return the overall number of entries held in all shards
+        ///        (including the shared cache).
+        size_type size() const
+        {
+            size_type result = 0;
+            for (std::size_t i = 0; i <= num_shards_; ++i)
+            {
+                std::lock_guard<mutex_type> l(shards_[i].mtx_);
+                result += shards_[i].cache_.size();
+            }
+            return result;
+        }
+
+        /// \brief Change the maximal size of the cache. The maximal size is
+        ///        evenly distributed over all shards, while the shared cache
+        ///        may hold up to \a max_size entries on its own.
+        void reserve(size_type max_size)
+        {
+            size_type shard_size = (max_size + num_shards_ - 1) / num_shards_;
+
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                std::lock_guard<mutex_type> l(shards_[i].mtx_);
+                shards_[i].cache_.reserve(shard_size);
+            }
+
+            shard& s = get_shard(num_shards_);
+            std::lock_guard<mutex_type> l(s.mtx_);
+            s.cache_.reserve(max_size);
+            publish_shared_entries(held_shared_entries());
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param key      [in] The key for the entry which should be
+        ///                 retrieved from the cache.
+        /// \param realkey  [out] This will hold the key of the entry as
+        ///                 stored in the cache.
+        /// \param entry    [out] If the entry indexed by the key is found in
+        ///                 the cache this value on successful return will be
+        ///                 a copy of the corresponding entry.
+        ///
+        /// \returns        This function returns \a true if the cache holds
+        ///                 the referenced entry, otherwise it returns
+        ///                 \a false.
+        bool get_entry(key_type const& key, key_type& realkey,
+            entry_type& entry)
+        {
+            std::size_t index = sharding_(key, num_shards_);
+            if (index != num_shards_)
+            {
+                shard& s = get_shard(index);
+                std::lock_guard<mutex_type> l(s.mtx_);
+
+                if (!s.shared_entries_ || s.cache_.holds_key(key))
+                    return s.cache_.get_entry(key, realkey, entry);
+
+                return get_shared_entry(s, key, realkey, entry);
+            }
+
+            shard& s = get_shard(num_shards_);
+            std::lock_guard<mutex_type> l(s.mtx_);
+            return s.cache_.get_entry(key, realkey, entry);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in the shard the key belongs
+        ///        to, or insert it if it doesn't exist yet.
+        ///
+        /// \param f        [in] A callable taking two arguments, \a key and
+        ///                 the key found in the shard, which is passed on to
+        ///                 the \a update_if function of the shard. A key
+        ///                 stored in a single shard is passed to \a f
+        ///                 together with the matching key of the shared
+        ///                 cache as well, if there is one.
+        ///
+        /// \returns        This function returns \a false if the update was
+        ///                 rejected by \a f.
+        template <typename F>
+        bool update_if(key_type const& key, entry_type const& entry, F && f)
+        {
+            std::size_t index = sharding_(key, num_shards_);
+            shard& s = get_shard(index);
+            std::lock_guard<mutex_type> l(s.mtx_);
+
+            if (index != num_shards_)
+            {
+                // reject keys colliding with an entry of the shared cache
+                if (s.shared_entries_)
+                {
+                    typename shared_entries_type::const_iterator it =
+                        s.shared_entries_->find(key);
+                    if (it != s.shared_entries_->end() && f(key, it->first))
+                        return false;
+                }
+                return s.cache_.update_if(key, entry, std::forward<F>(f));
+            }
+
+            if (!s.cache_.update_if(key, entry, std::forward<F>(f)))
+                return false;
+
+            std::shared_ptr<shared_entries_type> entries =
+                held_shared_entries();
+            std::pair<typename shared_entries_type::iterator, bool> p =
+                entries->insert(std::make_pair(key, entry));
+            if (!p.second)
+                p.first->second = entry;
+            publish_shared_entries(entries);
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Remove stored entries from all shards for which the
+        ///        supplied function object returns true.
+        ///
+        /// \returns        This function returns the overall number of
+        ///                 removed entries.
+        template <typename Func>
+        size_type erase(Func const& ep)
+        {
+            size_type erased = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                std::lock_guard<mutex_type> l(shards_[i].mtx_);
+                erased += shards_[i].cache_.erase(ep);
+            }
+
+            shard& s = get_shard(num_shards_);
+            std::lock_guard<mutex_type> l(s.mtx_);
+            erased += s.cache_.erase(ep);
+            publish_shared_entries(held_shared_entries());
+            return erased;
+        }
+
+        /// \brief Clear all shards
+        size_type clear()
+        {
+            size_type erased = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                std::lock_guard<mutex_type> l(shards_[i].mtx_);
+                erased += shards_[i].cache_.clear();
+            }
+
+            shard& s = get_shard(num_shards_);
+            std::lock_guard<mutex_type> l(s.mtx_);
+            erased += s.cache_.clear();
+            publish_shared_entries(
+                std::make_shared<shared_entries_type>());
+            return erased;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Accumulate a value over the statistics instances of all
+        ///        shards.
+        ///
+        /// \param f        [in] A callable which is invoked with a reference
+        ///                 to the statistics instance of each of the shards.
+        template <typename F>
+        boost::int64_t accumulate_statistics(F && f)
+        {
+            boost::int64_t result = 0;
+            for (std::size_t i = 0; i <= num_shards_; ++i)
+            {
+                std::lock_guard<mutex_type> l(shards_[i].mtx_);
+                result += f(shards_[i].cache_.get_statistics());
+            }
+            return result;
+        }
+
+    private:
+        // the shard at index num_shards_ is the cache shared by all shards
+        shard& get_shard(std::size_t index)
+        {
+            HPX_ASSERT(index <= num_shards_);
+            return shards_[index];
+        }
+
+        // Look up a key in the entries of the shared cache published to the
+        // given shard, assumes that the lock of the shard is held. The
+        // lookup is accounted for in the statistics of the shard.
+        bool get_shared_entry(shard& s, key_type const& key,
+            key_type& realkey, entry_type& entry)
+        {
+            statistics_type& stat = s.cache_.get_statistics();
+            typename statistics_type::update_on_exit update(
+                stat, statistics::method_get_entry);
+
+            typename shared_entries_type::const_iterator it =
+                s.shared_entries_->find(key);
+            if (it == s.shared_entries_->end())
+            {
+                stat.got_miss();
+                return false;
+            }
+
+            stat.got_hit();
+            realkey = it->first;
+            entry = it->second;
+            return true;
+        }
+
+        // Collect the published entries still held by the shared cache,
+        // assumes that the lock of the shared cache is held.
+        std::shared_ptr<shared_entries_type> held_shared_entries()
+        {
+            shard& s = get_shard(num_shards_);
+
+            std::shared_ptr<shared_entries_type> entries =
+                std::make_shared<shared_entries_type>();
+            if (s.shared_entries_)
+            {
+                for (auto const& e : *s.shared_entries_)
+                {
+                    if (s.cache_.holds_key(e.first))
+                        entries->insert(e);
+                }
+            }
+            return entries;
+        }
+
+        // Publish the entries of the shared cache to all shards, assumes
+        // that the lock of the shared cache is held, which orders concurrent
+        // publications.
+        void publish_shared_entries(
+            std::shared_ptr<shared_entries_type const> entries)
+        {
+            if (entries->empty())
+                entries.reset();
+
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                std::lock_guard<mutex_type> l(shards_[i].mtx_);
+                shards_[i].shared_entries_ = entries;
+            }
+            get_shard(num_shards_).shared_entries_ = std::move(entries);
+        }
+
+        std::size_t const num_shards_;
+        std::unique_ptr<shard[]> shards_;
+        Sharding sharding_;
+    };
+}}}
+
+#endif
@@ -0,0 +1,212 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This is an implementation of the dynamic circular work-stealing deque as
+// described in:
+//
+//   D. Chase and Y. Lev, Dynamic Circular Work-Stealing Deque, SPAA 2005
+//
+// using the memory orderings derived in:
+//
+//   N. M. Le, A. Pop, A. Cohen, and F. Zappa Nardelli, Correct and Efficient
+//   Work-Stealing for Weak Memory Models, PPoPP 2013
+
+#if !defined(HPX_UTIL_LOCKFREE_CHASE_LEV_DEQUE_SEP_29_2016_1047AM)
+#define HPX_UTIL_LOCKFREE_CHASE_LEV_DEQUE_SEP_29_2016_1047AM
+
+#include <hpx/config.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace hpx { namespace util { namespace lockfree
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // A single producer, multiple consumer work-stealing deque. Only the
+    // owning thread may call push() and pop(), which operate on the bottom end
+    // of the deque (LIFO) and which do not require any atomic read-modify-write
+    // operation (except when taking the very last element). Any thread may
+    // call steal(), which removes elements from the top end (FIFO).
+    //
+    // The stored type has to be trivially copyable (the deque is meant to hold
+    // pointers).
+    template <typename T>
+    class chase_lev_deque
+    {
+    private:
+        HPX_MOVABLE_ONLY(chase_lev_deque);
+
+        typedef boost::int64_t index_type;
+
+        enum { cache_line_size = 64 };
+
+        // circular array of elements, the size is always a power of two
+        struct array
+        {
+            array(std::size_t log_size)
+              : log_size_(log_size),
+                mask_((index_type(1) << log_size) - 1),
+                buffer_(new boost::atomic<T>[std::size_t(1) << log_size])
+            {}
+
+            ~array()
+            {
+                delete [] buffer_;
+            }
+
+            index_type size() const
+            {
+                return mask_ + 1;
+            }
+
+            T get(index_type i) const
+            {
+                return buffer_[i & mask_].load(boost::memory_order_relaxed);
+            }
+
+            void put(index_type i, T val)
+            {
+                buffer_[i & mask_].store(val, boost::memory_order_relaxed);
+            }
+
+            // create a new array twice as large, holding all current elements
+            array* grow(index_type bottom, index_type top) const
+            {
+                array* a = new array(log_size_ + 1);
+                for (index_type i = top; i != bottom; ++i)
+                    a->put(i, get(i));
+                return a;
+            }
+
+            std::size_t log_size_;
+            index_type mask_;
+            boost::atomic<T>* buffer_;
+        };
+
+    public:
+        typedef T value_type;
+
+        explicit chase_lev_deque(std::size_t initial_size = 128)
+          : top_(0), bottom_(0), array_(nullptr)
+        {
+#if defined(HPX_HAVE_CXX11_STD_IS_TRIVIALLY_COPYABLE)
+            static_assert(std::is_trivially_copyable<T>::value,
+                "chase_lev_deque requires a trivially copyable value type");
+#endif
+            std::size_t log_size = 1;
+            while ((std::size_t(1) << log_size) < initial_size)
+                ++log_size;
+
+            array_.store(new array(log_size), boost::memory_order_relaxed);
+        }
+
+        ~chase_lev_deque()
+        {
+            delete array_.load(boost::memory_order_relaxed);
+            for (array* a : retired_)
+                delete a;
+        }
+
+        // Owner only: push the given element onto the bottom end.
+        void push(T val)
+        {
+            index_type b = bottom_.load(boost::memory_order_relaxed);
+            index_type t = top_.load(boost::memory_order_acquire);
+            array* a = array_.load(boost::memory_order_relaxed);
+
+            if (b - t > a->size() - 1)
+            {
+                // The deque is full, grow it. The old array can't be deleted
+                // as concurrent thieves might still be reading from it.
+                array* new_a = a->grow(b, t);
+                retired_.push_back(a);
+                array_.store(new_a, boost::memory_order_release);
+                a = new_a;
+            }
+
+            a->put(b, val);
+            boost::atomic_thread_fence(boost::memory_order_release);
+            bottom_.store(b + 1, boost::memory_order_relaxed);
+        }
+
+        // Owner only: remove an element from the bottom end.
+        bool pop(T& val)
+        {
+            index_type b = bottom_.load(boost::memory_order_relaxed) - 1;
+            array* a = array_.load(boost::memory_order_relaxed);
+            bottom_.store(b, boost::memory_order_relaxed);
+            boost::atomic_thread_fence(boost::memory_order_seq_cst);
+            index_type t = top_.load(boost::memory_order_relaxed);
+
+            if (t > b)
+            {
+                // the deque was empty
+                bottom_.store(b + 1, boost::memory_order_relaxed);
+                return false;
+            }
+
+            val = a->get(b);
+            if (t == b)
+            {
+                // this is the last element, compete with the thieves
+                bool result = top_.compare_exchange_strong(t, t + 1,
+                    boost::memory_order_seq_cst, boost::memory_order_relaxed);
+                bottom_.store(b + 1, boost::memory_order_relaxed);
+                return result;
+            }
+            return true;
+        }
+
+        // Any thread: remove an element from the top end.
+        bool steal(T& val)
+        {
+            index_type t = top_.load(boost::memory_order_acquire);
+            boost::atomic_thread_fence(boost::memory_order_seq_cst);
+            index_type b = bottom_.load(boost::memory_order_acquire);
+
+            if (t >= b)
+                return false;       // the deque is empty
+
+            array* a = array_.load(boost::memory_order_consume);
+            val = a->get(t);
+
+            // fails if we lost the race with the owner or with another thief
+            return top_.compare_exchange_strong(t, t + 1,
+                boost::memory_order_seq_cst, boost::memory_order_relaxed);
+        }
+
+        bool empty() const
+        {
+            index_type b = bottom_.load(boost::memory_order_relaxed);
+            index_type t = top_.load(boost::memory_order_relaxed);
+            return b <= t;
+        }
+
+        std::size_t size() const
+        {
+            index_type b = bottom_.load(boost::memory_order_relaxed);
+            index_type t = top_.load(boost::memory_order_relaxed);
+            return b > t ? std::size_t(b - t) : 0;
+        }
+
+    private:
+        // top_ and bottom_ are modified by different threads, keep them on
+        // separate cache lines
+        boost::atomic<index_type> top_;
+        char pad0_[cache_line_size - sizeof(boost::atomic<index_type>)];
+        boost::atomic<index_type> bottom_;
+        char pad1_[cache_line_size - sizeof(boost::atomic<index_type>)];
+        boost::atomic<array*> array_;
+
+        std::vector<array*> retired_;       // accessed by the owner only
+    };
+}}}
+
+#endif
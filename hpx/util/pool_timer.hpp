@@ -42,6 +42,10 @@ namespace hpx { namespace util
         ~pool_timer();
 
         bool start(bool evaluate = true);
+
+        // start the timer such that it expires after the given time
+        bool start(hpx::util::steady_duration const& time_duration,
+            bool evaluate = true);
         bool stop();
 
         bool is_started() const;
@@ -72,12 +72,20 @@ namespace hpx { namespace util
         std::size_t get_agas_local_cache_size(
             std::size_t dflt = HPX_AGAS_LOCAL_CACHE_SIZE) const;
 
+        // Get the number of shards the AGAS client-side local cache is split
+        // into
+        std::size_t get_agas_local_cache_shards() const;
+
         bool get_agas_caching_mode() const;
 
         bool get_agas_range_caching_mode() const;
 
         std::size_t get_agas_max_pending_refcnt_requests() const;
 
+        // Get the interval (in milliseconds) after which pending reference
+        // count decrements are flushed, zero disables periodic flushing
+        std::size_t get_agas_refcnt_flush_interval() const;
+
         // Get whether the AGAS server is running as a dedicated runtime.
         // This decides whether the AGAS actions are executed with normal
         // priority (if dedicated) or with high priority (non-dedicated)
@@ -144,6 +152,10 @@ namespace hpx { namespace util
 #if defined(__linux) || defined(linux) || defined(__linux__) || defined(__FreeBSD__)
         bool init_use_stack_guard_pages() const;
 #endif
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+        std::size_t init_stack_pool_watermark(char const* entryname,
+            std::size_t defaultvalue) const;
+#endif
 
         void pre_initialize_ini();
         void post_initialize_ini(std::string& hpx_ini_file,
@@ -0,0 +1,244 @@
+//  Copyright (c) 2026 agent
+//  Copyright (c) 2013-2014 Thomas Heller
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_UTIL_SIZE_CLASS_POOL_HPP
+#define HPX_UTIL_SIZE_CLASS_POOL_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // This pool keeps blocks of memory which have been returned to it on free
+    // lists, one for each power of two size class. Allocations larger than
+    // the largest size class are passed through to the global heap. The
+    // number of blocks cached for each size class is bounded.
+    template <typename Mutex = hpx::lcos::local::spinlock>
+    struct size_class_pool
+    {
+    private:
+        HPX_NON_COPYABLE(size_class_pool);
+
+        typedef Mutex mutex_type;
+
+        // the smallest size class holds 64 bytes
+        enum { min_size_class = 6 };
+
+        struct size_class
+        {
+            mutex_type mtx_;
+            std::vector<char*> blocks_;
+        };
+
+    public:
+        size_class_pool(std::size_t max_size = 0x100000,
+                std::size_t max_blocks = 16)
+          : num_size_classes_(get_size_class(max_size) + 1)
+          , size_classes_(new size_class[num_size_classes_])
+          , max_blocks_(max_blocks)
+          , hits_(0)
+          , misses_(0)
+        {
+            for (std::size_t i = 0; i != num_size_classes_; ++i)
+                size_classes_[i].blocks_.reserve(max_blocks_);
+        }
+
+        ~size_class_pool()
+        {
+            for (std::size_t i = 0; i != num_size_classes_; ++i)
+            {
+                for (char* p : size_classes_[i].blocks_)
+                    ::operator delete(p);
+            }
+        }
+
+        char* allocate(std::size_t size)
+        {
+            std::size_t index = get_size_class(size);
+            if (index < num_size_classes_)
+            {
+                size_class& c = size_classes_[index];
+                {
+                    std::lock_guard<mutex_type> l(c.mtx_);
+                    if (!c.blocks_.empty())
+                    {
+                        char* p = c.blocks_.back();
+                        c.blocks_.pop_back();
+                        ++hits_;
+                        return p;
+                    }
+                }
+                ++misses_;
+                return static_cast<char*>(
+                    ::operator new(std::size_t(1) << (index + min_size_class)));
+            }
+
+            ++misses_;
+            return static_cast<char*>(::operator new(size));
+        }
+
+        void deallocate(char* p, std::size_t size)
+        {
+            std::size_t index = get_size_class(size);
+            if (index < num_size_classes_)
+            {
+                size_class& c = size_classes_[index];
+
+                std::lock_guard<mutex_type> l(c.mtx_);
+                if (c.blocks_.size() < max_blocks_)
+                {
+                    c.blocks_.push_back(p);
+                    return;
+                }
+            }
+            ::operator delete(p);
+        }
+
+        // number of allocations served from one of the free lists
+        boost::int64_t get_hits(bool reset)
+        {
+            return util::get_and_reset_value(hits_, reset);
+        }
+
+        // number of allocations which had to go to the global heap
+        boost::int64_t get_misses(bool reset)
+        {
+            return util::get_and_reset_value(misses_, reset);
+        }
+
+    private:
+        static std::size_t get_size_class(std::size_t size)
+        {
+            std::size_t index = 0;
+            std::size_t block_size = std::size_t(1) << min_size_class;
+            while (block_size < size)
+            {
+                block_size <<= 1;
+                ++index;
+            }
+            return index;
+        }
+
+        std::size_t const num_size_classes_;
+        std::unique_ptr<size_class[]> size_classes_;
+        std::size_t const max_blocks_;
+
+        boost::atomic<boost::int64_t> hits_;
+        boost::atomic<boost::int64_t> misses_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Allocator drawing its memory from a size_class_pool. Elements are
+    // default initialized only, which leaves buffers of fundamental types
+    // uninitialized when they are resized. The allocator shares the ownership
+    // of the pool, memory may be handed back after its creator is gone.
+    template <typename T, typename Pool = size_class_pool<> >
+    struct size_class_pool_allocator
+    {
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef T* pointer;
+        typedef const T* const_pointer;
+        typedef T& reference;
+        typedef const T& const_reference;
+        typedef T value_type;
+
+        typedef std::true_type propagate_on_container_copy_assignment;
+        typedef std::true_type propagate_on_container_move_assignment;
+        typedef std::true_type propagate_on_container_swap;
+
+        template <typename U>
+        struct rebind
+        {
+            typedef size_class_pool_allocator<U, Pool> other;
+        };
+
+        size_class_pool_allocator() HPX_NOEXCEPT
+          : pool_()
+        {}
+        size_class_pool_allocator(std::shared_ptr<Pool> const& pool) HPX_NOEXCEPT
+          : pool_(pool)
+        {}
+        template <typename U>
+        size_class_pool_allocator(
+                size_class_pool_allocator<U, Pool> const& other) HPX_NOEXCEPT
+          : pool_(other.pool_)
+        {}
+
+        pointer allocate(size_type n, void const* /*hint*/ = nullptr)
+        {
+            if (n > max_size())
+                throw std::bad_alloc();
+
+            // allocators without a pool are used for empty buffers only, fall
+            // back to the global heap for those nevertheless
+            if (!pool_)
+                return static_cast<pointer>(::operator new(sizeof(T) * n));
+            return reinterpret_cast<pointer>(pool_->allocate(sizeof(T) * n));
+        }
+
+        void deallocate(pointer p, size_type n)
+        {
+            if (!pool_)
+                ::operator delete(p);
+            else
+                pool_->deallocate(reinterpret_cast<char*>(p), sizeof(T) * n);
+        }
+
+        size_type max_size() const HPX_NOEXCEPT
+        {
+            return (std::numeric_limits<std::size_t>::max)() / sizeof(T);
+        }
+
+        template <typename U>
+        void construct(U* p)
+        {
+            ::new (static_cast<void*>(p)) U;
+        }
+
+        template <typename U, typename... Ts>
+        void construct(U* p, Ts&&... vs)
+        {
+            ::new (static_cast<void*>(p)) U(std::forward<Ts>(vs)...);
+        }
+
+        template <typename U>
+        void destroy(U* p)
+        {
+            p->~U();
+        }
+
+        friend bool operator==(size_class_pool_allocator const& lhs,
+            size_class_pool_allocator const& rhs) HPX_NOEXCEPT
+        {
+            return lhs.pool_.get() == rhs.pool_.get();
+        }
+
+        friend bool operator!=(size_class_pool_allocator const& lhs,
+            size_class_pool_allocator const& rhs) HPX_NOEXCEPT
+        {
+            return lhs.pool_.get() != rhs.pool_.get();
+        }
+
+        std::shared_ptr<Pool> pool_;
+    };
+}}
+
+#endif
@@ -32,7 +32,9 @@ namespace hpx { namespace plugins { namespace parcel
         get_counter_type num_parcels, get_counter_type num_messages,
         get_counter_type num_parcels_per_message,
         get_counter_type average_time_between_parcels,
-        get_counter_values_creator_type time_between_parcels_histogram_creator)
+        get_counter_values_creator_type time_between_parcels_histogram_creator,
+        get_counter_type max_parcels_per_message,
+        get_counter_type flush_interval)
     {
         if (name.empty())
         {
@@ -49,7 +51,8 @@ namespace hpx { namespace plugins { namespace parcel
                 num_parcels, num_messages,
                 num_parcels_per_message, average_time_between_parcels,
                 time_between_parcels_histogram_creator,
-                0, 0, 1
+                0, 0, 1,
+                max_parcels_per_message, flush_interval
             };
 
             map_.emplace(name, std::move(data));
@@ -64,6 +67,8 @@ namespace hpx { namespace plugins { namespace parcel
                 average_time_between_parcels;
             (*it).second.time_between_parcels_histogram_creator =
                 time_between_parcels_histogram_creator;
+            (*it).second.max_parcels_per_message = max_parcels_per_message;
+            (*it).second.flush_interval = flush_interval;
 
             if ((*it).second.min_boundary != (*it).second.max_boundary)
             {
@@ -154,6 +159,37 @@ namespace hpx { namespace plugins { namespace parcel
         return (*it).second.average_time_between_parcels;
     }
 
+    coalescing_counter_registry::get_counter_type
+        coalescing_counter_registry::get_max_parcels_per_message_counter(
+            std::string const& name) const
+    {
+        map_type::const_iterator it = map_.find(name);
+        if (it == map_.end())
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "coalescing_counter_registry::"
+                    "get_max_parcels_per_message_counter",
+                "unknown action type");
+            return get_counter_type();
+        }
+        return (*it).second.max_parcels_per_message;
+    }
+
+    coalescing_counter_registry::get_counter_type
+        coalescing_counter_registry::get_flush_interval_counter(
+            std::string const& name) const
+    {
+        map_type::const_iterator it = map_.find(name);
+        if (it == map_.end())
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "coalescing_counter_registry::get_flush_interval_counter",
+                "unknown action type");
+            return get_counter_type();
+        }
+        return (*it).second.flush_interval;
+    }
+
     coalescing_counter_registry::get_counter_values_type
         coalescing_counter_registry::get_time_between_parcels_histogram_counter(
             std::string const& name, boost::int64_t min_boundary,
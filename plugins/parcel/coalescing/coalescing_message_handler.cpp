@@ -8,6 +8,8 @@
 #if defined(HPX_HAVE_PARCEL_COALESCING)
 #include <hpx/traits/plugin_config_data.hpp>
 #include <hpx/runtime/get_config_entry.hpp>
+#include <hpx/runtime/get_os_thread_count.hpp>
+#include <hpx/runtime/get_worker_thread_num.hpp>
 #include <hpx/runtime/parcelset/parcelport.hpp>
 #include <hpx/util/unlock_guard.hpp>
 #include <hpx/util/high_resolution_clock.hpp>
@@ -22,7 +24,10 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/accumulators/accumulators.hpp>
 
+#include <algorithm>
 #include <chrono>
+#include <cstddef>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <utility>
@@ -39,6 +44,10 @@ namespace hpx { namespace traits
     //      num_messages = 50
     //      interval = 100
     //
+    // All values except 'allow_background_flush' can be overridden for a
+    // particular action in the section
+    // [hpx.plugins.coalescing_message_handler.<action name>].
+    //
     template <>
     struct plugin_config_data<hpx::plugins::parcel::coalescing_message_handler>
     {
@@ -46,7 +55,13 @@ namespace hpx { namespace traits
         {
             return "num_messages = 50\n"
                    "interval = 100\n"
-                   "allow_background_flush = 1";
+                   "allow_background_flush = 1\n"
+                   "num_shards = 0\n"
+                   "adaptive = 0\n"
+                   "min_num_messages = 1\n"
+                   "max_num_messages = 1000\n"
+                   "min_interval = 10\n"
+                   "max_interval = 1000";
         }
     };
 }}
@@ -62,22 +77,36 @@ namespace hpx { namespace plugins { namespace parcel
 {
     namespace detail
     {
-        std::size_t get_num_messages(std::size_t num_messages)
+        // look up the given key in the section specific to the action first
+        std::size_t get_config_value(std::string const& action_name,
+            char const* key, std::size_t dflt)
+        {
+            std::string const section("hpx.plugins.coalescing_message_handler.");
+
+            std::string value = hpx::get_config_entry(
+                section + action_name + "." + key, "");
+            if (value.empty())
+                value = hpx::get_config_entry(section + key, dflt);
+
+            return boost::lexical_cast<std::size_t>(value);
+        }
+
+        std::size_t get_num_messages(std::size_t num_messages,
+            std::string const& action_name)
         {
             if (std::size_t(-1) != num_messages)
                 return num_messages;
 
-            return boost::lexical_cast<std::size_t>(hpx::get_config_entry(
-                "hpx.plugins.coalescing_message_handler.num_messages", 50));
+            return get_config_value(action_name, "num_messages", 50);
         }
 
-        std::size_t get_interval(std::size_t interval)
+        std::size_t get_interval(std::size_t interval,
+            std::string const& action_name)
         {
             if (std::size_t(-1) != interval)
                 return interval;
 
-            return boost::lexical_cast<std::size_t>(hpx::get_config_entry(
-                "hpx.plugins.coalescing_message_handler.interval", 100));
+            return get_config_value(action_name, "interval", 100);
         }
 
         bool get_background_flush()
@@ -87,33 +116,102 @@ namespace hpx { namespace plugins { namespace parcel
                 "1");
             return !value.empty() && value[0] != '0';
         }
+
+        std::size_t clamp(std::size_t value, std::size_t min_value,
+            std::size_t max_value)
+        {
+            return (std::min)((std::max)(value, min_value), max_value);
+        }
+
+        std::size_t get_num_shards(std::string const& action_name)
+        {
+            // by default use one buffer per worker thread
+            std::size_t num_shards =
+                get_config_value(action_name, "num_shards", 0);
+            if (num_shards == 0)
+                num_shards = hpx::get_os_thread_count();
+            return (std::max)(num_shards, std::size_t(1));
+        }
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    coalescing_message_handler::buffer_shard::buffer_shard(
+            std::size_t num_messages, std::size_t interval,
+            double mean_time_between_parcels, boost::int64_t now)
+      : buffer_(num_messages),
+        num_messages_per_buffer_(num_messages),
+        interval_(interval),
+        mean_time_between_parcels_(mean_time_between_parcels),
+        last_arrival_time_(now),
+        num_parcels_(0),
+        num_messages_(0)
+    {}
+
     coalescing_message_handler::coalescing_message_handler(
             char const* action_name, parcelset::parcelport* pp, std::size_t num,
             std::size_t interval)
-      : pp_(pp), buffer_(detail::get_num_messages(num)),
+      : pp_(pp),
         timer_(
             util::bind(&coalescing_message_handler::timer_flush, this_()),
             util::bind(&coalescing_message_handler::flush, this_(),
                 parcelset::policies::message_handler::flush_mode_timer, true),
-            std::chrono::microseconds(detail::get_interval(interval)),
+            std::chrono::microseconds(detail::get_interval(interval, action_name)),
             std::string(action_name) + "_timer",
             true),
         stopped_(false),
         allow_background_flush_(detail::get_background_flush()),
         action_name_(action_name),
-        num_parcels_(0), reset_num_parcels_(0),
-            reset_num_parcels_per_message_parcels_(0),
-        num_messages_(0), reset_num_messages_(0),
-            reset_num_parcels_per_message_messages_(0),
+        adaptive_(detail::get_config_value(action_name, "adaptive", 0) != 0),
+        min_num_messages_(
+            detail::get_config_value(action_name, "min_num_messages", 1)),
+        max_num_messages_(
+            detail::get_config_value(action_name, "max_num_messages", 1000)),
+        min_interval_(
+            detail::get_config_value(action_name, "min_interval", 10)),
+        max_interval_(
+            detail::get_config_value(action_name, "max_interval", 1000)),
+        reset_num_parcels_(0),
+        reset_num_parcels_per_message_parcels_(0),
+        reset_num_messages_(0),
+        reset_num_parcels_per_message_messages_(0),
         started_at_(util::high_resolution_clock::now()),
         reset_time_num_parcels_(0),
         last_parcel_time_(started_at_),
+        collect_time_between_parcels_(false),
         histogram_min_boundary_(-1),
         histogram_max_boundary_(-1),
         histogram_num_buckets_(-1)
     {
+        std::size_t num_messages = detail::get_num_messages(num, action_name);
+        std::size_t flush_interval = detail::get_interval(interval, action_name);
+        double mean_time_between_parcels = 0;
+
+        if (adaptive_)
+        {
+            if (min_num_messages_ == 0)
+                min_num_messages_ = 1;
+            if (max_num_messages_ < min_num_messages_)
+                max_num_messages_ = min_num_messages_;
+            if (max_interval_ < min_interval_)
+                max_interval_ = min_interval_;
+
+            // start off with the configured values
+            num_messages = detail::clamp(num_messages,
+                min_num_messages_, max_num_messages_);
+            flush_interval = detail::clamp(flush_interval,
+                min_interval_, max_interval_);
+            mean_time_between_parcels =
+                1000. * double(flush_interval) / double(num_messages);
+        }
+
+        std::size_t num_shards = detail::get_num_shards(action_name_);
+        shards_.reserve(num_shards);
+        for (std::size_t i = 0; i != num_shards; ++i)
+        {
+            shards_.emplace_back(new buffer_shard(num_messages, flush_interval,
+                mean_time_between_parcels, started_at_));
+        }
+
         // register performance counter functions
         using util::placeholders::_1;
         using util::placeholders::_2;
@@ -127,26 +225,54 @@ namespace hpx { namespace plugins { namespace parcel
             util::bind(&coalescing_message_handler::
                 get_average_time_between_parcels, this, _1),
             util::bind(&coalescing_message_handler::
-                get_time_between_parcels_histogram_creator, this, _1, _2, _3, _4));
+                get_time_between_parcels_histogram_creator, this, _1, _2, _3, _4),
+            util::bind(&coalescing_message_handler::
+                get_max_parcels_per_message, this, _1),
+            util::bind(&coalescing_message_handler::get_flush_interval, this, _1));
+    }
+
+    coalescing_message_handler::buffer_shard&
+        coalescing_message_handler::get_shard()
+    {
+        // threads not managed by HPX all end up using the same buffer
+        return *shards_[hpx::get_worker_thread_num() % shards_.size()];
     }
 
     void coalescing_message_handler::put_parcel(
         parcelset::locality const& dest, parcelset::parcel p,
         write_handler_type f)
     {
-        std::unique_lock<mutex_type> l(mtx_);
-        ++num_parcels_;
-
         // collect data for time between parcels histogram
-        if (time_between_parcels_)
+        if (collect_time_between_parcels_.load(boost::memory_order_relaxed))
         {
+            std::lock_guard<mutex_type> l(mtx_);
+
             boost::int64_t parcel_time = util::high_resolution_clock::now();
             (*time_between_parcels_)(parcel_time - last_parcel_time_);
             last_parcel_time_ = parcel_time;
         }
 
+        buffer_shard& shard = get_shard();
+
+        std::unique_lock<mutex_type> l(shard.mtx_);
+        ++shard.num_parcels_;
+
+        // track the moving average of the time between parcels, gaps longer
+        // than the maximal flush interval don't tell anything about the
+        // achievable coalescing, those are cut off
+        if (adaptive_)
+        {
+            boost::int64_t now = util::high_resolution_clock::now();
+            double delta = (std::min)(double(now - shard.last_arrival_time_),
+                1000. * double(max_interval_));
+            shard.last_arrival_time_ = now;
+
+            shard.mean_time_between_parcels_ +=
+                (delta - shard.mean_time_between_parcels_) / 8.;
+        }
+
         if (stopped_) {
-            ++num_messages_;
+            ++shard.num_messages_;
             l.unlock();
 
             // this instance should not buffer parcels anymore
@@ -155,12 +281,14 @@ namespace hpx { namespace plugins { namespace parcel
         }
 
         detail::message_buffer::message_buffer_append_state s =
-            buffer_.append(dest, std::move(p), std::move(f));
+            shard.buffer_.append(dest, std::move(p), std::move(f));
+
+        std::chrono::microseconds interval(shard.interval_);
 
         switch(s) {
         case detail::message_buffer::first_message:
             l.unlock();
-            timer_.start(false);        // start deadline timer to flush buffer
+            timer_.start(interval, false);  // start deadline timer to flush buffer
             break;
 
         case detail::message_buffer::normal:
@@ -168,13 +296,11 @@ namespace hpx { namespace plugins { namespace parcel
                 break;
 
             l.unlock();
-            timer_.start(false);        // start deadline timer to flush buffer
+            timer_.start(interval, false);  // start deadline timer to flush buffer
             break;
 
         case detail::message_buffer::buffer_now_full:
-            flush_locked(l,
-                parcelset::policies::message_handler::flush_mode_buffer_full,
-                false);
+            flush_locked(shard, l);
             break;
 
         default:
@@ -188,13 +314,11 @@ namespace hpx { namespace plugins { namespace parcel
 
     bool coalescing_message_handler::timer_flush()
     {
-        // adjust timer if needed
-        std::unique_lock<mutex_type> l(mtx_);
-        if (!buffer_.empty())
+        // the timer is shared by all buffers, flush all of them
+        for (std::unique_ptr<buffer_shard>& shard : shards_)
         {
-            flush_locked(l,
-                parcelset::policies::message_handler::flush_mode_timer,
-                false);
+            std::unique_lock<mutex_type> l(shard->mtx_);
+            flush_locked(*shard, l);
         }
 
         // do not restart timer for now, will be restarted on next parcel
@@ -205,17 +329,6 @@ namespace hpx { namespace plugins { namespace parcel
         parcelset::policies::message_handler::flush_mode mode,
         bool stop_buffering)
     {
-        std::unique_lock<mutex_type> l(mtx_);
-        return flush_locked(l, mode, stop_buffering);
-    }
-
-    bool coalescing_message_handler::flush_locked(
-        std::unique_lock<mutex_type>& l,
-        parcelset::policies::message_handler::flush_mode mode,
-        bool stop_buffering)
-    {
-        HPX_ASSERT(l.owns_lock());
-
         // proceed with background work only if explicitly allowed
         if (!allow_background_flush_ &&
             mode == parcelset::policies::message_handler::flush_mode_background_work)
@@ -223,20 +336,33 @@ namespace hpx { namespace plugins { namespace parcel
             return false;
         }
 
-        if (!stopped_ && stop_buffering) {
-            stopped_ = true;
-
-            util::unlock_guard<std::unique_lock<mutex_type> > ul(l);
+        if (stop_buffering && !stopped_.exchange(true))
             timer_.stop();              // interrupt timer
+
+        bool did_flush = false;
+        for (std::unique_ptr<buffer_shard>& shard : shards_)
+        {
+            std::unique_lock<mutex_type> l(shard->mtx_);
+            did_flush = flush_locked(*shard, l) || did_flush;
         }
+        return did_flush;
+    }
 
-        if (buffer_.empty())
+    bool coalescing_message_handler::flush_locked(buffer_shard& shard,
+        std::unique_lock<mutex_type>& l)
+    {
+        HPX_ASSERT(l.owns_lock());
+
+        if (shard.buffer_.empty())
             return false;
 
-        detail::message_buffer buff (buffer_.capacity());
-        std::swap(buff, buffer_);
+        if (adaptive_)
+            adapt_locked(shard);
 
-        ++num_messages_;
+        detail::message_buffer buff (shard.num_messages_per_buffer_);
+        std::swap(buff, shard.buffer_);
+
+        ++shard.num_messages_;
         l.unlock();
 
         HPX_ASSERT(nullptr != pp_);
@@ -245,19 +371,76 @@ namespace hpx { namespace plugins { namespace parcel
         return true;
     }
 
+    void coalescing_message_handler::adapt_locked(buffer_shard& shard)
+    {
+        double mean = (std::max)(shard.mean_time_between_parcels_, 1.);
+
+        // collect as many parcels as are expected to arrive during the
+        // longest acceptable delay
+        std::size_t num_messages =
+            std::size_t(1000. * double(max_interval_) / mean);
+
+        // don't let the coalesced messages grow beyond what the parcelport
+        // is allowed to send, use the average size of the parcels sent so far
+        boost::uint64_t num_parcels = pp_->get_parcel_send_count(false);
+        if (num_parcels != 0)
+        {
+            boost::uint64_t parcel_size =
+                pp_->get_data_sent(false) / num_parcels;
+            if (parcel_size != 0)
+            {
+                num_messages = (std::min)(num_messages, std::size_t(
+                    pp_->get_max_outbound_message_size() / parcel_size));
+            }
+        }
+
+        shard.num_messages_per_buffer_ = detail::clamp(num_messages,
+            min_num_messages_, max_num_messages_);
+
+        // allow for twice the expected time to fill the buffer before it is
+        // flushed anyways
+        shard.interval_ = detail::clamp(
+            std::size_t(
+                2. * double(shard.num_messages_per_buffer_) * mean / 1000.),
+            min_interval_, max_interval_);
+    }
+
+    boost::int64_t coalescing_message_handler::get_total_parcels() const
+    {
+        boost::int64_t num_parcels = 0;
+        for (std::unique_ptr<buffer_shard> const& shard : shards_)
+        {
+            std::lock_guard<mutex_type> l(shard->mtx_);
+            num_parcels += shard->num_parcels_;
+        }
+        return num_parcels;
+    }
+
+    boost::int64_t coalescing_message_handler::get_total_messages() const
+    {
+        boost::int64_t num_messages = 0;
+        for (std::unique_ptr<buffer_shard> const& shard : shards_)
+        {
+            std::lock_guard<mutex_type> l(shard->mtx_);
+            num_messages += shard->num_messages_;
+        }
+        return num_messages;
+    }
+
     // performance counter values
     boost::int64_t
     coalescing_message_handler::get_average_time_between_parcels(bool reset)
     {
         std::unique_lock<mutex_type> l(mtx_);
         boost::int64_t now = util::high_resolution_clock::now();
-        if (num_parcels_ == 0)
+        boost::int64_t total_parcels = get_total_parcels();
+        if (total_parcels == 0)
         {
             if (reset) started_at_ = now;
             return 0;
         }
 
-        boost::int64_t num_parcels = num_parcels_ - reset_time_num_parcels_;
+        boost::int64_t num_parcels = total_parcels - reset_time_num_parcels_;
         if (num_parcels == 0)
         {
             if (reset) started_at_ = now;
@@ -270,7 +453,7 @@ namespace hpx { namespace plugins { namespace parcel
         if (reset)
         {
             started_at_ = now;
-            reset_time_num_parcels_ = num_parcels_;
+            reset_time_num_parcels_ = total_parcels;
         }
 
         return value;
@@ -279,9 +462,10 @@ namespace hpx { namespace plugins { namespace parcel
     boost::int64_t coalescing_message_handler::get_parcels_count(bool reset)
     {
         std::unique_lock<mutex_type> l(mtx_);
-        boost::int64_t num_parcels = num_parcels_ - reset_num_parcels_;
+        boost::int64_t total_parcels = get_total_parcels();
+        boost::int64_t num_parcels = total_parcels - reset_num_parcels_;
         if (reset)
-            reset_num_parcels_ = num_parcels_;
+            reset_num_parcels_ = total_parcels;
         return num_parcels;
     }
 
@@ -289,26 +473,28 @@ namespace hpx { namespace plugins { namespace parcel
         coalescing_message_handler::get_parcels_per_message_count(bool reset)
     {
         std::unique_lock<mutex_type> l(mtx_);
+        boost::int64_t total_parcels = get_total_parcels();
+        boost::int64_t total_messages = get_total_messages();
 
-        if (num_messages_ == 0)
+        if (total_messages == 0)
         {
             if (reset)
             {
-                reset_num_parcels_per_message_parcels_ = num_parcels_;
-                reset_num_parcels_per_message_messages_ = num_messages_;
+                reset_num_parcels_per_message_parcels_ = total_parcels;
+                reset_num_parcels_per_message_messages_ = total_messages;
             }
             return 0;
         }
 
         boost::int64_t num_parcels =
-            num_parcels_ - reset_num_parcels_per_message_parcels_;
-        boost::int64_t
-            num_messages = num_messages_ - reset_num_parcels_per_message_messages_;
+            total_parcels - reset_num_parcels_per_message_parcels_;
+        boost::int64_t num_messages =
+            total_messages - reset_num_parcels_per_message_messages_;
 
         if (reset)
         {
-            reset_num_parcels_per_message_parcels_ = num_parcels_;
-            reset_num_parcels_per_message_messages_ = num_messages_;
+            reset_num_parcels_per_message_parcels_ = total_parcels;
+            reset_num_parcels_per_message_messages_ = total_messages;
         }
 
         if (num_messages == 0)
@@ -320,12 +506,37 @@ namespace hpx { namespace plugins { namespace parcel
     boost::int64_t coalescing_message_handler::get_messages_count(bool reset)
     {
         std::unique_lock<mutex_type> l(mtx_);
-        boost::int64_t num_messages = num_messages_ - reset_num_messages_;
+        boost::int64_t total_messages = get_total_messages();
+        boost::int64_t num_messages = total_messages - reset_num_messages_;
         if (reset)
-            reset_num_messages_ = num_messages_;
+            reset_num_messages_ = total_messages;
         return num_messages;
     }
 
+    // the current values are averaged over all buffers
+    boost::int64_t
+        coalescing_message_handler::get_max_parcels_per_message(bool reset)
+    {
+        boost::int64_t num_messages = 0;
+        for (std::unique_ptr<buffer_shard> const& shard : shards_)
+        {
+            std::lock_guard<mutex_type> l(shard->mtx_);
+            num_messages += shard->num_messages_per_buffer_;
+        }
+        return num_messages / boost::int64_t(shards_.size());
+    }
+
+    boost::int64_t coalescing_message_handler::get_flush_interval(bool reset)
+    {
+        boost::int64_t interval = 0;
+        for (std::unique_ptr<buffer_shard> const& shard : shards_)
+        {
+            std::lock_guard<mutex_type> l(shard->mtx_);
+            interval += shard->interval_;
+        }
+        return 1000 * interval / boost::int64_t(shards_.size());   // [ns]
+    }
+
     std::vector<boost::int64_t>
     coalescing_message_handler::get_time_between_parcels_histogram(bool reset)
     {
@@ -379,6 +590,7 @@ namespace hpx { namespace plugins { namespace parcel
             hpx::util::tag::histogram::min_range = double(min_boundary),
             hpx::util::tag::histogram::max_range = double(max_boundary)));
         last_parcel_time_ = util::high_resolution_clock::now();
+        collect_time_between_parcels_.store(true);
 
         result = util::bind(&coalescing_message_handler::
             get_time_between_parcels_histogram, this, util::placeholders::_1);
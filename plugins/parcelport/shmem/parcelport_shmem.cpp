@@ -0,0 +1,241 @@
+//  Copyright (c) 2026 agent
+//  Copyright (c) 2014-2015 Thomas Heller
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/traits/plugin_config_data.hpp>
+
+#include <hpx/plugins/parcelport_factory.hpp>
+#include <hpx/util/command_line_handling.hpp>
+
+// parcelport
+#include <hpx/runtime.hpp>
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/runtime/parcelset/parcelport_impl.hpp>
+
+#include <hpx/plugins/parcelport/shmem/locality.hpp>
+#include <hpx/plugins/parcelport/shmem/receiver.hpp>
+#include <hpx/plugins/parcelport/shmem/sender.hpp>
+
+#include <hpx/util/runtime_configuration.hpp>
+
+#include <boost/asio/ip/host_name.hpp>
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+
+#include <unistd.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace parcelset
+{
+    namespace policies { namespace shmem
+    {
+        class HPX_EXPORT parcelport;
+    }}
+
+    template <>
+    struct connection_handler_traits<policies::shmem::parcelport>
+    {
+        typedef policies::shmem::sender_connection connection_type;
+        typedef std::false_type send_early_parcel;
+        typedef std::true_type  do_background_work;
+        typedef std::true_type  use_connection_cache;
+
+        static const char * type()
+        {
+            return "shmem";
+        }
+
+        static const char * pool_name()
+        {
+            return "parcel-pool-shmem";
+        }
+
+        static const char * pool_name_postfix()
+        {
+            return "-shmem";
+        }
+    };
+
+    namespace policies { namespace shmem
+    {
+        void add_connection(sender * s,
+            std::shared_ptr<sender_connection> const &ptr)
+        {
+            s->add(ptr);
+        }
+
+        // The shared memory parcelport is used for communicating with
+        // localities running on the same host only, all other localities are
+        // reached through the other (enabled) parcelports. It can't be used
+        // to bootstrap the application.
+        class HPX_EXPORT parcelport
+          : public parcelport_impl<parcelport>
+        {
+            typedef parcelport_impl<parcelport> base_type;
+
+            static parcelset::locality here()
+            {
+                return
+                    parcelset::locality(
+                        locality(
+                            boost::asio::ip::host_name()
+                          , static_cast<boost::int32_t>(::getpid())
+                        )
+                    );
+            }
+
+            // Each slot is used by one connection while it is writing a
+            // message. Unless configured explicitly, make room for all other
+            // localities (any of which might be running on this node) using
+            // all of their regular and priority connections at the same time.
+            static std::size_t num_slots(util::runtime_configuration const& ini)
+            {
+                std::size_t slots = hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.shmem.slots", "0");
+                if (slots != 0)
+                    return slots;
+
+                std::size_t num_localities = ini.get_num_localities();
+                if (num_localities < 2)
+                    num_localities = 2;
+
+                return (num_localities - 1) * (max_connections_per_loc(ini) +
+                    max_priority_connections_per_loc(ini));
+            }
+
+        public:
+            parcelport(util::runtime_configuration const& ini,
+                util::function_nonser<void(std::size_t, char const*)> const& on_start,
+                util::function_nonser<void()> const& on_stop)
+              : base_type(ini, here(), on_start, on_stop)
+              , num_slots_(num_slots(ini))
+              , ring_size_(hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.shmem.ring_size", "1048576"))
+              , stopped_(true)
+              , receiver_(*this)
+            {}
+
+            /// Start the handling of connections.
+            bool do_run()
+            {
+                receiver_.run(here_.get<locality>(), num_slots_, ring_size_,
+                    get_max_inbound_message_size());
+                stopped_ = false;
+                return true;
+            }
+
+            /// Stop the handling of connectons.
+            void do_stop()
+            {
+                while(do_background_work(0))
+                {
+                    if(threads::get_self_ptr())
+                        hpx::this_thread::suspend(hpx::threads::pending,
+                            "shmem::parcelport::do_stop");
+                }
+                stopped_ = true;
+                sender_.clear();
+            }
+
+            /// Return the name of this locality
+            std::string get_locality_name() const
+            {
+                return boost::asio::ip::host_name();
+            }
+
+            /// Only localities running on the same host can be reached
+            bool can_connect(parcelset::locality const& dest,
+                bool use_alternative_parcelport)
+            {
+                return use_alternative_parcelport &&
+                    dest.get<locality>().address() ==
+                        here_.get<locality>().address();
+            }
+
+            std::shared_ptr<sender_connection> create_connection(
+                parcelset::locality const& l, error_code& ec)
+            {
+                return sender_.create_connection(l, parcels_sent_, ec);
+            }
+
+            parcelset::locality agas_locality(
+                util::runtime_configuration const & ini) const
+            {
+                return parcelset::locality(locality());
+            }
+
+            parcelset::locality create_locality() const
+            {
+                return parcelset::locality(locality());
+            }
+
+            bool background_work(std::size_t num_thread)
+            {
+                if (stopped_)
+                    return false;
+
+                bool has_work = false;
+                has_work = sender_.background_work();
+                has_work = receiver_.background_work(num_thread) || has_work;
+                return has_work;
+            }
+
+        private:
+            std::size_t num_slots_;
+            std::size_t ring_size_;
+
+            boost::atomic<bool> stopped_;
+
+            sender sender_;
+            receiver<parcelport> receiver_;
+        };
+    }}
+}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+namespace hpx { namespace traits
+{
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.parcel.shmem]
+    //      ...
+    //      priority = 10
+    //
+    template <>
+    struct plugin_config_data<hpx::parcelset::policies::shmem::parcelport>
+    {
+        static char const* priority()
+        {
+            return "10";
+        }
+
+        static void init(int *argc, char ***argv, util::command_line_handling &cfg)
+        {
+        }
+
+        static char const* call()
+        {
+            return
+                "enable = ${HPX_HAVE_PARCELPORT_SHMEM:0}\n"
+                "slots = ${HPX_PARCEL_SHMEM_SLOTS:0}\n"
+                "ring_size = ${HPX_PARCEL_SHMEM_RING_SIZE:1048576}\n"
+                ;
+        }
+    };
+}}
+
+HPX_REGISTER_PARCELPORT(
+    hpx::parcelset::policies::shmem::parcelport,
+    shmem);
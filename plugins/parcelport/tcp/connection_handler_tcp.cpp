@@ -60,6 +60,13 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
             util::function_nonser<void()> const& on_stop_thread)
       : base_type(ini, parcelport_address(ini), on_start_thread, on_stop_thread)
       , acceptor_(nullptr)
+      , receive_buffer_pool_(std::make_shared<util::size_class_pool<> >())
+      , gather_(hpx::util::get_entry_as<std::size_t>(
+                ini, "hpx.parcel.tcp.max_iovecs", "64"),
+            hpx::util::get_entry_as<std::size_t>(
+                ini, "hpx.parcel.tcp.max_gather_bytes", "65536"),
+            hpx::util::get_entry_as<std::size_t>(
+                ini, "hpx.parcel.tcp.gather_threshold", "4096"))
     {
         if (here_.type() != std::string("tcp")) {
             HPX_THROW_EXCEPTION(network_error, "tcp::parcelport::parcelport",
@@ -90,7 +97,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         {
             try {
                 std::shared_ptr<receiver> receiver_conn(
-                    new receiver(io_service, get_max_inbound_message_size(), *this));
+                    new receiver(io_service, get_max_inbound_message_size(),
+                        *this, receive_buffer_pool_));
 
                 tcp::endpoint ep = *it;
                 acceptor_->open(ep.protocol());
@@ -149,7 +157,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         // The parcel gets serialized inside the connection constructor, no
         // need to keep the original parcel alive after this call returned.
         std::shared_ptr<sender> sender_connection(new sender(
-            io_service, l, this->parcels_sent_));
+            io_service, l, this->parcels_sent_, gather_));
 
         // Connect to the target locality, retry if needed
         boost::system::error_code error = boost::asio::error::try_again;
@@ -269,6 +277,26 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         return parcelset::locality(locality());
     }
 
+    boost::int64_t connection_handler::get_buffer_pool_statistics(
+        buffer_pool_statistics_type t, bool reset)
+    {
+        switch (t) {
+            case buffer_pool_hits:
+                return receive_buffer_pool_->get_hits(reset);
+
+            case buffer_pool_misses:
+                return receive_buffer_pool_->get_misses(reset);
+
+            default:
+                break;
+        }
+
+        HPX_THROW_EXCEPTION(bad_parameter,
+            "tcp::connection_handler::get_buffer_pool_statistics",
+            "invalid buffer pool statistics type");
+        return 0;
+    }
+
     // accepted new incoming connection
     void connection_handler::handle_accept(boost::system::error_code const & e,
         std::shared_ptr<receiver> receiver_conn)
@@ -280,7 +308,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
             boost::asio::io_service& io_service = io_service_pool_.get_io_service();
             receiver_conn.reset(new receiver(io_service, get_max_inbound_message_size(),
-                *this));
+                *this, receive_buffer_pool_));
             acceptor_->async_accept(receiver_conn->socket(),
                 util::bind(&connection_handler::handle_accept,
                     this,
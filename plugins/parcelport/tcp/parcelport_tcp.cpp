@@ -33,7 +33,11 @@ namespace hpx { namespace traits
         }
         static char const* call()
         {
-            return "";
+            return
+                "max_iovecs = ${HPX_PARCEL_TCP_MAX_IOVECS:64}\n"
+                "max_gather_bytes = ${HPX_PARCEL_TCP_MAX_GATHER_BYTES:65536}\n"
+                "gather_threshold = ${HPX_PARCEL_TCP_GATHER_THRESHOLD:4096}\n"
+                ;
         }
     };
 }}
@@ -496,7 +496,9 @@ namespace hpx
             if (vm.count("hpx:high-priority-threads")) {
                 throw detail::command_line_error("Invalid command line option "
                     "--hpx:high-priority-threads, valid for "
-                    "--hpx:queuing=local-priority and "
+                    "--hpx:queuing=local-priority, "
+                    "--hpx:queuing=chase-lev-priority, "
+                    "--hpx:queuing=deadline, and "
                     "--hpx:queuing=abp-priority only");
             }
         }
@@ -648,6 +650,30 @@ namespace hpx
             return pu_step;
         }
 
+#if defined(HPX_HAVE_HIERARCHY_SCHEDULER)
+        // The arity of the levels of the hierarchy scheduler's tree of queues
+        // is given as a comma separated list (from the leaves to the root),
+        // the tree is derived from the machine topology if it's not given.
+        std::vector<std::size_t> get_hierarchy_arities(
+            util::command_line_handling const& cfg)
+        {
+            std::vector<std::size_t> arities;
+            if (!cfg.vm_.count("hpx:hierarchy-arity"))
+                return arities;
+
+            typedef hpx::threads::policies::hierarchy_scheduler<> queue_policy;
+            if (!queue_policy::parse_arities(
+                    cfg.vm_["hpx:hierarchy-arity"].as<std::string>(), arities))
+            {
+                throw detail::command_line_error(
+                    "Invalid command line option "
+                    "--hpx:hierarchy-arity, value must be 'topology' or a "
+                    "comma separated list of numbers larger than one.");
+            }
+            return arities;
+        }
+#endif
+
         std::size_t get_num_high_priority_queues(
             util::command_line_handling const& cfg)
         {
@@ -931,6 +957,44 @@ namespace hpx
                 std::move(startup), std::move(shutdown));
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // local scheduler with priority queue (one queue for each OS thread
+        // plus separate dequeues for low/high priority HPX-threads), the
+        // thread objects are kept track of without locking the queues
+        int run_priority_local_lockfree(startup_function_type startup,
+            shutdown_function_type shutdown,
+            util::command_line_handling& cfg, bool blocking)
+        {
+            ensure_hierarchy_arity_compatibility(cfg.vm_);
+
+            std::size_t num_high_priority_queues =
+                get_num_high_priority_queues(cfg);
+            std::size_t pu_offset = get_pu_offset(cfg);
+            std::size_t pu_step = get_pu_step(cfg);
+            std::string affinity_domain = get_affinity_domain(cfg);
+            std::string affinity_desc;
+            std::size_t numa_sensitive =
+                get_affinity_description(cfg, affinity_desc);
+
+            // scheduling policy
+            typedef hpx::threads::policies::lockfree_map_priority_queue_scheduler
+                local_queue_policy;
+            local_queue_policy::init_parameter_type init(
+                cfg.num_threads_, num_high_priority_queues, 1000,
+                numa_sensitive, "core-lockfree_map_priority_queue_scheduler");
+            threads::policies::init_affinity_data affinity_init(
+                pu_offset, pu_step, affinity_domain, affinity_desc);
+
+            // Build and configure this runtime instance.
+            typedef hpx::runtime_impl<local_queue_policy> runtime_type;
+            std::unique_ptr<hpx::runtime> rt(
+                new runtime_type(cfg.rtcfg_, cfg.mode_, cfg.num_threads_, init,
+                    affinity_init));
+
+            return run_or_start(blocking, std::move(rt), cfg,
+                std::move(startup), std::move(shutdown));
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // priority abp scheduler: local priority deques for each OS thread,
         // with work stealing from the "bottom" of each.
@@ -967,6 +1031,140 @@ namespace hpx
 #endif
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // priority Chase-Lev scheduler: local priority queues for each OS
+        // thread, each OS thread takes its own work from the bottom of its
+        // (Chase-Lev) deque, work stealing happens from the top.
+        int run_priority_chase_lev(startup_function_type startup,
+            shutdown_function_type shutdown,
+            util::command_line_handling& cfg, bool blocking)
+        {
+#if defined(HPX_HAVE_CHASE_LEV_SCHEDULER)
+            ensure_hierarchy_arity_compatibility(cfg.vm_);
+
+            std::size_t num_high_priority_queues =
+                get_num_high_priority_queues(cfg);
+            std::size_t pu_offset = get_pu_offset(cfg);
+            std::size_t pu_step = get_pu_step(cfg);
+            std::string affinity_domain = get_affinity_domain(cfg);
+            std::string affinity_desc;
+            std::size_t numa_sensitive =
+                get_affinity_description(cfg, affinity_desc);
+
+            // scheduling policy
+            typedef hpx::threads::policies::chase_lev_priority_queue_scheduler
+                local_queue_policy;
+            local_queue_policy::init_parameter_type init(
+                cfg.num_threads_, num_high_priority_queues, 1000,
+                numa_sensitive, "core-chase_lev_priority_queue_scheduler");
+            threads::policies::init_affinity_data affinity_init(
+                pu_offset, pu_step, affinity_domain, affinity_desc);
+
+            // Build and configure this runtime instance.
+            typedef hpx::runtime_impl<local_queue_policy> runtime_type;
+            std::unique_ptr<hpx::runtime> rt(
+                new runtime_type(cfg.rtcfg_, cfg.mode_, cfg.num_threads_, init,
+                    affinity_init));
+
+            return run_or_start(blocking, std::move(rt), cfg,
+                std::move(startup), std::move(shutdown));
+#else
+            throw detail::command_line_error("Command line option "
+                "--hpx:queuing=chase-lev-priority "
+                "is not configured in this build. Please rebuild with "
+                "'cmake -DHPX_WITH_THREAD_SCHEDULERS=chase-lev'.");
+#endif
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // deadline scheduler: local priority queues for each OS thread, the
+        // pending threads are ordered by their deadline (earliest deadline
+        // first)
+        int run_deadline(startup_function_type startup,
+            shutdown_function_type shutdown,
+            util::command_line_handling& cfg, bool blocking)
+        {
+#if defined(HPX_HAVE_DEADLINE_SCHEDULER)
+            ensure_hierarchy_arity_compatibility(cfg.vm_);
+
+            std::size_t num_high_priority_queues =
+                get_num_high_priority_queues(cfg);
+            std::size_t pu_offset = get_pu_offset(cfg);
+            std::size_t pu_step = get_pu_step(cfg);
+            std::string affinity_domain = get_affinity_domain(cfg);
+            std::string affinity_desc;
+            std::size_t numa_sensitive =
+                get_affinity_description(cfg, affinity_desc);
+
+            // scheduling policy
+            typedef hpx::threads::policies::deadline_queue_scheduler<>
+                local_queue_policy;
+            local_queue_policy::init_parameter_type init(
+                cfg.num_threads_, num_high_priority_queues, 1000,
+                numa_sensitive, "core-deadline_queue_scheduler");
+            threads::policies::init_affinity_data affinity_init(
+                pu_offset, pu_step, affinity_domain, affinity_desc);
+
+            // Build and configure this runtime instance.
+            typedef hpx::runtime_impl<local_queue_policy> runtime_type;
+            std::unique_ptr<hpx::runtime> rt(
+                new runtime_type(cfg.rtcfg_, cfg.mode_, cfg.num_threads_, init,
+                    affinity_init));
+
+            return run_or_start(blocking, std::move(rt), cfg,
+                std::move(startup), std::move(shutdown));
+#else
+            throw detail::command_line_error("Command line option "
+                "--hpx:queuing=deadline "
+                "is not configured in this build. Please rebuild with "
+                "'cmake -DHPX_WITH_THREAD_SCHEDULERS=deadline'.");
+#endif
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Chase-Lev scheduler: local scheduler (one queue for each OS thread),
+        // each OS thread takes its own work from the bottom of its (Chase-Lev)
+        // deque, work stealing happens from the top.
+        int run_chase_lev(startup_function_type startup,
+            shutdown_function_type shutdown,
+            util::command_line_handling& cfg, bool blocking)
+        {
+#if defined(HPX_HAVE_CHASE_LEV_SCHEDULER) && defined(HPX_HAVE_LOCAL_SCHEDULER)
+            ensure_high_priority_compatibility(cfg.vm_);
+            ensure_hierarchy_arity_compatibility(cfg.vm_);
+
+            std::size_t pu_offset = get_pu_offset(cfg);
+            std::size_t pu_step = get_pu_step(cfg);
+            std::string affinity_domain = get_affinity_domain(cfg);
+            std::string affinity_desc;
+            std::size_t numa_sensitive =
+                get_affinity_description(cfg, affinity_desc);
+
+            // scheduling policy
+            typedef hpx::threads::policies::chase_lev_queue_scheduler
+                local_queue_policy;
+            local_queue_policy::init_parameter_type init(
+                cfg.num_threads_, 1000, numa_sensitive,
+                "core-chase_lev_queue_scheduler");
+            threads::policies::init_affinity_data affinity_init(
+                pu_offset, pu_step, affinity_domain, affinity_desc);
+
+            // Build and configure this runtime instance.
+            typedef hpx::runtime_impl<local_queue_policy> runtime_type;
+            std::unique_ptr<hpx::runtime> rt(
+                new runtime_type(cfg.rtcfg_, cfg.mode_, cfg.num_threads_, init,
+                    affinity_init));
+
+            return run_or_start(blocking, std::move(rt), cfg,
+                std::move(startup), std::move(shutdown));
+#else
+            throw detail::command_line_error("Command line option "
+                "--hpx:queuing=chase-lev "
+                "is not configured in this build. Please rebuild with "
+                "'cmake -DHPX_WITH_THREAD_SCHEDULERS=chase-lev;local'.");
+#endif
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // hierarchical scheduler: The thread queues are built up hierarchically
         // this avoids contention during work stealing
@@ -981,12 +1179,9 @@ namespace hpx
 
             // scheduling policy
             typedef hpx::threads::policies::hierarchy_scheduler<> queue_policy;
-            std::size_t arity = 2;
-            if (cfg.vm_.count("hpx:hierarchy-arity"))
-                arity = cfg.vm_["hpx:hierarchy-arity"].as<std::size_t>();
-
-            queue_policy::init_parameter_type init(cfg.num_threads_, arity,
-                1000, 0, "core-hierarchy_scheduler");
+            queue_policy::init_parameter_type init(cfg.num_threads_,
+                get_hierarchy_arities(cfg), 1000, false,
+                "core-hierarchy_scheduler");
 
             // Build and configure this runtime instance.
             typedef hpx::runtime_impl<queue_policy> runtime_type;
@@ -1115,6 +1310,15 @@ namespace hpx
                     result = run_priority_local(std::move(startup),
                         std::move(shutdown), cfg, blocking);
                 }
+                else if (0 == std::string("local-priority-lockfree").find(
+                    cfg.queuing_))
+                {
+                    // same as local-priority, but keeps track of the thread
+                    // objects without locking the queues
+                    cfg.queuing_ = "local-priority-lockfree";
+                    result = run_priority_local_lockfree(std::move(startup),
+                        std::move(shutdown), cfg, blocking);
+                }
                 else if (0 == std::string("static-priority").find(cfg.queuing_))
                 {
                     cfg.queuing_ = "static-priority";
@@ -1130,6 +1334,30 @@ namespace hpx
                     result = run_priority_abp(std::move(startup),
                         std::move(shutdown), cfg, blocking);
                 }
+                else if (0 == std::string("chase-lev").find(cfg.queuing_))
+                {
+                    // local scheduler with one Chase-Lev deque for each OS
+                    // thread
+                    cfg.queuing_ = "chase-lev";
+                    result = run_chase_lev(std::move(startup),
+                        std::move(shutdown), cfg, blocking);
+                }
+                else if (0 == std::string("chase-lev-priority").find(cfg.queuing_))
+                {
+                    // local scheduler with priority queues, uses one
+                    // Chase-Lev deque for each OS thread
+                    cfg.queuing_ = "chase-lev-priority";
+                    result = run_priority_chase_lev(std::move(startup),
+                        std::move(shutdown), cfg, blocking);
+                }
+                else if (0 == std::string("deadline").find(cfg.queuing_))
+                {
+                    // local scheduler with priority queues, the threads are
+                    // run in the order of their deadlines
+                    cfg.queuing_ = "deadline";
+                    result = run_deadline(std::move(startup),
+                        std::move(shutdown), cfg, blocking);
+                }
                 else if (0 == std::string("hierarchy").find(cfg.queuing_))
                 {
                     // hierarchy scheduler: tree of queues, with work
@@ -30,6 +30,7 @@
 #include <hpx/runtime/find_localities.hpp>
 #include <hpx/runtime/naming/split_gid.hpp>
 #include <hpx/util/bind.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util/logging.hpp>
 #include <hpx/util/runtime_configuration.hpp>
 #include <hpx/util/safe_lexical_cast.hpp>
@@ -40,6 +41,7 @@
 #include <hpx/performance_counters/counter_creators.hpp>
 #include <hpx/performance_counters/manage_counter_type.hpp>
 #include <hpx/lcos/wait_all.hpp>
+#include <hpx/lcos/when_all.hpp>
 #include <hpx/lcos/broadcast.hpp>
 
 #include <boost/format.hpp>
@@ -119,17 +121,43 @@ struct addressing_service::gva_cache_key
     }
 }; // }}}
 
+struct addressing_service::gva_cache_sharding
+{ // {{{ gva_cache_sharding implementation
+    // Consecutive gids are stored in consecutive shards, which spreads
+    // objects created one after another over all of the shards. Ranges are
+    // stored once, in the cache shared by all shards.
+    std::size_t operator()(
+        gva_cache_key const& key
+      , std::size_t num_shards
+        ) const
+    {
+        if (key.get_count() != 1)
+            return num_shards;
+
+        naming::gid_type const gid = key.get_gid();
+        return static_cast<std::size_t>(
+            (gid.get_lsb() + gid.get_msb() * 0x9e3779b97f4a7c15ull) %
+                num_shards);
+    }
+}; // }}}
+
 addressing_service::addressing_service(
     parcelset::parcelhandler& ph
   , util::runtime_configuration const& ini_
   , runtime_mode runtime_type_
     )
-  : gva_cache_(new gva_cache_type)
+  : gva_cache_(new gva_cache_type(ini_.get_agas_local_cache_shards()))
   , console_cache_(naming::invalid_locality_id)
   , max_refcnt_requests_(ini_.get_agas_max_pending_refcnt_requests())
-  , refcnt_requests_count_(0)
   , enable_refcnt_caching_(true)
-  , refcnt_requests_(new refcnt_requests_type)
+  , refcnt_requests_timer_(
+        util::bind(&addressing_service::flush_refcnt_requests, this)
+      , boost::int64_t(ini_.get_agas_refcnt_flush_interval()) * 1000
+      , "addressing_service::flush_refcnt_requests", true)
+    // the timer is started once the runtime is up (see initialize)
+  , refcnt_requests_timer_started_(true)
+  , refcnt_requests_coalesced_(0)
+  , refcnt_requests_sent_(0)
   , service_type(ini_.get_agas_service_mode())
   , runtime_type(runtime_type_)
   , caching_(ini_.get_agas_caching_mode())
@@ -176,6 +204,19 @@ void addressing_service::initialize(parcelset::parcelhandler& ph,
             client_->get_primary_ns_ptr(), client_->get_symbol_ns_ptr());
     }
 
+    // Start the timer flushing the pending decrements once the runtime is
+    // up. Starting it for the first time registers its termination as a
+    // pre-shutdown function, which is not possible anymore once the runtime
+    // is shutting down. A flush interval of zero disables the timer.
+    if (refcnt_requests_timer_.get_interval() != 0)
+    {
+        register_startup_function(
+            [this]()
+            {
+                refcnt_requests_timer_.start(false);
+            });
+    }
+
     set_status(state_running);
 } // }}}
 
@@ -1410,6 +1451,112 @@ hpx::future<naming::address> addressing_service::resolve_async(
     return resolve_full_async(gid);
 }
 
+hpx::future<std::vector<naming::address> > addressing_service::resolve_async(
+    std::vector<naming::gid_type> const& gids
+    )
+{
+    typedef std::vector<naming::address> addresses_type;
+
+    std::shared_ptr<addresses_type> addrs =
+        std::make_shared<addresses_type>(gids.size());
+
+    // Try the cache, group all remaining ids by the primary namespace
+    // instance responsible for them.
+    std::map<naming::gid_type, std::vector<std::size_t> > unresolved;
+    for (std::size_t i = 0; i != gids.size(); ++i)
+    {
+        naming::gid_type const& gid = gids[i];
+        if (!gid)
+        {
+            return hpx::make_exceptional_future<addresses_type>(
+                HPX_GET_EXCEPTION(bad_parameter,
+                    "addressing_service::resolve_async",
+                    "invalid reference id"));
+        }
+
+        if (caching_)
+        {
+            error_code ec;
+            if (resolve_cached(gid, (*addrs)[i], ec))
+                continue;
+
+            if (ec)
+            {
+                return hpx::make_exceptional_future<addresses_type>(
+                    hpx::detail::access_exception(ec));
+            }
+        }
+
+        unresolved[stubs::primary_namespace::get_service_instance(gid)].
+            push_back(i);
+    }
+
+    if (unresolved.empty())
+        return make_ready_future(std::move(*addrs));
+
+    // now ask each of the involved AGAS services for all of its ids at once
+    std::vector<future<void> > lazy_results;
+    lazy_results.reserve(unresolved.size());
+
+    using util::placeholders::_1;
+    for (auto& p : unresolved)
+    {
+        std::vector<naming::gid_type> ids;
+        std::vector<request> reqs;
+        ids.reserve(p.second.size());
+        reqs.reserve(p.second.size());
+
+        for (std::size_t i : p.second)
+        {
+            ids.push_back(gids[i]);
+            reqs.push_back(request(primary_ns_resolve_gid, gids[i]));
+        }
+
+        naming::id_type target(p.first, naming::id_type::unmanaged);
+        future<std::vector<response> > f =
+            stubs::primary_namespace::bulk_service_async(
+                target, std::move(reqs), action_priority_);
+
+        lazy_results.push_back(f.then(util::bind(
+                util::one_shot(&addressing_service::resolve_bulk_postproc),
+                this, _1, std::move(ids), std::move(p.second), addrs
+            )));
+    }
+
+    return hpx::when_all(lazy_results).then(
+        [addrs](future<std::vector<future<void> > > f) -> addresses_type
+        {
+            // propagate errors, if any
+            for (future<void>& r : f.get())
+                r.get();
+
+            return std::move(*addrs);
+        });
+}
+
+hpx::future<std::vector<naming::address> > addressing_service::resolve_async(
+    std::vector<naming::id_type> const& ids
+    )
+{
+    std::vector<naming::gid_type> gids;
+    gids.reserve(ids.size());
+
+    for (naming::id_type const& id : ids)
+    {
+        if (!id)
+        {
+            return hpx::make_exceptional_future<
+                    std::vector<naming::address>
+                >(HPX_GET_EXCEPTION(bad_parameter,
+                    "addressing_service::resolve_async",
+                    "invalid reference id"));
+        }
+        gids.push_back(id.get_gid());
+    }
+
+    return resolve_async(gids);
+}
+
 hpx::future<naming::id_type> addressing_service::get_colocation_id_async(
     naming::id_type const& id
     )
@@ -1435,14 +1582,20 @@ hpx::future<naming::id_type> addressing_service::get_colocation_id_async(
 naming::address addressing_service::resolve_full_postproc(
     future<response> f, naming::gid_type const& id
     )
+{
+    return resolve_response(f.get(), id);
+}
+
+naming::address addressing_service::resolve_response(
+    response const& rep, naming::gid_type const& id
+    )
 {
     naming::address addr;
 
-    response rep = f.get();
     if (success != rep.get_status())
     {
         HPX_THROW_EXCEPTION(bad_parameter,
-            "addressing_service::resolve_full_postproc",
+            "addressing_service::resolve_response",
             "could no resolve global id");
         return addr;
     }
@@ -1475,6 +1628,28 @@ naming::address addressing_service::resolve_full_postproc(
     return addr;
 }
 
+void addressing_service::resolve_bulk_postproc(
+    future<std::vector<response> > f
+  , std::vector<naming::gid_type> const& ids
+  , std::vector<std::size_t> const& indices
+  , std::shared_ptr<std::vector<naming::address> > const& addrs
+    )
+{
+    HPX_ASSERT(ids.size() == indices.size());
+
+    std::vector<response> reps = f.get();
+    if (reps.size() != ids.size())
+    {
+        HPX_THROW_EXCEPTION(bad_parameter,
+            "addressing_service::resolve_bulk_postproc",
+            "could not resolve all of the given global ids");
+        return;
+    }
+
+    for (std::size_t i = 0; i != reps.size(); ++i)
+        (*addrs)[indices[i]] = resolve_response(reps[i], ids[i]);
+}
+
 hpx::future<naming::address> addressing_service::resolve_full_async(
     naming::gid_type const& gid
     )
@@ -1788,10 +1963,16 @@ lcos::future<boost::int64_t> addressing_service::incref_async(
     {
         std::lock_guard<mutex_type> l(refcnt_requests_mtx_);
 
+        typedef refcnt_requests_batches_type::iterator batch_iterator;
         typedef refcnt_requests_type::iterator iterator;
 
-        iterator matches = refcnt_requests_->find(raw);
-        if (matches != refcnt_requests_->end())
+        batch_iterator batch = refcnt_requests_.find(
+            naming::get_locality_id_from_gid(raw));
+
+        iterator matches;
+        if (batch != refcnt_requests_.end() &&
+            (matches = batch->second.requests_.find(raw)) !=
+                batch->second.requests_.end())
         {
             pending_decrefs = matches->second;
             matches->second += credit;
@@ -1808,17 +1989,20 @@ lcos::future<boost::int64_t> addressing_service::incref_async(
                 pending_incref = mapping(matches->first, matches->second);
                 has_pending_incref = true;
 
-                refcnt_requests_->erase(matches);
+                batch->second.requests_.erase(matches);
+                ++refcnt_requests_coalesced_;
             }
             else if (matches->second == 0)
             {
                 // credit == decref (case no. 3): if the incref offsets any
                 // pending decref, just remove the pending decref request.
-                refcnt_requests_->erase(matches);
+                batch->second.requests_.erase(matches);
+                refcnt_requests_coalesced_ += 2;
             }
             else
             {
                 // credit < decref (case no. 2): do nothing
+                ++refcnt_requests_coalesced_;
             }
         }
         else
@@ -1838,6 +2022,8 @@ lcos::future<boost::int64_t> addressing_service::incref_async(
     naming::gid_type const e_lower = pending_incref.first;
     request req(primary_ns_increment_credit, e_lower, e_lower, pending_incref.second);
 
+    ++refcnt_requests_sent_;
+
     naming::id_type target(
         stubs::primary_namespace::get_service_instance(e_lower)
       , naming::id_type::unmanaged);
@@ -1889,21 +2075,29 @@ void addressing_service::decref(
     }
 
     try {
+        boost::uint32_t const locality_id =
+            naming::get_locality_id_from_gid(raw);
+
         std::unique_lock<mutex_type> l(refcnt_requests_mtx_);
 
-        // Match the decref request with entries in the incref table
+        // Match the decref request with the pending requests for the
+        // locality owning the object
         typedef refcnt_requests_type::iterator iterator;
         typedef refcnt_requests_type::value_type mapping;
 
-        iterator matches = refcnt_requests_->find(raw);
-        if (matches != refcnt_requests_->end())
+        refcnt_requests_batch& batch = refcnt_requests_[locality_id];
+        ++batch.count_;
+
+        iterator matches = batch.requests_.find(raw);
+        if (matches != batch.requests_.end())
         {
             matches->second -= credit;
+            ++refcnt_requests_coalesced_;
         }
         else
         {
             std::pair<iterator, bool> p =
-                refcnt_requests_->insert(mapping(raw, -credit));
+                batch.requests_.insert(mapping(raw, -credit));
 
             if (HPX_UNLIKELY(!p.second))
             {
@@ -1917,7 +2111,20 @@ void addressing_service::decref(
             }
         }
 
-        send_refcnt_requests(l, ec);
+        // make sure the pending requests are eventually sent, even if the
+        // threshold is never reached, the timer stops whenever it finds
+        // nothing to flush
+        bool const start_timer = enable_refcnt_caching_ &&
+            !refcnt_requests_timer_started_.exchange(true);
+
+        send_refcnt_requests(l, locality_id, ec);
+
+        if (start_timer)
+        {
+            if (l.owns_lock())
+                l.unlock();
+            refcnt_requests_timer_.start(false);
+        }
     }
     catch (hpx::exception const& e) {
         HPX_RETHROWS_IF(ec, e, "addressing_service::decref");
@@ -2218,32 +2425,29 @@ void addressing_service::update_cache_entry(
 
         const gva_cache_key key(gid, count);
 
+        if (!gva_cache_->update_if(key, g, check_for_collisions))
         {
-            std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-            if (!gva_cache_->update_if(key, g, check_for_collisions))
+            if (LAGAS_ENABLED(warning))
             {
-                if (LAGAS_ENABLED(warning))
+                // Figure out who we collided with.
+                addressing_service::gva_cache_key idbase;
+                addressing_service::gva_cache_type::entry_type e;
+
+                if (!gva_cache_->get_entry(key, idbase, e))
                 {
-                    // Figure out who we collided with.
-                    addressing_service::gva_cache_key idbase;
-                    addressing_service::gva_cache_type::entry_type e;
-
-                    if (!gva_cache_->get_entry(key, idbase, e))
-                    {
-                        // This is impossible under sane conditions.
-                        HPX_THROWS_IF(ec, invalid_data
-                          , "addressing_service::update_cache_entry"
-                          , "data corruption or lock error occurred in cache");
-                        return;
-                    }
-
-                    LAGAS_(warning) <<
-                        ( boost::format(
-                            "addressing_service::update_cache_entry, "
-                            "aborting update due to key collision in cache, "
-                            "new_gid(%1%), new_count(%2%), old_gid(%3%), old_count(%4%)"
-                        ) % gid % count % idbase.get_gid() % idbase.get_count());
+                    // This is impossible under sane conditions.
+                    HPX_THROWS_IF(ec, invalid_data
+                      , "addressing_service::update_cache_entry"
+                      , "data corruption or lock error occurred in cache");
+                    return;
                 }
+
+                LAGAS_(warning) <<
+                    ( boost::format(
+                        "addressing_service::update_cache_entry, "
+                        "aborting update due to key collision in cache, "
+                        "new_gid(%1%), new_count(%2%), old_gid(%3%), old_count(%4%)"
+                    ) % gid % count % idbase.get_gid() % idbase.get_count());
             }
         }
 
@@ -2271,7 +2475,6 @@ bool addressing_service::get_cache_entry(
     gva_cache_key k(gid);
     gva_cache_key idbase_key;
 
-    std::unique_lock<mutex_type> lock(gva_cache_mtx_);
     if(gva_cache_->get_entry(k, idbase_key, gva))
     {
         const boost::uint64_t id_msb =
@@ -2279,7 +2482,6 @@ bool addressing_service::get_cache_entry(
 
         if (HPX_UNLIKELY(id_msb != idbase_key.get_gid().get_msb()))
         {
-            lock.unlock();
             HPX_THROWS_IF(ec, internal_server_error
               , "addressing_service::get_cache_entry"
               , "bad entry in cache, MSBs of GID base and GID do not match");
@@ -2308,8 +2510,6 @@ void addressing_service::clear_cache(
     try {
         LAGAS_(warning) << "addressing_service::clear_cache, clearing cache";
 
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-
         gva_cache_->clear();
 
         if (&ec != &throws)
@@ -2355,8 +2555,6 @@ void addressing_service::remove_cache_entry(
     try {
         LAGAS_(warning) << "addressing_service::remove_cache_entry";
 
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-
         gva_cache_->erase(
             [&gid](std::pair<gva_cache_key, gva> const& p)
             {
@@ -2536,81 +2734,126 @@ bool addressing_service::retrieve_statistics_counter(
 // Helper functions to access the current cache statistics
 boost::uint64_t addressing_service::get_cache_entries(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->size();
 }
 
 boost::uint64_t addressing_service::get_cache_hits(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().hits(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& stat)
+        {
+            return boost::int64_t(stat.hits(reset));
+        });
 }
 
 boost::uint64_t addressing_service::get_cache_misses(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().misses(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& stat)
+        {
+            return boost::int64_t(stat.misses(reset));
+        });
 }
 
 boost::uint64_t addressing_service::get_cache_evictions(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().evictions(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& stat)
+        {
+            return boost::int64_t(stat.evictions(reset));
+        });
 }
 
 boost::uint64_t addressing_service::get_cache_insertions(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().insertions(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& stat)
+        {
+            return boost::int64_t(stat.insertions(reset));
+        });
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 boost::uint64_t addressing_service::get_cache_get_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_get_entry_count(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& stat)
+        {
+            return boost::int64_t(stat.get_get_entry_count(reset));
+        });
 }
 
 boost::uint64_t addressing_service::get_cache_insertion_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_insert_entry_count(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& stat)
+        {
+            return boost::int64_t(stat.get_insert_entry_count(reset));
+        });
 }
 
 boost::uint64_t addressing_service::get_cache_update_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_update_entry_count(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& stat)
+        {
+            return boost::int64_t(stat.get_update_entry_count(reset));
+        });
 }
 
 boost::uint64_t addressing_service::get_cache_erase_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_erase_entry_count(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& stat)
+        {
+            return boost::int64_t(stat.get_erase_entry_count(reset));
+        });
 }
 
 boost::uint64_t addressing_service::get_cache_get_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_get_entry_time(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& stat)
+        {
+            return boost::int64_t(stat.get_get_entry_time(reset));
+        });
 }
 
 boost::uint64_t addressing_service::get_cache_insertion_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_insert_entry_time(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& stat)
+        {
+            return boost::int64_t(stat.get_insert_entry_time(reset));
+        });
 }
 
 boost::uint64_t addressing_service::get_cache_update_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_update_entry_time(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& stat)
+        {
+            return boost::int64_t(stat.get_update_entry_time(reset));
+        });
 }
 
 boost::uint64_t addressing_service::get_cache_erase_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_erase_entry_time(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& stat)
+        {
+            return boost::int64_t(stat.get_erase_entry_time(reset));
+        });
+}
+
+boost::uint64_t addressing_service::get_refcnt_requests_coalesced(bool reset)
+{
+    return util::get_and_reset_value(refcnt_requests_coalesced_, reset);
+}
+
+boost::uint64_t addressing_service::get_refcnt_requests_sent(bool reset)
+{
+    return util::get_and_reset_value(refcnt_requests_sent_, reset);
 }
 
 /// Install performance counter types exposing properties from the local cache.
@@ -2657,6 +2900,13 @@ void addressing_service::register_counter_types()
         util::bind(
             &addressing_service::get_cache_erase_entry_time, this, _1));
 
+    util::function_nonser<boost::int64_t(bool)> refcnt_requests_coalesced(
+        util::bind(
+            &addressing_service::get_refcnt_requests_coalesced, this, _1));
+    util::function_nonser<boost::int64_t(bool)> refcnt_requests_sent(
+        util::bind(
+            &addressing_service::get_refcnt_requests_sent, this, _1));
+
     performance_counters::generic_counter_type_data const counter_types[] =
     {
         { "/agas/count/cache/entries", performance_counters::counter_raw,
@@ -2771,6 +3021,27 @@ void addressing_service::register_counter_types()
           &performance_counters::locality_counter_discoverer,
           ""
         },
+        { "/agas/count/refcnt_requests/coalesced",
+          performance_counters::counter_raw,
+          "returns the number of reference count increments and decrements "
+                "which were merged with pending decrements instead of being "
+                "sent to AGAS",
+          HPX_PERFORMANCE_COUNTER_V1,
+          util::bind(&performance_counters::locality_raw_counter_creator,
+              _1, refcnt_requests_coalesced, _2),
+          &performance_counters::locality_counter_discoverer,
+          ""
+        },
+        { "/agas/count/refcnt_requests/sent",
+          performance_counters::counter_raw,
+          "returns the number of reference count increments and decrements "
+                "sent to AGAS",
+          HPX_PERFORMANCE_COUNTER_V1,
+          util::bind(&performance_counters::locality_raw_counter_creator,
+              _1, refcnt_requests_sent, _2),
+          &performance_counters::locality_counter_discoverer,
+          ""
+        },
     };
     performance_counters::install_counter_types(
         counter_types, sizeof(counter_types)/sizeof(counter_types[0]));
@@ -2806,6 +3077,7 @@ void addressing_service::garbage_collect(
 
 void addressing_service::send_refcnt_requests(
     std::unique_lock<addressing_service::mutex_type>& l
+  , boost::uint32_t locality_id
   , error_code& ec
     )
 {
@@ -2817,22 +3089,76 @@ void addressing_service::send_refcnt_requests(
         return;
     }
 
-    if (!enable_refcnt_caching_ || max_refcnt_requests_ == ++refcnt_requests_count_)
+    if (!enable_refcnt_caching_)
+    {
         send_refcnt_requests_non_blocking(l, ec);
+        return;
+    }
 
-    else if (&ec != &throws)
-        ec = make_success_code();
+    refcnt_requests_batches_type::iterator it =
+        refcnt_requests_.find(locality_id);
+    if (it == refcnt_requests_.end() ||
+        it->second.count_ < max_refcnt_requests_)
+    {
+        if (&ec != &throws)
+            ec = make_success_code();
+        return;
+    }
+
+    // The requests for this locality have reached the threshold, send them
+    // from a separate thread to avoid blocking the caller.
+    std::shared_ptr<refcnt_requests_type> requests =
+        std::make_shared<refcnt_requests_type>();
+
+    requests->swap(it->second.requests_);
+    refcnt_requests_.erase(it);
+
+    l.unlock();
+
+    threads::register_thread_nullary(
+        [this, requests]()
+        {
+            send_refcnt_requests_batch_non_blocking(*requests);
+        },
+        "addressing_service::send_refcnt_requests", threads::pending, true,
+        threads::thread_priority_normal, std::size_t(-1),
+        threads::thread_stacksize_default, ec);
+}
+
+bool addressing_service::flush_refcnt_requests()
+{
+    std::unique_lock<mutex_type> l(refcnt_requests_mtx_, std::try_to_lock);
+    if (!l.owns_lock())
+        return true;        // somebody else is sending, try again later
+
+    bool empty = true;
+    for (refcnt_requests_batches_type::const_reference b : refcnt_requests_)
+    {
+        if (!b.second.requests_.empty())
+        {
+            empty = false;
+            break;
+        }
+    }
+
+    if (empty)
+    {
+        // stop the timer, the next buffered decrement restarts it
+        refcnt_requests_timer_started_ = false;
+        return false;
+    }
+
+    error_code ec(lightweight);
+    send_refcnt_requests_non_blocking(l, ec);
+    return true;            // keep the timer running
 }
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
     void dump_refcnt_requests(
-        std::unique_lock<addressing_service::mutex_type>& l
-      , addressing_service::refcnt_requests_type const& requests
+        addressing_service::refcnt_requests_type const& requests
       , const char* func_name
         )
     {
-        HPX_ASSERT(l.owns_lock());
-
         std::stringstream ss;
         ss << ( boost::format(
               "%1%, dumping client-side refcnt table, requests(%2%):")
@@ -2855,6 +3181,42 @@ void addressing_service::send_refcnt_requests(
     }
 #endif
 
+// Send the pending decrements for the gids owned by one locality
+void addressing_service::send_refcnt_requests_batch_non_blocking(
+    refcnt_requests_type const& requests
+    )
+{
+    // all pending decrements might have been compensated by increments
+    if (requests.empty())
+        return;
+
+#if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
+    if (LAGAS_ENABLED(debug))
+        dump_refcnt_requests(requests,
+            "addressing_service::send_refcnt_requests_non_blocking");
+#endif
+
+    std::vector<request> reqs;
+    reqs.reserve(requests.size());
+
+    for (refcnt_requests_type::const_reference e : requests)
+    {
+        HPX_ASSERT(e.second < 0);
+
+        naming::gid_type raw(e.first);
+        reqs.push_back(request(primary_ns_decrement_credit, raw, raw, e.second));
+    }
+
+    naming::id_type target(
+        stubs::primary_namespace::get_service_instance(requests.begin()->first)
+      , naming::id_type::unmanaged);
+
+    refcnt_requests_sent_ += reqs.size();
+
+    stubs::primary_namespace::bulk_service_non_blocking(
+        target, std::move(reqs), action_priority_);
+}
+
 void addressing_service::send_refcnt_requests_non_blocking(
     std::unique_lock<addressing_service::mutex_type>& l
   , error_code& ec
@@ -2863,55 +3225,25 @@ void addressing_service::send_refcnt_requests_non_blocking(
     HPX_ASSERT(l.owns_lock());
 
     try {
-        if (refcnt_requests_->empty())
+        if (refcnt_requests_.empty())
         {
             l.unlock();
             return;
         }
 
-        std::shared_ptr<refcnt_requests_type> p(new refcnt_requests_type);
-
-        p.swap(refcnt_requests_);
-        refcnt_requests_count_ = 0;
+        refcnt_requests_batches_type batches;
+        batches.swap(refcnt_requests_);
 
         l.unlock();
 
         LAGAS_(info) << (boost::format(
             "addressing_service::send_refcnt_requests_non_blocking, "
-            "requests(%1%)")
-            % p->size());
+            "localities(%1%)")
+            % batches.size());
 
-#if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-        if (LAGAS_ENABLED(debug))
-            dump_refcnt_requests(l, *p,
-                "addressing_service::send_refcnt_requests_non_blocking");
-#endif
-
-        // collect all requests for each locality
-        typedef std::map<naming::id_type, std::vector<request> > requests_type;
-        requests_type requests;
-
-        for (refcnt_requests_type::const_reference e : *p)
-        {
-            HPX_ASSERT(e.second < 0);
-
-            naming::gid_type raw(e.first);
-            request req(primary_ns_decrement_credit, raw, raw, e.second);
-
-            naming::id_type target(
-                stubs::primary_namespace::get_service_instance(raw)
-              , naming::id_type::unmanaged);
-
-            requests[target].push_back(std::move(req));
-        }
-
-        // send requests to all locality
-        requests_type::iterator end = requests.end();
-        for (requests_type::iterator it = requests.begin(); it != end; ++it)
-        {
-            stubs::primary_namespace::bulk_service_non_blocking(
-                (*it).first, std::move((*it).second), action_priority_);
-        }
+        // send requests to all localities
+        for (refcnt_requests_batches_type::const_reference b : batches)
+            send_refcnt_requests_batch_non_blocking(b.second.requests_);
 
         if (&ec != &throws)
             ec = make_success_code();
@@ -2929,56 +3261,58 @@ addressing_service::send_refcnt_requests_async(
 {
     HPX_ASSERT(l.owns_lock());
 
-    if (refcnt_requests_->empty())
+    if (refcnt_requests_.empty())
     {
         l.unlock();
         return std::vector<hpx::future<std::vector<response> > >();
     }
 
-    std::shared_ptr<refcnt_requests_type> p(new refcnt_requests_type);
-
-    p.swap(refcnt_requests_);
-    refcnt_requests_count_ = 0;
+    refcnt_requests_batches_type batches;
+    batches.swap(refcnt_requests_);
 
     l.unlock();
 
     LAGAS_(info) << (boost::format(
         "addressing_service::send_refcnt_requests_async, "
-        "requests(%1%)")
-        % p->size());
+        "localities(%1%)")
+        % batches.size());
+
+    // send requests to all localities
+    std::vector<hpx::future<std::vector<response> > > lazy_results;
+    for (refcnt_requests_batches_type::const_reference b : batches)
+    {
+        refcnt_requests_type const& requests = b.second.requests_;
+        if (requests.empty())
+            continue;
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-    if (LAGAS_ENABLED(debug))
-        dump_refcnt_requests(l, *p,
-            "addressing_service::send_refcnt_requests_sync");
+        if (LAGAS_ENABLED(debug))
+            dump_refcnt_requests(requests,
+                "addressing_service::send_refcnt_requests_sync");
 #endif
 
-    // collect all requests for each locality
-    typedef std::map<naming::id_type, std::vector<request> > requests_type;
-    requests_type requests;
+        std::vector<request> reqs;
+        reqs.reserve(requests.size());
 
-    std::vector<hpx::future<std::vector<response> > > lazy_results;
-    for (refcnt_requests_type::const_reference e : *p)
-    {
-        HPX_ASSERT(e.second < 0);
+        for (refcnt_requests_type::const_reference e : requests)
+        {
+            HPX_ASSERT(e.second < 0);
 
-        naming::gid_type raw(e.first);
-        request const req(primary_ns_decrement_credit, raw, raw, e.second);
+            naming::gid_type raw(e.first);
+            reqs.push_back(
+                request(primary_ns_decrement_credit, raw, raw, e.second));
+        }
 
         naming::id_type target(
-            stubs::primary_namespace::get_service_instance(raw)
+            stubs::primary_namespace::get_service_instance(
+                requests.begin()->first)
           , naming::id_type::unmanaged);
 
-        requests[target].push_back(req);
-    }
+        refcnt_requests_sent_ += reqs.size();
 
-    // send requests to all locality
-    requests_type::const_iterator end = requests.end();
-    for (requests_type::const_iterator it = requests.begin(); it != end; ++it)
-    {
         lazy_results.push_back(
             stubs::primary_namespace::bulk_service_async(
-                (*it).first, (*it).second, action_priority_));
+                target, std::move(reqs), action_priority_));
     }
 
     return lazy_results;
@@ -279,6 +279,15 @@ bool is_local_address_cached(
     return naming::get_agas_client().is_local_address_cached(gid, addr, ec);
 }
 
+bool resolve_cached(
+    naming::gid_type const& gid
+  , naming::address& addr
+  , error_code& ec
+    )
+{
+    return naming::get_agas_client().resolve_cached(gid, addr, ec);
+}
+
 bool is_local_lva_encoded_address(
     naming::gid_type const& gid
     )
@@ -305,6 +314,34 @@ naming::address resolve(
     return agas_.resolve_async(id).get(ec);
 }
 
+hpx::future<std::vector<naming::address> > resolve(
+    std::vector<naming::id_type> const& ids
+    )
+{
+    naming::resolver_client& agas_ = naming::get_agas_client();
+    return agas_.resolve_async(ids);
+}
+
+std::vector<naming::address> resolve(
+    launch::sync_policy
+  , std::vector<naming::id_type> const& ids
+  , error_code& ec
+    )
+{
+    naming::resolver_client& agas_ = naming::get_agas_client();
+    return agas_.resolve_async(ids).get(ec);
+}
+
+void update_cache_entry(
+    naming::gid_type const& gid
+  , naming::address const& addr
+  , error_code& ec
+    )
+{
+    naming::resolver_client& agas_ = naming::get_agas_client();
+    agas_.update_cache_entry(gid, addr, 1, 0, ec);
+}
+
 hpx::future<bool> bind(
     naming::gid_type const& gid
   , naming::address const& addr
@@ -24,6 +24,8 @@
 #include <hpx/lcos/future.hpp>
 #include <hpx/lcos/wait_all.hpp>
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <list>
 #include <memory>
@@ -49,6 +51,78 @@ naming::id_type bootstrap_primary_namespace_id()
 namespace server
 {
 
+///////////////////////////////////////////////////////////////////////////////
+std::size_t primary_namespace::get_shard_index(naming::gid_type const& id)
+{
+    // Consecutive gids are mapped onto consecutive shards, which spreads
+    // objects created one after another over all of the shards.
+    boost::uint64_t const msb =
+        naming::detail::strip_internal_bits_from_gid(id.get_msb());
+
+    return static_cast<std::size_t>(
+        (id.get_lsb() + msb * 0x9e3779b97f4a7c15ull) % num_shards);
+}
+
+// Acquires the locks of all shards a range of gids is stored in. The locks
+// are acquired in ascending order of the shards to avoid deadlocks.
+struct primary_namespace::gva_range_lock
+{
+    HPX_NON_COPYABLE(gva_range_lock);
+
+public:
+    gva_range_lock(
+        primary_namespace& pns
+      , naming::gid_type const& id
+      , boost::uint64_t count
+        )
+      : shard_(pns.get_gva_shard(id))
+      , count_(0)
+    {
+        boost::uint64_t const range_count = (std::min)(
+            (std::max)(count, boost::uint64_t(1)), boost::uint64_t(num_shards));
+
+        std::size_t indices[num_shards];
+        for (boost::uint64_t i = 0; i != range_count; ++i)
+            indices[i] = get_shard_index(id + i);
+
+        std::size_t* end = indices + range_count;
+        std::sort(indices, end);
+        end = std::unique(indices, end);
+
+        for (std::size_t* it = indices; it != end; ++it, ++count_)
+        {
+            shards_[count_] = &pns.gva_shards_[*it];
+            locks_[count_] =
+                std::unique_lock<mutex_type>(shards_[count_]->mutex_);
+        }
+    }
+
+    // Return the shard of the first gid of the range
+    gva_shard& get_shard() const
+    {
+        return shard_;
+    }
+
+    void unlock()
+    {
+        for (std::size_t i = count_; i != 0; --i)
+            locks_[i - 1].unlock();
+    }
+
+    template <typename F>
+    void for_each_shard(F && f)
+    {
+        for (std::size_t i = 0; i != count_; ++i)
+            f(*shards_[i]);
+    }
+
+private:
+    gva_shard& shard_;
+    std::size_t count_;
+    gva_shard* shards_[num_shards];
+    std::unique_lock<mutex_type> locks_[num_shards];
+};
+
 // TODO: This isn't scalable, we have to update it every time we add a new
 // AGAS request/response type.
 response primary_namespace::service(
@@ -377,9 +451,10 @@ response primary_namespace::begin_migration(
 
     naming::gid_type id = req.get_gid();
 
-    std::unique_lock<mutex_type> l(mutex_);
+    gva_shard& shard = get_gva_shard(id);
+    std::unique_lock<mutex_type> l(shard.mutex_);
 
-    resolved_type r = resolve_gid_locked(l, id, ec);
+    resolved_type r = resolve_gid_locked(l, shard, id, ec);
     if (get<0>(r) == naming::invalid_gid)
     {
         l.unlock();
@@ -392,11 +467,11 @@ response primary_namespace::begin_migration(
             naming::invalid_gid, no_success);
     }
 
-    migration_table_type::iterator it = migrating_objects_.find(id);
-    if (it == migrating_objects_.end())
+    migration_table_type::iterator it = shard.migrating_objects_.find(id);
+    if (it == shard.migrating_objects_.end())
     {
         std::pair<migration_table_type::iterator, bool> p =
-            migrating_objects_.emplace(std::piecewise_construct,
+            shard.migrating_objects_.emplace(std::piecewise_construct,
                 std::forward_as_tuple(id), std::forward_as_tuple());
         HPX_ASSERT(p.second);
         it = p.first;
@@ -415,12 +490,13 @@ response primary_namespace::end_migration(
 {
     naming::gid_type id = req.get_gid();
 
-    std::lock_guard<mutex_type> l(mutex_);
+    gva_shard& shard = get_gva_shard(id);
+    std::lock_guard<mutex_type> l(shard.mutex_);
 
     using hpx::util::get;
 
-    migration_table_type::iterator it = migrating_objects_.find(id);
-    if (it == migrating_objects_.end() || !get<0>(it->second))
+    migration_table_type::iterator it = shard.migrating_objects_.find(id);
+    if (it == shard.migrating_objects_.end() || !get<0>(it->second))
         return response(primary_ns_end_migration, no_success);
 
     get<2>(it->second).notify_all(ec);
@@ -434,6 +510,7 @@ response primary_namespace::end_migration(
 // wait if given object is currently being migrated
 void primary_namespace::wait_for_migration_locked(
     std::unique_lock<mutex_type>& l
+  , gva_shard& shard
   , naming::gid_type id
   , error_code& ec)
 {
@@ -441,15 +518,15 @@ void primary_namespace::wait_for_migration_locked(
 
     using hpx::util::get;
 
-    migration_table_type::iterator it = migrating_objects_.find(id);
-    if (it != migrating_objects_.end() && get<0>(it->second))
+    migration_table_type::iterator it = shard.migrating_objects_.find(id);
+    if (it != shard.migrating_objects_.end() && get<0>(it->second))
     {
         ++get<1>(it->second);
 
         get<2>(it->second).wait(l, ec);
 
         if (--get<1>(it->second) == 0 && !get<0>(it->second))
-            migrating_objects_.erase(it);
+            shard.migrating_objects_.erase(it);
     }
 }
 
@@ -467,11 +544,14 @@ response primary_namespace::bind_gid(
 
     naming::detail::strip_internal_bits_from_gid(id);
 
-    std::unique_lock<mutex_type> l(mutex_);
+    // The new range is stored in all shards its gids map to, however, an
+    // existing range covering id is always found in the shard of id.
+    gva_range_lock l(*this, id, g.count);
+    gva_table_type& gvas = l.get_shard().gvas_;
 
-    gva_table_type::iterator it = gvas_.lower_bound(id)
-                           , begin = gvas_.begin()
-                           , end = gvas_.end();
+    gva_table_type::iterator it = gvas.lower_bound(id)
+                           , begin = gvas.begin()
+                           , end = gvas.end();
 
     if (it != end)
     {
@@ -479,12 +559,9 @@ response primary_namespace::bind_gid(
         // binding (e.g. move semantics).
         if (it->first == id)
         {
-            gva& gaddr = it->second.first;
-            naming::gid_type& loc = it->second.second;
-
             // Check for count mismatch (we can't change block sizes of
             // existing bindings).
-            if (HPX_UNLIKELY(gaddr.count != g.count))
+            if (HPX_UNLIKELY(it->second.first.count != g.count))
             {
                 // REVIEW: Is this the right error code to use?
                 l.unlock();
@@ -521,12 +598,21 @@ response primary_namespace::bind_gid(
                 return response();
             }
 
-            // Store the new endpoint and offset
-            gaddr.prefix = g.prefix;
-            gaddr.type   = g.type;
-            gaddr.lva(g.lva());
-            gaddr.offset = g.offset;
-            loc = locality;
+            // Store the new endpoint and offset in all shards holding
+            // this range
+            l.for_each_shard(
+                [&](gva_shard& shard)
+                {
+                    gva_table_type::iterator it = shard.gvas_.find(id);
+                    HPX_ASSERT(it != shard.gvas_.end());
+
+                    gva& gaddr = it->second.first;
+                    gaddr.prefix = g.prefix;
+                    gaddr.type   = g.type;
+                    gaddr.lva(g.lva());
+                    gaddr.offset = g.offset;
+                    it->second.second = locality;
+                });
 
             l.unlock();
 
@@ -561,7 +647,7 @@ response primary_namespace::bind_gid(
         }
     }
 
-    else if (HPX_LIKELY(!gvas_.empty()))
+    else if (HPX_LIKELY(!gvas.empty()))
     {
         --it;
 
@@ -603,9 +689,19 @@ response primary_namespace::bind_gid(
         return response();
     }
 
-    // Insert a GID -> GVA entry into the GVA table.
-    if (HPX_UNLIKELY(!util::insert_checked(gvas_.insert(
-            std::make_pair(id, std::make_pair(g, locality))))))
+    // Insert a GID -> GVA entry into all affected shards of the GVA table.
+    bool inserted = true;
+    l.for_each_shard(
+        [&](gva_shard& shard)
+        {
+            if (!util::insert_checked(shard.gvas_.insert(
+                    std::make_pair(id, std::make_pair(g, locality)))))
+            {
+                inserted = false;
+            }
+        });
+
+    if (HPX_UNLIKELY(!inserted))
     {
         l.unlock();
 
@@ -643,13 +739,14 @@ response primary_namespace::resolve_gid(
     resolved_type r;
 
     {
-        std::unique_lock<mutex_type> l(mutex_);
+        gva_shard& shard = get_gva_shard(id);
+        std::unique_lock<mutex_type> l(shard.mutex_);
 
         // wait for any migration to be completed
-        wait_for_migration_locked(l, id, ec);
+        wait_for_migration_locked(l, shard, id, ec);
 
         // now, resolve the id
-        r = resolve_gid_locked(l, id, ec);
+        r = resolve_gid_locked(l, shard, id, ec);
     }
 
     if (get<0>(r) == naming::invalid_gid)
@@ -683,10 +780,11 @@ response primary_namespace::unbind_gid(
     naming::gid_type id = req.get_gid();
     naming::detail::strip_internal_bits_from_gid(id);
 
-    std::unique_lock<mutex_type> l(mutex_);
+    gva_range_lock l(*this, id, count);
+    gva_table_type& gvas = l.get_shard().gvas_;
 
-    gva_table_type::iterator it = gvas_.find(id)
-                           , end = gvas_.end();
+    gva_table_type::iterator it = gvas.find(id)
+                           , end = gvas.end();
 
     if (it != end)
     {
@@ -700,10 +798,16 @@ response primary_namespace::unbind_gid(
             return response();
         }
 
-        gva_table_data_type& data = it->second;
+        gva_table_data_type const data = it->second;
         response r(primary_ns_unbind_gid, data.first, data.second);
 
-        gvas_.erase(it);
+        // The block size matches, so the range is stored in exactly the
+        // shards we locked.
+        l.for_each_shard(
+            [&id](gva_shard& shard)
+            {
+                shard.gvas_.erase(id);
+            });
 
         l.unlock();
         LAGAS_(info) << (boost::format(
@@ -875,37 +979,39 @@ response primary_namespace::allocate(
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
     void primary_namespace::dump_refcnt_matches(
-        refcnt_table_type::iterator lower_it
-      , refcnt_table_type::iterator upper_it
-      , naming::gid_type const& lower
+        naming::gid_type const& lower
       , naming::gid_type const& upper
-      , std::unique_lock<mutex_type>& l
       , const char* func_name
         )
     { // dump_refcnt_matches implementation
-        HPX_ASSERT(l.owns_lock());
-
-        if (lower_it == refcnts_.end() && upper_it == refcnts_.end())
-            // We got nothing, bail - our caller is probably about to throw.
-            return;
-
         std::stringstream ss;
         ss << (boost::format(
               "%1%, dumping server-side refcnt table matches, lower(%2%), "
               "upper(%3%):")
               % func_name % lower % upper);
 
-        for (/**/; lower_it != upper_it; ++lower_it)
+        bool found = false;
+        for (naming::gid_type raw = lower; raw != upper; ++raw)
         {
+            refcnt_shard& shard = get_refcnt_shard(raw);
+            std::lock_guard<mutex_type> l(shard.mutex_);
+
+            refcnt_table_type::iterator it = shard.refcnts_.find(raw);
+            if (it == shard.refcnts_.end())
+                continue;
+
             // The [server] tag is in there to make it easier to filter
             // through the logs.
             ss << (boost::format(
                    "\n  [server] lower(%1%), credits(%2%)")
-                   % lower_it->first
-                   % lower_it->second);
+                   % it->first
+                   % it->second);
+            found = true;
         }
 
-        LAGAS_(debug) << ss.str();
+        // If we got nothing, our caller is probably about to throw.
+        if (found)
+            LAGAS_(debug) << ss.str();
     } // dump_refcnt_matches implementation
 #endif
 
@@ -917,28 +1023,11 @@ void primary_namespace::increment(
   , error_code& ec
     )
 { // {{{ increment implementation
-    std::unique_lock<mutex_type> l(mutex_);
-
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
     if (LAGAS_ENABLED(debug))
     {
-        typedef refcnt_table_type::iterator iterator;
-
-        // Find the mappings that we're about to touch.
-        refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-        refcnt_table_type::iterator upper_it;
-        if (lower != upper)
-        {
-            upper_it = refcnts_.find(upper);
-        }
-        else
-        {
-            upper_it = lower_it;
-            ++upper_it;
-        }
-
-        dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-            "primary_namespace::increment");
+        // Dump the mappings that we're about to touch.
+        dump_refcnt_matches(lower, upper, "primary_namespace::increment");
     }
 #endif
 
@@ -954,37 +1043,42 @@ void primary_namespace::increment(
 
     for (naming::gid_type raw = lower; raw != upper; ++raw)
     {
-        refcnt_table_type::iterator it = refcnts_.find(raw);
-        if (it == refcnts_.end())
+        std::int64_t count = 0;
+
         {
-            std::int64_t count =
-                std::int64_t(HPX_GLOBALCREDIT_INITIAL) + credits;
+            refcnt_shard& shard = get_refcnt_shard(raw);
+            std::unique_lock<mutex_type> l(shard.mutex_);
 
-            std::pair<refcnt_table_type::iterator, bool> p =
-                refcnts_.insert(refcnt_table_type::value_type(raw, count));
-            if (!p.second)
+            refcnt_table_type::iterator it = shard.refcnts_.find(raw);
+            if (it == shard.refcnts_.end())
             {
-                l.unlock();
+                count = std::int64_t(HPX_GLOBALCREDIT_INITIAL) + credits;
 
-                HPX_THROWS_IF(ec, invalid_data
-                    , "primary_namespace::increment"
-                    , boost::str(boost::format(
-                        "couldn't create entry in reference count table, "
-                        "raw(%1%), ref-count(%3%)")
-                        % raw % count));
-                return;
-            }
+                std::pair<refcnt_table_type::iterator, bool> p =
+                    shard.refcnts_.insert(
+                        refcnt_table_type::value_type(raw, count));
+                if (!p.second)
+                {
+                    l.unlock();
 
-            it = p.first;
-        }
-        else
-        {
-            it->second += credits;
+                    HPX_THROWS_IF(ec, invalid_data
+                        , "primary_namespace::increment"
+                        , boost::str(boost::format(
+                            "couldn't create entry in reference count table, "
+                            "raw(%1%), ref-count(%3%)")
+                            % raw % count));
+                    return;
+                }
+            }
+            else
+            {
+                count = (it->second += credits);
+            }
         }
 
         LAGAS_(info) << (boost::format(
             "primary_namespace::increment, raw(%1%), refcnt(%2%)")
-            % lower % it->second);
+            % lower % count);
     }
 
     if (&ec != &throws)
@@ -993,39 +1087,34 @@ void primary_namespace::increment(
 
 ///////////////////////////////////////////////////////////////////////////////
 void primary_namespace::resolve_free_list(
-    std::unique_lock<mutex_type>& l
-  , std::list<refcnt_table_type::iterator> const& free_list
+    std::list<naming::gid_type> const& free_list
   , std::list<free_entry>& free_entry_list
   , naming::gid_type const& lower
   , naming::gid_type const& upper
   , error_code& ec
     )
 {
-    HPX_ASSERT_OWNS_LOCK(l);
-
     using hpx::util::get;
 
-    typedef refcnt_table_type::iterator iterator;
-
-    for (iterator const& it : free_list)
+    for (naming::gid_type const& gid : free_list)
     {
-        typedef refcnt_table_type::key_type key_type;
+        resolved_type r;
 
-        // The mapping's key space.
-        key_type gid = it->first;
+        {
+            gva_shard& shard = get_gva_shard(gid);
+            std::unique_lock<mutex_type> l(shard.mutex_);
 
-        // wait for any migration to be completed
-        wait_for_migration_locked(l, gid, ec);
+            // wait for any migration to be completed
+            wait_for_migration_locked(l, shard, gid, ec);
 
-        // Resolve the query GID.
-        resolved_type r = resolve_gid_locked(l, gid, ec);
-        if (ec) return;
+            // Resolve the query GID.
+            r = resolve_gid_locked(l, shard, gid, ec);
+            if (ec) return;
+        }
 
         naming::gid_type& raw = get<0>(r);
         if (raw == naming::invalid_gid)
         {
-            l.unlock();
-
             HPX_THROWS_IF(ec, internal_server_error
                 , "primary_namespace::resolve_free_list"
                 , boost::str(boost::format(
@@ -1041,8 +1130,6 @@ void primary_namespace::resolve_free_list(
         // REVIEW: Should we do more to make sure the GVA is valid?
         if (HPX_UNLIKELY(components::component_invalid == g.type))
         {
-            l.unlock();
-
             HPX_THROWS_IF(ec, internal_server_error
                 , "primary_namespace::resolve_free_list"
                 , boost::str(boost::format(
@@ -1053,8 +1140,6 @@ void primary_namespace::resolve_free_list(
         }
         else if (HPX_UNLIKELY(0 == g.count))
         {
-            l.unlock();
-
             HPX_THROWS_IF(ec, internal_server_error
                 , "primary_namespace::resolve_free_list"
                 , boost::str(boost::format(
@@ -1077,7 +1162,14 @@ void primary_namespace::resolve_free_list(
         free_entry_list.push_back(free_entry(resolved, gid, get<2>(r)));
 
         // remove this entry from the refcnt table
-        refcnts_.erase(it);
+        {
+            refcnt_shard& shard = get_refcnt_shard(gid);
+            std::lock_guard<mutex_type> l(shard.mutex_);
+
+            refcnt_table_type::iterator it = shard.refcnts_.find(gid);
+            if (it != shard.refcnts_.end() && it->second == 0)
+                shard.refcnts_.erase(it);
+        }
     }
 }
 
@@ -1097,109 +1189,95 @@ void primary_namespace::decrement_sweep(
 
     free_entry_list.clear();
 
-    {
-        std::unique_lock<mutex_type> l(mutex_);
-
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-        if (LAGAS_ENABLED(debug))
-        {
-            typedef refcnt_table_type::iterator iterator;
-
-            // Find the mappings that we just added or modified.
-            refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-            refcnt_table_type::iterator upper_it;
-            if (lower != upper)
-            {
-                upper_it = refcnts_.find(upper);
-            }
-            else
-            {
-                upper_it = lower_it;
-                ++upper_it;
-            }
-
-            dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-                "primary_namespace::decrement_sweep");
-        }
+    if (LAGAS_ENABLED(debug))
+    {
+        // Dump the mappings that we're about to touch.
+        dump_refcnt_matches(lower, upper, "primary_namespace::decrement_sweep");
+    }
 #endif
 
-        ///////////////////////////////////////////////////////////////////////
-        // Apply the decrement across the entire key space (e.g. [lower, upper]).
+    ///////////////////////////////////////////////////////////////////////////
+    // Apply the decrement across the entire key space (e.g. [lower, upper]).
 
-        // The third parameter we pass here is the default data to use in case
-        // the key is not mapped. We don't insert GIDs into the refcnt table
-        // when we allocate/bind them, so if a GID is not in the refcnt table,
-        // we know that it's global reference count is the initial global
-        // reference count.
+    // The third parameter we pass here is the default data to use in case
+    // the key is not mapped. We don't insert GIDs into the refcnt table
+    // when we allocate/bind them, so if a GID is not in the refcnt table,
+    // we know that it's global reference count is the initial global
+    // reference count.
 
-        std::list<refcnt_table_type::iterator> free_list;
-        for (naming::gid_type raw = lower; raw != upper; ++raw)
+    std::list<naming::gid_type> free_list;
+    for (naming::gid_type raw = lower; raw != upper; ++raw)
+    {
+        refcnt_shard& shard = get_refcnt_shard(raw);
+        std::unique_lock<mutex_type> l(shard.mutex_);
+
+        refcnt_table_type::iterator it = shard.refcnts_.find(raw);
+        if (it == shard.refcnts_.end())
         {
-            refcnt_table_type::iterator it = refcnts_.find(raw);
-            if (it == refcnts_.end())
+            if (credits > std::int64_t(HPX_GLOBALCREDIT_INITIAL))
             {
-                if (credits > std::int64_t(HPX_GLOBALCREDIT_INITIAL))
-                {
-                    l.unlock();
-
-                    HPX_THROWS_IF(ec, invalid_data
-                      , "primary_namespace::decrement_sweep"
-                      , boost::str(boost::format(
-                            "negative entry in reference count table, raw(%1%), "
-                            "refcount(%2%)")
-                            % raw
-                            % (std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits)));
-                    return;
-                }
-
-                std::int64_t count =
-                    std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits;
-
-                std::pair<refcnt_table_type::iterator, bool> p =
-                    refcnts_.insert(refcnt_table_type::value_type(raw, count));
-                if (!p.second)
-                {
-                    l.unlock();
-
-                    HPX_THROWS_IF(ec, invalid_data
-                      , "primary_namespace::decrement_sweep"
-                      , boost::str(boost::format(
-                            "couldn't create entry in reference count table, "
-                            "raw(%1%), ref-count(%3%)")
-                            % raw % count));
-                    return;
-                }
+                l.unlock();
 
-                it = p.first;
-            }
-            else
-            {
-                it->second -= credits;
+                HPX_THROWS_IF(ec, invalid_data
+                  , "primary_namespace::decrement_sweep"
+                  , boost::str(boost::format(
+                        "negative entry in reference count table, raw(%1%), "
+                        "refcount(%2%)")
+                        % raw
+                        % (std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits)));
+                return;
             }
 
-            // Sanity check.
-            if (it->second < 0)
+            std::int64_t count =
+                std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits;
+
+            std::pair<refcnt_table_type::iterator, bool> p =
+                shard.refcnts_.insert(refcnt_table_type::value_type(raw, count));
+            if (!p.second)
             {
                 l.unlock();
 
                 HPX_THROWS_IF(ec, invalid_data
                   , "primary_namespace::decrement_sweep"
                   , boost::str(boost::format(
-                        "negative entry in reference count table, raw(%1%), "
-                        "refcount(%2%)")
-                        % raw % it->second));
+                        "couldn't create entry in reference count table, "
+                        "raw(%1%), ref-count(%3%)")
+                        % raw % count));
                 return;
             }
 
-            // this objects needs to be deleted
-            if (it->second == 0)
-                free_list.push_back(it);
+            it = p.first;
+        }
+        else
+        {
+            it->second -= credits;
+        }
+
+        // Sanity check.
+        if (it->second < 0)
+        {
+            std::int64_t count = it->second;
+            l.unlock();
+
+            HPX_THROWS_IF(ec, invalid_data
+              , "primary_namespace::decrement_sweep"
+              , boost::str(boost::format(
+                    "negative entry in reference count table, raw(%1%), "
+                    "refcount(%2%)")
+                    % raw % count));
+            return;
         }
 
-        // Resolve the objects which have to be deleted.
-        resolve_free_list(l, free_list, free_entry_list, lower, upper, ec);
+        // this objects needs to be deleted, its entry is removed from the
+        // refcnt table once it has been resolved
+        if (it->second == 0)
+            free_list.push_back(raw);
+    }
 
-    } // Unlock the mutex.
+    // Resolve the objects which have to be deleted.
+    resolve_free_list(free_list, free_entry_list, lower, upper, ec);
+    if (ec) return;
 
     if (&ec != &throws)
         ec = make_success_code();
@@ -1268,6 +1346,7 @@ void primary_namespace::free_components_sync(
 
 primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
     std::unique_lock<mutex_type>& l
+  , gva_shard const& shard
   , naming::gid_type const& gid
   , error_code& ec
     )
@@ -1278,9 +1357,12 @@ primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
     naming::gid_type id = gid;
     naming::detail::strip_internal_bits_from_gid(id);
 
-    gva_table_type::const_iterator it = gvas_.lower_bound(id)
-                                 , begin = gvas_.begin()
-                                 , end = gvas_.end();
+    HPX_ASSERT(&shard == &gva_shards_[get_shard_index(id)]);
+
+    gva_table_type const& gvas = shard.gvas_;
+    gva_table_type::const_iterator it = gvas.lower_bound(id)
+                                 , begin = gvas.begin()
+                                 , end = gvas.end();
 
     if (it != end)
     {
@@ -1323,7 +1405,7 @@ primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
         }
     }
 
-    else if (HPX_LIKELY(!gvas_.empty()))
+    else if (HPX_LIKELY(!gvas.empty()))
     {
         --it;
 
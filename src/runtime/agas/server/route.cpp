@@ -38,17 +38,18 @@ namespace hpx { namespace agas { namespace server
         // resolve destination addresses, we should be able to resolve all of
         // them, otherwise it's an error
         {
-            std::unique_lock<mutex_type> l(mutex_);
-
             cache_addresses.reserve(size);
             for (std::size_t i = 0; i != size; ++i)
             {
                 naming::gid_type gid(ids[i].get_gid());
 
+                gva_shard& shard = get_gva_shard(gid);
+                std::unique_lock<mutex_type> l(shard.mutex_);
+
                 // wait for any migration to be completed
-                wait_for_migration_locked(l, gid, ec);
+                wait_for_migration_locked(l, shard, gid, ec);
 
-                cache_addresses.push_back(resolve_gid_locked(l, gid, ec));
+                cache_addresses.push_back(resolve_gid_locked(l, shard, gid, ec));
                 resolved_type& r = cache_addresses.back();
 
                 if (ec || hpx::util::get<0>(r) == naming::invalid_gid)
@@ -415,6 +415,12 @@ namespace hpx { namespace applier
 
     // schedule threads based on given parcel
     void applier::schedule_action(parcelset::parcel p, std::size_t num_thread)
+    {
+        schedule_action_in_place(p, num_thread);
+    }
+
+    void applier::schedule_action_in_place(parcelset::parcel& p,
+        std::size_t num_thread)
     {
         // fetch the set of destinations
 #if !defined(HPX_SUPPORT_MULTIPLE_PARCEL_DESTINATIONS)
@@ -103,6 +103,9 @@ namespace hpx { namespace parcelset
             util::get_entry_as<int>(cfg, "hpx.parcel.message_handlers", "0") != 0
         ),
         count_routed_(0),
+        count_loopback_(0),
+        count_network_(0),
+        applier_(nullptr),
         write_handler_(&default_write_handler)
     {
         for (plugins::parcelport_factory_base* factory : get_parcelport_factories())
@@ -141,6 +144,7 @@ namespace hpx { namespace parcelset
         applier::applier *applier)
     {
         resolver_ = &resolver;
+        applier_ = applier;
 
         for (pports_type::value_type& pp : pports_)
         {
@@ -383,6 +387,45 @@ namespace hpx { namespace parcelset
         }
     }
 
+    bool parcelhandler::can_deliver_locally(parcel const& p) const
+    {
+        // parcels can't be scheduled directly while the runtime is still
+        // being set up
+        if (nullptr == applier_ ||
+            !hpx::threads::threadmanager_is(hpx::state::state_running))
+        {
+            return false;
+        }
+
+        naming::address const* addrs = p.addrs();
+        naming::gid_type const here = get_locality();
+
+#if !defined(HPX_SUPPORT_MULTIPLE_PARCEL_DESTINATIONS)
+        return addrs[0].locality_ == here;
+#else
+        for (std::size_t i = 0; i != p.size(); ++i)
+        {
+            if (addrs[i].locality_ != here)
+                return false;
+        }
+        return true;
+#endif
+    }
+
+    // Parcels addressed to this locality are handed to the applier without
+    // being serialized, the scheduled threads take ownership of the action
+    // arguments.
+    void parcelhandler::deliver_locally(parcel p, write_handler_type const& f)
+    {
+        ++count_loopback_;
+
+        applier_->schedule_action_in_place(p);
+
+        // the parcel has left the parcel layer as far as the sender is
+        // concerned
+        f(boost::system::error_code(), p);
+    }
+
     void parcelhandler::put_parcel(parcel p, write_handler_type f)
     {
         HPX_ASSERT(resolver_);
@@ -457,6 +500,15 @@ namespace hpx { namespace parcelset
         // parcel directly to the destination.
         if (resolved_locally)
         {
+            // short-circuit parcels addressed to this locality
+            if (can_deliver_locally(p))
+            {
+                deliver_locally(std::move(p), wrapped_f);
+                return;
+            }
+
+            ++count_network_;
+
             // dispatch to the message handler which is associated with the
             // encapsulated action
             typedef std::pair<std::shared_ptr<parcelport>, locality> destination_pair;
@@ -577,6 +629,15 @@ namespace hpx { namespace parcelset
             // the parcel directly to the destination.
             if (resolved_locally)
             {
+                // short-circuit parcels addressed to this locality
+                if (can_deliver_locally(p))
+                {
+                    deliver_locally(std::move(p), f);
+                    continue;
+                }
+
+                ++count_network_;
+
                 // dispatch to the message handler which is associated with the
                 // encapsulated action
                 destination_pair dest = find_appropriate_destination(
@@ -784,6 +845,16 @@ namespace hpx { namespace parcelset
         return util::get_and_reset_value(count_routed_, reset);
     }
 
+    boost::int64_t parcelhandler::get_parcel_loopback_count(bool reset)
+    {
+        return util::get_and_reset_value(count_loopback_, reset);
+    }
+
+    boost::int64_t parcelhandler::get_parcel_network_count(bool reset)
+    {
+        return util::get_and_reset_value(count_network_, reset);
+    }
+
     // number of messages sent
     boost::int64_t parcelhandler::get_message_send_count(
         std::string const& pp_type, bool reset) const
@@ -934,6 +1005,33 @@ namespace hpx { namespace parcelset
         return pp ? pp->get_connection_cache_statistics(stat_type, reset) : 0;
     }
 
+    // receive buffer pool statistics
+    boost::int64_t parcelhandler::get_buffer_pool_statistics(
+        std::string const& pp_type,
+        parcelport::buffer_pool_statistics_type stat_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_buffer_pool_statistics(stat_type, reset) : 0;
+    }
+
+    // queueing statistics of the parcel lanes
+    boost::int64_t parcelhandler::get_queue_time(std::string const& pp_type,
+        parcelport::parcel_lane lane, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_queue_time(lane, reset) : 0;
+    }
+
+    boost::int64_t parcelhandler::get_queue_count(std::string const& pp_type,
+        parcelport::parcel_lane lane, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_queue_count(lane, reset) : 0;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     void parcelhandler::register_counter_types()
     {
@@ -953,6 +1051,10 @@ namespace hpx { namespace parcelset
             util::bind(&parcelhandler::get_outgoing_queue_length, this, _1));
         util::function_nonser<boost::int64_t(bool)> outgoing_routed_count(
             util::bind(&parcelhandler::get_parcel_routed_count, this, _1));
+        util::function_nonser<boost::int64_t(bool)> outgoing_loopback_count(
+            util::bind(&parcelhandler::get_parcel_loopback_count, this, _1));
+        util::function_nonser<boost::int64_t(bool)> outgoing_network_count(
+            util::bind(&parcelhandler::get_parcel_network_count, this, _1));
 
         performance_counters::generic_counter_type_data const counter_types[] =
         {
@@ -983,6 +1085,26 @@ namespace hpx { namespace parcelset
                   _1, outgoing_routed_count, _2),
               &performance_counters::locality_counter_discoverer,
               ""
+            },
+            { "/parcels/count/loopback",
+              performance_counters::counter_raw,
+              "returns the number of (outbound) parcels addressed to the "
+                  "local locality which were scheduled without being serialized",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, outgoing_loopback_count, _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { "/parcels/count/network",
+              performance_counters::counter_raw,
+              "returns the number of (outbound) parcels which were handed to "
+                  "one of the parcelports",
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, outgoing_network_count, _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
             }
         };
         performance_counters::install_counter_types(
@@ -1316,6 +1438,114 @@ namespace hpx { namespace parcelset
         };
         performance_counters::install_counter_types(connection_cache_types,
             sizeof(connection_cache_types)/sizeof(connection_cache_types[0]));
+
+        // register connection specific performance counters related to the
+        // pooling of receive buffers
+        util::function_nonser<boost::int64_t(bool)> buffer_pool_hits(
+            util::bind(&parcelhandler::get_buffer_pool_statistics,
+                this, pp_type, parcelport::buffer_pool_hits, _1));
+        util::function_nonser<boost::int64_t(bool)> buffer_pool_misses(
+            util::bind(&parcelhandler::get_buffer_pool_statistics,
+                this, pp_type, parcelport::buffer_pool_misses, _1));
+
+        performance_counters::generic_counter_type_data const buffer_pool_types[] =
+        {
+            { boost::str(boost::format("/parcels/count/%s/buffer_pool/hits")
+                % pp_type),
+              performance_counters::counter_raw,
+              boost::str(boost::format("returns the number of receive buffers "
+                  "which were served from the buffer pool of the %s connection "
+                  "type on the referenced locality") % pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, buffer_pool_hits, _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { boost::str(boost::format("/parcels/count/%s/buffer_pool/misses")
+                % pp_type),
+              performance_counters::counter_raw,
+              boost::str(boost::format("returns the number of receive buffers "
+                  "which could not be served from the buffer pool of the %s "
+                  "connection type on the referenced locality") % pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, buffer_pool_misses, _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            }
+        };
+        performance_counters::install_counter_types(buffer_pool_types,
+            sizeof(buffer_pool_types)/sizeof(buffer_pool_types[0]));
+
+        // register connection specific performance counters related to the
+        // queueing of outgoing parcels on the normal and priority lanes
+        util::function_nonser<boost::int64_t(bool)> queue_time_normal(
+            util::bind(&parcelhandler::get_queue_time,
+                this, pp_type, parcelport::lane_normal, _1));
+        util::function_nonser<boost::int64_t(bool)> queue_time_priority(
+            util::bind(&parcelhandler::get_queue_time,
+                this, pp_type, parcelport::lane_priority, _1));
+        util::function_nonser<boost::int64_t(bool)> queue_count_normal(
+            util::bind(&parcelhandler::get_queue_count,
+                this, pp_type, parcelport::lane_normal, _1));
+        util::function_nonser<boost::int64_t(bool)> queue_count_priority(
+            util::bind(&parcelhandler::get_queue_count,
+                this, pp_type, parcelport::lane_priority, _1));
+
+        performance_counters::generic_counter_type_data const queue_types[] =
+        {
+            { boost::str(boost::format("/parcels/time/%s/queue/normal")
+                % pp_type),
+              performance_counters::counter_raw,
+              boost::str(boost::format("returns the total time the parcels "
+                  "sent from the normal lane of the %s connection type on the "
+                  "referenced locality have been waiting to be sent") % pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, queue_time_normal, _2),
+              &performance_counters::locality_counter_discoverer,
+              "ns"
+            },
+            { boost::str(boost::format("/parcels/time/%s/queue/priority")
+                % pp_type),
+              performance_counters::counter_raw,
+              boost::str(boost::format("returns the total time the parcels "
+                  "sent from the priority lane of the %s connection type on the "
+                  "referenced locality have been waiting to be sent") % pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, queue_time_priority, _2),
+              &performance_counters::locality_counter_discoverer,
+              "ns"
+            },
+            { boost::str(boost::format("/parcels/count/%s/queue/normal")
+                % pp_type),
+              performance_counters::counter_raw,
+              boost::str(boost::format("returns the number of parcels sent "
+                  "from the normal lane of the %s connection type on the "
+                  "referenced locality") % pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, queue_count_normal, _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { boost::str(boost::format("/parcels/count/%s/queue/priority")
+                % pp_type),
+              performance_counters::counter_raw,
+              boost::str(boost::format("returns the number of parcels sent "
+                  "from the priority lane of the %s connection type on the "
+                  "referenced locality") % pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, queue_count_priority, _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            }
+        };
+        performance_counters::install_counter_types(queue_types,
+            sizeof(queue_types)/sizeof(queue_types[0]));
     }
 
     std::vector<plugins::parcelport_factory_base *> &
@@ -1378,6 +1608,9 @@ namespace hpx { namespace parcelset
                 "$[hpx.parcel.array_optimization]}",
             "enable_security = ${HPX_PARCEL_ENABLE_SECURITY:0}",
             "async_serialization = ${HPX_PARCEL_ASYNC_SERIALIZATION:1}",
+            "priority_lanes = ${HPX_PARCEL_PRIORITY_LANES:1}",
+            "priority_connections_per_locality = "
+                "${HPX_PARCEL_PRIORITY_CONNECTIONS_PER_LOCALITY:2}",
 #if defined(HPX_HAVE_PARCEL_COALESCING)
             "message_handlers = ${HPX_PARCEL_MESSAGE_HANDLERS:1}"
 #else
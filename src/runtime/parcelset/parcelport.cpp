@@ -37,6 +37,7 @@ namespace hpx { namespace parcelset
         allow_zero_copy_optimizations_(true),
         enable_security_(false),
         async_serialization_(false),
+        enable_priority_lanes_(true),
         priority_(hpx::util::get_entry_as<int>(ini, "hpx.parcel." + type + ".priority",
             "0")),
         type_(type)
@@ -63,6 +64,17 @@ namespace hpx { namespace parcelset
         {
             async_serialization_ = true;
         }
+
+        if(hpx::util::get_entry_as<int>(ini, key + ".priority_lanes", "1") == 0)
+        {
+            enable_priority_lanes_ = false;
+        }
+
+        for (int lane = 0; lane != num_lanes; ++lane)
+        {
+            queue_time_[lane].store(0);
+            queue_count_[lane].store(0);
+        }
     }
 
     void parcelport::add_received_parcel(parcel p, std::size_t num_thread)
@@ -27,8 +27,9 @@ namespace hpx { namespace threads { namespace coroutines
 #endif
             {
 #if defined(_POSIX_VERSION)
-                void* limit = static_cast<char*>(stack_pointer_) - stack_size_;
-                if(posix::reset_stack(limit, stack_size_))
+                std::size_t const size = get_allocated_stacksize();
+                void* limit = static_cast<char*>(stack_pointer_) - size;
+                if(posix::reset_stack(limit, size))
                     increment_stack_unbind_count();
 #else
                 // nothing we can do here ...
@@ -45,15 +46,7 @@ namespace hpx { namespace threads { namespace coroutines
 #endif
             {
                 increment_stack_recycle_count();
-#if BOOST_VERSION < 105600
-                boost::context::fcontext_t* ctx =
-                    boost::context::make_fcontext(stack_pointer_, stack_size_, funp_);
-
-                std::swap(*ctx, ctx_);
-#else
-                ctx_ =
-                    boost::context::make_fcontext(stack_pointer_, stack_size_, funp_);
-#endif
+                make_context();
             }
         }
 
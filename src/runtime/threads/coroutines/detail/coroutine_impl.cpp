@@ -30,12 +30,16 @@
 #include <hpx/config.hpp>
 
 #include <hpx/runtime/naming/id_type_impl.hpp>
+#include <hpx/runtime/runtime_fwd.hpp>
 #include <hpx/runtime/threads/coroutines/coroutine.hpp>
 #include <hpx/runtime/threads/coroutines/detail/coroutine_impl.hpp>
 #include <hpx/runtime/threads/coroutines/detail/coroutine_self.hpp>
 #include <hpx/runtime/threads/thread_data_fwd.hpp>
+#include <hpx/runtime/threads/thread_enums.hpp>
+#include <hpx/runtime/threads/thread_init_data.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/reinitializable_static.hpp>
+#include <hpx/util/thread_specific_ptr.hpp>
 
 #include <boost/exception_ptr.hpp>
 #include <boost/lockfree/stack.hpp>
@@ -131,6 +135,97 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
         HPX_ASSERT(this->m_state == super_type::ctx_running);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace
+    {
+        std::size_t init_spare_stack_size()
+        {
+            if (nullptr == get_runtime_ptr())
+                return HPX_SMALL_STACK_SIZE;
+
+            return static_cast<std::size_t>(
+                threads::get_stack_size(threads::thread_stacksize_small));
+        }
+    }
+
+    // The size is determined once, all spare stacks have to have the same
+    // size as they are freed without knowing which context allocated them.
+    std::size_t get_spare_stack_size()
+    {
+        static std::size_t const spare_stack_size = init_spare_stack_size();
+        return spare_stack_size;
+    }
+
+    namespace
+    {
+        // Each OS thread keeps one spare stack which is lent to the stackless
+        // coroutines run on it.
+        struct spare_stack
+        {
+            spare_stack()
+              : stack_(nullptr)
+            {}
+
+            ~spare_stack()
+            {
+                if (stack_)
+                    coroutine_impl::free_spare_stack(stack_);
+            }
+
+            void* stack_;
+        };
+
+        struct spare_stack_tag {};
+
+        util::thread_specific_ptr<spare_stack, spare_stack_tag> spare_stack_;
+
+        spare_stack& get_spare_stack()
+        {
+            if (nullptr == spare_stack_.get())
+                spare_stack_.reset(new spare_stack);
+            return *spare_stack_;
+        }
+
+        // A stackless coroutine gives back its stack once it has exited, a
+        // suspended coroutine keeps it until it is resumed and exits.
+        struct return_spare_stack
+        {
+            return_spare_stack(coroutine_impl* p, spare_stack& spare)
+              : p_(p), spare_(spare)
+            {}
+
+            ~return_spare_stack()
+            {
+                if (!p_->exited())
+                    return;
+
+                void* stack = p_->detach_stack();
+                if (nullptr == spare_.stack_)
+                    spare_.stack_ = stack;
+                else if (stack)
+                    coroutine_impl::free_spare_stack(stack);
+            }
+
+            coroutine_impl* p_;
+            spare_stack& spare_;
+        };
+    }
+
+    void coroutine_impl::invoke_stackless()
+    {
+        HPX_ASSERT(this->is_stackless());
+
+        spare_stack& spare = get_spare_stack();
+        if (!this->has_stack())
+        {
+            this->attach_stack(spare.stack_);
+            spare.stack_ = nullptr;
+        }
+
+        return_spare_stack on_exit(this, spare);
+        this->invoke();
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // the memory for the threads is managed by a lockfree caching_freelist
     struct coroutine_heap
@@ -217,6 +312,10 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
     coroutine_impl* coroutine_impl::allocate(
         thread_id_repr_type id, std::ptrdiff_t stacksize)
     {
+        // stackless coroutines don't own a stack, those are not cached
+        if (stacksize == 0)
+            return nullptr;
+
         // start looking at the matching heap
         std::size_t const heap_num = std::size_t(id) / 32; //-V112
         std::size_t const heap_count = get_heap_count(stacksize);
@@ -237,6 +336,19 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
     {
         std::size_t const heap_num = std::size_t(p->get_thread_id()) / 32; //-V112
         std::ptrdiff_t const stacksize = p->get_stacksize();
+        if (stacksize == 0)
+        {
+            // a stackless coroutine which never ran has no stack it could be
+            // exited on, make sure it doesn't get invoked while being
+            // destroyed
+            if (!p->exited() && !p->has_stack())
+            {
+                p->reset();
+                p->m_state = super_type::ctx_exited;
+            }
+            delete p;
+            return;
+        }
 
         get_heap(heap_num, stacksize).deallocate(p);
     }
@@ -0,0 +1,276 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+#include <hpx/runtime/get_worker_thread_num.hpp>
+#include <hpx/runtime/threads/coroutines/detail/posix_utility.hpp>
+#include <hpx/runtime/threads/coroutines/detail/stack_pool.hpp>
+#include <hpx/runtime/threads/thread_helpers.hpp>
+#include <hpx/runtime/threads/topology.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/lockfree/stack.hpp>
+
+#include <cstddef>
+#include <vector>
+
+#include <sys/mman.h>
+
+// MADV_FREE is available starting Linux V4.5 only, fall back to the (more
+// expensive) MADV_DONTNEED otherwise
+#if !defined(MADV_FREE)
+#define MADV_FREE MADV_DONTNEED
+#endif
+
+namespace hpx { namespace threads { namespace coroutines { namespace detail {
+namespace posix
+{
+    namespace
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // free list for the stacks of one size
+        struct stack_bucket
+        {
+            stack_bucket()
+              : size_(0), count_(0), stacks_(64)
+            {}
+
+            ~stack_bucket()
+            {
+                void* stack = nullptr;
+                while (stacks_.pop(stack))
+                    unmap_stack(stack, size_.load(boost::memory_order_relaxed));
+            }
+
+            boost::atomic<std::size_t> size_;
+            boost::atomic<boost::int64_t> count_;
+            boost::lockfree::stack<void*> stacks_;
+        };
+
+        // the free lists for one NUMA domain, the number of different stack
+        // sizes is usually small (small, medium, large, and huge), stacks of
+        // any additional size are not pooled
+        struct stack_domain
+        {
+            enum { num_buckets = 8 };
+
+            // Return the bucket for the given stack size, a new one is set up
+            // only if create is true. Returns nullptr if no bucket is
+            // available.
+            stack_bucket* get_bucket(std::size_t size, bool create)
+            {
+                for (std::size_t i = 0; i != num_buckets; ++i)
+                {
+                    std::size_t s = buckets_[i].size_.load(
+                        boost::memory_order_acquire);
+                    if (s == size)
+                        return &buckets_[i];
+
+                    if (s == 0)
+                    {
+                        if (!create)
+                            return nullptr;
+
+                        if (buckets_[i].size_.compare_exchange_strong(s, size) ||
+                            s == size)
+                        {
+                            return &buckets_[i];
+                        }
+                    }
+                }
+                return nullptr;
+            }
+
+            stack_bucket buckets_[num_buckets];
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        std::size_t get_number_of_domains()
+        {
+            std::size_t num_domains = get_topology().get_number_of_numa_nodes();
+            return num_domains == 0 ? 1 : num_domains;
+        }
+
+        struct stack_pool_data
+        {
+            typedef std::vector<stack_domain> domains_type;
+
+            stack_pool_data()
+              : low_watermark_(64), high_watermark_(1024),
+                hits_(0), misses_(0), pooled_(0), resident_(0),
+                domains_(nullptr)
+            {}
+
+            ~stack_pool_data()
+            {
+                delete domains_.load(boost::memory_order_acquire);
+            }
+
+            // Stacks are returned to (and taken from) the pool of the NUMA
+            // domain of the current worker thread. The per-domain free lists
+            // are set up only once the first worker thread gets here, as the
+            // topology is not available before the runtime has been created.
+            // Any other thread uses a separate free list.
+            stack_domain& get_domain()
+            {
+                if (hpx::get_worker_thread_num() == std::size_t(-1))
+                    return other_domain_;
+
+                domains_type* domains =
+                    domains_.load(boost::memory_order_acquire);
+                if (domains == nullptr)
+                    domains = create_domains();
+
+                std::size_t domain = threads::get_numa_node_number();
+                return (*domains)[domain % domains->size()];
+            }
+
+            domains_type* create_domains()
+            {
+                domains_type* domains =
+                    new domains_type(get_number_of_domains());
+
+                domains_type* expected = nullptr;
+                if (!domains_.compare_exchange_strong(expected, domains,
+                        boost::memory_order_acq_rel))
+                {
+                    // some other worker thread was faster
+                    delete domains;
+                    return expected;
+                }
+                return domains;
+            }
+
+            boost::atomic<std::size_t> low_watermark_;
+            boost::atomic<std::size_t> high_watermark_;
+
+            boost::atomic<boost::int64_t> hits_;
+            boost::atomic<boost::int64_t> misses_;
+            boost::atomic<boost::int64_t> pooled_;
+            boost::atomic<boost::int64_t> resident_;
+
+            boost::atomic<domains_type*> domains_;
+            stack_domain other_domain_;
+        };
+
+        stack_pool_data& get_stack_pool_data()
+        {
+            static stack_pool_data data;
+            return data;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void* stack_pool::allocate(std::size_t size)
+    {
+        stack_pool_data& data = get_stack_pool_data();
+
+        stack_bucket* bucket = data.get_domain().get_bucket(size, false);
+        void* stack = nullptr;
+        if (bucket != nullptr && bucket->stacks_.pop(stack))
+        {
+            // the stacks beyond the low watermark had their pages released
+            boost::int64_t count = --bucket->count_;
+            if (count < static_cast<boost::int64_t>(
+                    data.low_watermark_.load(boost::memory_order_relaxed)))
+            {
+                data.resident_ -= size;
+            }
+
+            --data.pooled_;
+            ++data.hits_;
+            return stack;
+        }
+
+        ++data.misses_;
+        return map_stack(size);
+    }
+
+    void stack_pool::deallocate(void* stack, std::size_t size)
+    {
+        stack_pool_data& data = get_stack_pool_data();
+
+        boost::int64_t high_watermark = static_cast<boost::int64_t>(
+            data.high_watermark_.load(boost::memory_order_relaxed));
+        stack_bucket* bucket = nullptr;
+        if (high_watermark != 0)
+            bucket = data.get_domain().get_bucket(size, true);
+
+        if (bucket == nullptr)
+        {
+            unmap_stack(stack, size);
+            return;
+        }
+
+        boost::int64_t count = bucket->count_++;
+        if (count >= high_watermark)
+        {
+            // the pool is full
+            --bucket->count_;
+            unmap_stack(stack, size);
+            return;
+        }
+
+        bool resident = count < static_cast<boost::int64_t>(
+            data.low_watermark_.load(boost::memory_order_relaxed));
+        if (!resident)
+        {
+            // keep the mapping (and the guard page), but let the operating
+            // system reclaim the pages if needed
+            ::madvise(stack, size, MADV_FREE);
+        }
+
+        if (!bucket->stacks_.push(stack))
+        {
+            --bucket->count_;
+            unmap_stack(stack, size);
+            return;
+        }
+
+        if (resident)
+            data.resident_ += size;
+        ++data.pooled_;
+    }
+
+    void stack_pool::set_watermarks(std::size_t low_watermark,
+        std::size_t high_watermark)
+    {
+        if (low_watermark > high_watermark)
+            low_watermark = high_watermark;
+
+        stack_pool_data& data = get_stack_pool_data();
+        data.low_watermark_.store(low_watermark);
+        data.high_watermark_.store(high_watermark);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    boost::int64_t stack_pool::get_hit_count(bool reset)
+    {
+        return util::get_and_reset_value(get_stack_pool_data().hits_, reset);
+    }
+
+    boost::int64_t stack_pool::get_miss_count(bool reset)
+    {
+        return util::get_and_reset_value(get_stack_pool_data().misses_, reset);
+    }
+
+    boost::int64_t stack_pool::get_pooled_count(bool)
+    {
+        return get_stack_pool_data().pooled_.load();
+    }
+
+    boost::int64_t stack_pool::get_resident_size(bool)
+    {
+        return get_stack_pool_data().resident_.load();
+    }
+}
+}}}}
+
+#endif
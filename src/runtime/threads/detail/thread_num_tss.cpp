@@ -51,4 +51,10 @@ namespace hpx { namespace threads { namespace detail
         // some OS threads are not managed by the thread-manager
         return std::size_t(-1);
     }
+
+    void const* thread_num_tss::get_os_thread_key() const
+    {
+        // the TSS value is allocated separately for each OS thread
+        return thread_num_tss::thread_num_.get();
+    }
 }}}
@@ -10,6 +10,7 @@
 #include <hpx/state.hpp>
 #include <hpx/throw_exception.hpp>
 #include <hpx/lcos/local/no_mutex.hpp>
+#include <hpx/runtime/get_config_entry.hpp>
 #include <hpx/runtime/get_worker_thread_num.hpp>
 #include <hpx/runtime/threads/detail/create_thread.hpp>
 #include <hpx/runtime/threads/detail/create_work.hpp>
@@ -21,6 +22,7 @@
 #include <hpx/util/assert.hpp>
 #include <hpx/util/bind.hpp>
 #include <hpx/util/logging.hpp>
+#include <hpx/util/safe_lexical_cast.hpp>
 #include <hpx/util/hardware/timestamp.hpp>
 #include <hpx/util/high_resolution_clock.hpp>
 #include <hpx/util/unlock_guard.hpp>
@@ -359,6 +361,14 @@ namespace hpx { namespace threads { namespace detail
 #endif
 #endif
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        // maximum time idle worker threads are put to sleep
+        sched_.Scheduler::set_max_idle_backoff_time(
+            hpx::util::safe_lexical_cast<std::size_t>(
+                hpx::get_config_entry("hpx.max_idle_backoff_time",
+                    HPX_IDLE_BACKOFF_TIME_MAX)));
+#endif
+
         LTM_(info)
             << "thread_pool::run: " << pool_name_
             << " timestamp_scale: " << timestamp_scale_; //-V128
@@ -470,7 +480,7 @@ namespace hpx { namespace threads { namespace detail
             sched_.set_all_states(state_stopping);
 
             // make sure we're not waiting
-            sched_.Scheduler::do_some_work(std::size_t(-1));
+            sched_.Scheduler::do_some_work_all();
 
             if (blocking) {
                 for (std::size_t i = 0; i != threads_.size(); ++i)
@@ -480,7 +490,7 @@ namespace hpx { namespace threads { namespace detail
                         << "thread_pool::stop: " << pool_name_
                         << " notify_all";
 
-                    sched_.Scheduler::do_some_work(std::size_t(-1));
+                    sched_.Scheduler::do_some_work_all();
 
                     LTM_(info) //-V128
                         << "thread_pool::stop: " << pool_name_
@@ -614,6 +624,20 @@ namespace hpx { namespace threads { namespace detail
                         callbacks.background_ = util::bind( //-V107
                             &policies::scheduler_base::background_callback,
                             &sched_, num_thread);
+
+                        // Incoming messages don't wake up sleeping worker
+                        // threads, the first worker threads polling the
+                        // parcelports have to stay awake.
+                        std::size_t const max_awake_threads =
+                            hpx::util::safe_lexical_cast<std::size_t>(
+                                hpx::get_config_entry(
+                                    "hpx.max_awake_background_threads",
+                                    std::size_t(1)));
+                        if (num_thread < callbacks.max_background_threads_ &&
+                            num_thread < max_awake_threads)
+                        {
+                            sched_.Scheduler::set_may_park(num_thread, false);
+                        }
                     }
 
                     sched_.set_scheduler_mode(mode_);
@@ -1379,6 +1403,66 @@ namespace hpx { namespace threads { namespace detail
     {
         return sched_.Scheduler::get_num_stolen_to_staged(num, reset);
     }
+
+    template <typename Scheduler>
+    std::int64_t thread_pool<Scheduler>::
+        get_num_steals(std::size_t level, std::size_t num, bool reset)
+    {
+        return sched_.Scheduler::get_num_steals(level, num, reset);
+    }
+#endif
+
+    template <typename Scheduler>
+    std::int64_t thread_pool<Scheduler>::
+        get_thread_data_count(std::size_t num, bool reset)
+    {
+        return sched_.Scheduler::get_thread_data_count(num);
+    }
+
+    template <typename Scheduler>
+    std::int64_t thread_pool<Scheduler>::
+        get_thread_data_capacity(std::size_t num, bool reset)
+    {
+        return sched_.Scheduler::get_thread_data_capacity(num);
+    }
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    template <typename Scheduler>
+    std::int64_t thread_pool<Scheduler>::
+        get_parked_time(std::size_t num, bool reset)
+    {
+        return sched_.Scheduler::get_parked_time(num, reset);
+    }
+
+    template <typename Scheduler>
+    std::int64_t thread_pool<Scheduler>::
+        get_wakeup_count(std::size_t num, bool reset)
+    {
+        return sched_.Scheduler::get_wakeup_count(num, reset);
+    }
+
+    template <typename Scheduler>
+    std::int64_t thread_pool<Scheduler>::
+        get_average_wakeup_latency(std::size_t num, bool reset)
+    {
+        return sched_.Scheduler::get_average_wakeup_latency(num, reset);
+    }
+#endif
+
+#if defined(HPX_HAVE_DEADLINE_SCHEDULER)
+    template <typename Scheduler>
+    std::int64_t thread_pool<Scheduler>::
+        get_deadline_thread_count(bool reset)
+    {
+        return sched_.Scheduler::get_deadline_thread_count(reset);
+    }
+
+    template <typename Scheduler>
+    std::int64_t thread_pool<Scheduler>::
+        get_missed_deadline_count(bool reset)
+    {
+        return sched_.Scheduler::get_missed_deadline_count(reset);
+    }
 #endif
 
 }}}
@@ -1412,12 +1496,29 @@ template class HPX_EXPORT hpx::threads::detail::thread_pool<
 #include <hpx/runtime/threads/policies/local_priority_queue_scheduler.hpp>
 template class HPX_EXPORT hpx::threads::detail::thread_pool<
     hpx::threads::policies::local_priority_queue_scheduler<> >;
+template class HPX_EXPORT hpx::threads::detail::thread_pool<
+    hpx::threads::policies::lockfree_map_priority_queue_scheduler>;
 
 #if defined(HPX_HAVE_ABP_SCHEDULER)
 template class HPX_EXPORT hpx::threads::detail::thread_pool<
     hpx::threads::policies::abp_fifo_priority_queue_scheduler>;
 #endif
 
+#if defined(HPX_HAVE_CHASE_LEV_SCHEDULER)
+template class HPX_EXPORT hpx::threads::detail::thread_pool<
+    hpx::threads::policies::chase_lev_priority_queue_scheduler>;
+#if defined(HPX_HAVE_LOCAL_SCHEDULER)
+template class HPX_EXPORT hpx::threads::detail::thread_pool<
+    hpx::threads::policies::chase_lev_queue_scheduler>;
+#endif
+#endif
+
+#if defined(HPX_HAVE_DEADLINE_SCHEDULER)
+#include <hpx/runtime/threads/policies/deadline_queue_scheduler.hpp>
+template class HPX_EXPORT hpx::threads::detail::thread_pool<
+    hpx::threads::policies::deadline_queue_scheduler<> >;
+#endif
+
 #if defined(HPX_HAVE_HIERARCHY_SCHEDULER)
 #include <hpx/runtime/threads/policies/hierarchy_scheduler.hpp>
 template class HPX_EXPORT hpx::threads::detail::thread_pool<
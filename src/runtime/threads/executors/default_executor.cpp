@@ -9,7 +9,11 @@
 #include <hpx/throw_exception.hpp>
 #include <hpx/runtime/threads/thread_enums.hpp>
 #include <hpx/runtime/threads/thread_helpers.hpp>
+#include <hpx/runtime/threads/thread_init_data.hpp>
 #include <hpx/util/assert.hpp>
+#include <hpx/util/bind.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/register_locks.hpp>
 #include <hpx/util/steady_clock.hpp>
 #include <hpx/util/thread_description.hpp>
 #include <hpx/util/unique_function.hpp>
@@ -24,16 +28,63 @@ namespace hpx { namespace threads { namespace executors { namespace detail
     default_executor::default_executor()
       : stacksize_(thread_stacksize_default),
         priority_(thread_priority_default),
-        os_thread_(std::size_t(-1))
+        os_thread_(std::size_t(-1)),
+        deadline_(0)
     {}
 
     default_executor::default_executor(thread_priority priority,
-        thread_stacksize stacksize, std::size_t os_thread)
+        thread_stacksize stacksize, std::size_t os_thread,
+        thread_affinity_hint hint, std::uint64_t deadline)
       : stacksize_(stacksize),
         priority_(priority),
-        os_thread_(os_thread)
+        os_thread_(os_thread),
+        hint_(hint),
+        deadline_(deadline)
     {}
 
+    namespace
+    {
+        threads::thread_result_type thread_function_nullary(
+            default_executor::closure_type func)
+        {
+            // execute the actual thread function
+            func();
+
+            // Verify that there are no more registered locks for this
+            // OS-thread. This will throw if there are still any locks
+            // held.
+            util::force_error_on_lock();
+
+            return threads::thread_result_type(threads::terminated, nullptr);
+        }
+    }
+
+    thread_id_type default_executor::register_thread(closure_type&& f,
+        util::thread_description const& desc,
+        threads::thread_state_enum initial_state, bool run_now,
+        threads::thread_stacksize stacksize, error_code& ec)
+    {
+        if (!hint_.valid() && deadline_ == 0)
+        {
+            return register_thread_nullary(std::move(f), desc, initial_state,
+                run_now, priority_, os_thread_, stacksize, ec);
+        }
+
+        // the affinity hint and the deadline are passed on to the scheduler
+        // as part of the thread's initialization data
+        util::thread_description d = desc ? desc :
+            util::thread_description(f, "default_executor::register_thread");
+
+        threads::thread_init_data data(
+            util::bind(util::one_shot(&thread_function_nullary), std::move(f)),
+            d, 0, priority_, os_thread_, threads::get_stack_size(stacksize));
+        data.affinity_hint = hint_.key_;
+        if (deadline_ != 0)
+            data.deadline = util::high_resolution_clock::now() + deadline_;
+
+        return register_thread_plain(data, initial_state, run_now, ec);
+    }
+
     // Schedule the specified function for execution in this executor.
     // Depending on the subclass implementation, this may block in some
     // situations.
@@ -45,8 +96,8 @@ namespace hpx { namespace threads { namespace executors { namespace detail
         if (stacksize == threads::thread_stacksize_default)
             stacksize = stacksize_;
 
-        register_thread_nullary(std::move(f), desc, initial_state, run_now,
-            priority_, os_thread_, stacksize, ec);
+        register_thread(std::move(f), desc, initial_state, run_now,
+            stacksize, ec);
     }
 
     // Schedule given function for execution in this executor no sooner
@@ -61,9 +112,8 @@ namespace hpx { namespace threads { namespace executors { namespace detail
             stacksize = stacksize_;
 
         // create new thread
-        thread_id_type id = register_thread_nullary(
-            std::move(f), description, suspended, false,
-            priority_, os_thread_, stacksize, ec);
+        thread_id_type id = register_thread(
+            std::move(f), description, suspended, false, stacksize, ec);
         if (ec) return;
 
         HPX_ASSERT(invalid_thread_id != id);    // would throw otherwise
@@ -13,6 +13,9 @@
 #include <hpx/performance_counters/manage_counter_type.hpp>
 #include <hpx/runtime/threads/topology.hpp>
 #include <hpx/runtime/threads/threadmanager_impl.hpp>
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+#include <hpx/runtime/threads/coroutines/detail/stack_pool.hpp>
+#endif
 #include <hpx/runtime/threads/thread_data.hpp>
 #include <hpx/runtime/threads/thread_helpers.hpp>
 #include <hpx/runtime/threads/thread_init_data.hpp>
@@ -125,6 +128,7 @@ namespace hpx { namespace threads
             "medium",
             "large",
             "huge",
+            "nostack",
         };
     }
 
@@ -142,8 +146,10 @@ namespace hpx { namespace threads
             size = thread_stacksize_large;
         else if (rtcfg.get_stack_size(thread_stacksize_huge) == size)
             size = thread_stacksize_huge;
+        else if (rtcfg.get_stack_size(thread_stacksize_nostack) == size)
+            size = thread_stacksize_nostack;
 
-        if (size < thread_stacksize_small || size > thread_stacksize_huge)
+        if (size < thread_stacksize_small || size > thread_stacksize_nostack)
             return "custom";
 
         return strings::stack_size_names[size-1];
@@ -589,6 +595,9 @@ namespace hpx { namespace threads
 
         typedef detail::thread_pool<scheduling_policy_type> spt;
         typedef threadmanager_impl ti;
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+        typedef coroutines::detail::posix::stack_pool stack_pool;
+#endif
 
         using util::placeholders::_1;
 
@@ -760,6 +769,46 @@ namespace hpx { namespace threads
               util::function_nonser<boost::uint64_t(bool)>(), "", 0
             },
 #endif
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+            // /threads{locality#%d/total}/stacks/pool-hits
+            { "stacks/pool-hits",
+              util::bind(&stack_pool::get_hit_count, _1),
+              util::function_nonser<boost::uint64_t(bool)>(), "", 0
+            },
+            // /threads{locality#%d/total}/stacks/pool-misses
+            { "stacks/pool-misses",
+              util::bind(&stack_pool::get_miss_count, _1),
+              util::function_nonser<boost::uint64_t(bool)>(), "", 0
+            },
+            // /threads{locality#%d/total}/stacks/pool-size
+            { "stacks/pool-size",
+              util::bind(&stack_pool::get_pooled_count, _1),
+              util::function_nonser<boost::uint64_t(bool)>(), "", 0
+            },
+            // /threads{locality#%d/total}/stacks/pool-resident
+            { "stacks/pool-resident",
+              util::bind(&stack_pool::get_resident_size, _1),
+              util::function_nonser<boost::uint64_t(bool)>(), "", 0
+            },
+#endif
+            // /threads{locality#%d/total}/slabs/objects
+            // /threads{locality#%d/worker-thread%d}/slabs/objects
+            { "slabs/objects",
+              util::bind(&spt::get_thread_data_count, &pool_,
+                  std::size_t(-1), _1),
+              util::bind(&spt::get_thread_data_count, &pool_,
+                  static_cast<std::size_t>(paths.instanceindex_), _1),
+              "worker-thread", shepherd_count
+            },
+            // /threads{locality#%d/total}/slabs/capacity
+            // /threads{locality#%d/worker-thread%d}/slabs/capacity
+            { "slabs/capacity",
+              util::bind(&spt::get_thread_data_capacity, &pool_,
+                  std::size_t(-1), _1),
+              util::bind(&spt::get_thread_data_capacity, &pool_,
+                  static_cast<std::size_t>(paths.instanceindex_), _1),
+              "worker-thread", shepherd_count
+            },
             // /threads{locality#%d/total}/count/objects
             // /threads{locality#%d/allocator%d}/count/objects
             { "count/objects",
@@ -768,6 +817,47 @@ namespace hpx { namespace threads
                   static_cast<std::size_t>(paths.instanceindex_), _1),
               "allocator", HPX_COROUTINE_NUM_ALL_HEAPS
             },
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+            // /threads{locality#%d/total}/time/parked
+            // /threads{locality#%d/worker-thread%d}/time/parked
+            { "time/parked",
+              util::bind(&spt::get_parked_time, &pool_,
+                  std::size_t(-1), _1),
+              util::bind(&spt::get_parked_time, &pool_,
+                  static_cast<std::size_t>(paths.instanceindex_), _1),
+              "worker-thread", shepherd_count
+            },
+            // /threads{locality#%d/total}/count/wakeups
+            // /threads{locality#%d/worker-thread%d}/count/wakeups
+            { "count/wakeups",
+              util::bind(&spt::get_wakeup_count, &pool_,
+                  std::size_t(-1), _1),
+              util::bind(&spt::get_wakeup_count, &pool_,
+                  static_cast<std::size_t>(paths.instanceindex_), _1),
+              "worker-thread", shepherd_count
+            },
+            // /threads{locality#%d/total}/time/average-wakeup-latency
+            // /threads{locality#%d/worker-thread%d}/time/average-wakeup-latency
+            { "time/average-wakeup-latency",
+              util::bind(&spt::get_average_wakeup_latency, &pool_,
+                  std::size_t(-1), _1),
+              util::bind(&spt::get_average_wakeup_latency, &pool_,
+                  static_cast<std::size_t>(paths.instanceindex_), _1),
+              "worker-thread", shepherd_count
+            },
+#endif
+#if defined(HPX_HAVE_DEADLINE_SCHEDULER)
+            // /threads{locality#%d/total}/count/deadlines
+            { "count/deadlines",
+              util::bind(&spt::get_deadline_thread_count, &pool_, _1),
+              util::function_nonser<boost::uint64_t(bool)>(), "", 0
+            },
+            // /threads{locality#%d/total}/count/missed-deadlines
+            { "count/missed-deadlines",
+              util::bind(&spt::get_missed_deadline_count, &pool_, _1),
+              util::function_nonser<boost::uint64_t(bool)>(), "", 0
+            },
+#endif
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
             // /threads{locality#%d/total}/count/pending-misses
             // /threads{locality#%d/worker-thread%d}/count/pending-misses
@@ -822,6 +912,46 @@ namespace hpx { namespace threads
               util::bind(&spt::get_num_stolen_to_staged, &pool_,
                   static_cast<std::size_t>(paths.instanceindex_), _1),
               "worker-thread", shepherd_count
+            },
+            // /threads{locality#%d/total}/count/steals/core
+            // /threads{locality#%d/worker-thread%d}/count/steals/core
+            { "count/steals/core",
+              util::bind(&spt::get_num_steals, &pool_,
+                  policies::steal_level_core, std::size_t(-1), _1),
+              util::bind(&spt::get_num_steals, &pool_,
+                  policies::steal_level_core,
+                  static_cast<std::size_t>(paths.instanceindex_), _1),
+              "worker-thread", shepherd_count
+            },
+            // /threads{locality#%d/total}/count/steals/numa-node
+            // /threads{locality#%d/worker-thread%d}/count/steals/numa-node
+            { "count/steals/numa-node",
+              util::bind(&spt::get_num_steals, &pool_,
+                  policies::steal_level_numa_node, std::size_t(-1), _1),
+              util::bind(&spt::get_num_steals, &pool_,
+                  policies::steal_level_numa_node,
+                  static_cast<std::size_t>(paths.instanceindex_), _1),
+              "worker-thread", shepherd_count
+            },
+            // /threads{locality#%d/total}/count/steals/socket
+            // /threads{locality#%d/worker-thread%d}/count/steals/socket
+            { "count/steals/socket",
+              util::bind(&spt::get_num_steals, &pool_,
+                  policies::steal_level_socket, std::size_t(-1), _1),
+              util::bind(&spt::get_num_steals, &pool_,
+                  policies::steal_level_socket,
+                  static_cast<std::size_t>(paths.instanceindex_), _1),
+              "worker-thread", shepherd_count
+            },
+            // /threads{locality#%d/total}/count/steals/machine
+            // /threads{locality#%d/worker-thread%d}/count/steals/machine
+            { "count/steals/machine",
+              util::bind(&spt::get_num_steals, &pool_,
+                  policies::steal_level_machine, std::size_t(-1), _1),
+              util::bind(&spt::get_num_steals, &pool_,
+                  policies::steal_level_machine,
+                  static_cast<std::size_t>(paths.instanceindex_), _1),
+              "worker-thread", shepherd_count
             }
 #endif
         };
@@ -1024,6 +1154,52 @@ namespace hpx { namespace threads
               ""
             },
 #endif
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+            { "/threads/stacks/pool-hits", performance_counters::counter_raw,
+              "returns the total number of HPX-thread stacks which were taken "
+              "from the stack pool for the referenced locality",
+              HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { "/threads/stacks/pool-misses", performance_counters::counter_raw,
+              "returns the total number of HPX-thread stacks which had to be "
+              "newly allocated as the stack pool was empty for the referenced "
+              "locality", HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { "/threads/stacks/pool-size", performance_counters::counter_raw,
+              "returns the current number of HPX-thread stacks held by the "
+              "stack pool for the referenced locality",
+              HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { "/threads/stacks/pool-resident", performance_counters::counter_raw,
+              "returns the (estimated) amount of memory held by the stacks in "
+              "the stack pool which was not released to the operating system "
+              "for the referenced locality", HPX_PERFORMANCE_COUNTER_V1,
+              counts_creator, &performance_counters::locality_counter_discoverer,
+              "bytes"
+            },
+#endif
+            { "/threads/slabs/objects", performance_counters::counter_raw,
+              "returns the number of HPX-thread objects currently allocated "
+              "from the slab allocators of the referenced worker-thread "
+              "for the referenced locality", HPX_PERFORMANCE_COUNTER_V1,
+              counts_creator,
+              &performance_counters::locality_thread_counter_discoverer,
+              ""
+            },
+            { "/threads/slabs/capacity", performance_counters::counter_raw,
+              "returns the number of HPX-thread objects the slabs allocated "
+              "by the slab allocators of the referenced worker-thread can hold "
+              "for the referenced locality", HPX_PERFORMANCE_COUNTER_V1,
+              counts_creator,
+              &performance_counters::locality_thread_counter_discoverer,
+              ""
+            },
             { "/threads/count/objects", performance_counters::counter_raw,
               "returns the overall number of created HPX-thread objects for "
               "the referenced locality", HPX_PERFORMANCE_COUNTER_V1,
@@ -1031,6 +1207,50 @@ namespace hpx { namespace threads
               &locality_allocator_counter_discoverer,
               ""
             },
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+            { "/threads/time/parked", performance_counters::counter_raw,
+              "returns the overall time the referenced worker-thread has been "
+              "put to sleep because it did not find any work "
+              "for the referenced locality", HPX_PERFORMANCE_COUNTER_V1,
+              counts_creator,
+              &performance_counters::locality_thread_counter_discoverer,
+              "ns"
+            },
+            { "/threads/count/wakeups", performance_counters::counter_raw,
+              "returns the number of times the referenced worker-thread was "
+              "woken up from sleeping because of newly scheduled work "
+              "for the referenced locality", HPX_PERFORMANCE_COUNTER_V1,
+              counts_creator,
+              &performance_counters::locality_thread_counter_discoverer,
+              ""
+            },
+            { "/threads/time/average-wakeup-latency",
+              performance_counters::counter_raw,
+              "returns the average time between new work being scheduled and "
+              "the referenced sleeping worker-thread being woken up "
+              "for the referenced locality", HPX_PERFORMANCE_COUNTER_V1,
+              counts_creator,
+              &performance_counters::locality_thread_counter_discoverer,
+              "ns"
+            },
+#endif
+#if defined(HPX_HAVE_DEADLINE_SCHEDULER)
+            { "/threads/count/deadlines", performance_counters::counter_raw,
+              "returns the total number of terminated HPX-threads which had "
+              "a deadline for the referenced locality",
+              HPX_PERFORMANCE_COUNTER_V1,
+              counts_creator, &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { "/threads/count/missed-deadlines",
+              performance_counters::counter_raw,
+              "returns the total number of HPX-threads which completed after "
+              "their deadline for the referenced locality (supported by the "
+              "deadline scheduler only)", HPX_PERFORMANCE_COUNTER_V1,
+              counts_creator, &performance_counters::locality_counter_discoverer,
+              ""
+            },
+#endif
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
             { "/threads/count/pending-misses", performance_counters::counter_raw,
               "returns the number of times that the referenced worker-thread "
@@ -1075,6 +1295,39 @@ namespace hpx { namespace threads
               counts_creator,
               &performance_counters::locality_thread_counter_discoverer,
               ""
+            },
+            { "/threads/count/steals/core", performance_counters::counter_raw,
+              "returns the number of successful steal operations the referenced "
+              "worker-thread performed on SMT siblings (worker-threads running on "
+              "the same core) "
+              "for the referenced locality", HPX_PERFORMANCE_COUNTER_V1,
+              counts_creator,
+              &performance_counters::locality_thread_counter_discoverer,
+              ""
+            },
+            { "/threads/count/steals/numa-node", performance_counters::counter_raw,
+              "returns the number of successful steal operations the referenced "
+              "worker-thread performed on other cores of the same NUMA domain "
+              "for the referenced locality", HPX_PERFORMANCE_COUNTER_V1,
+              counts_creator,
+              &performance_counters::locality_thread_counter_discoverer,
+              ""
+            },
+            { "/threads/count/steals/socket", performance_counters::counter_raw,
+              "returns the number of successful steal operations the referenced "
+              "worker-thread performed on other NUMA domains of the same socket "
+              "for the referenced locality", HPX_PERFORMANCE_COUNTER_V1,
+              counts_creator,
+              &performance_counters::locality_thread_counter_discoverer,
+              ""
+            },
+            { "/threads/count/steals/machine", performance_counters::counter_raw,
+              "returns the number of successful steal operations the referenced "
+              "worker-thread performed on remote sockets "
+              "for the referenced locality", HPX_PERFORMANCE_COUNTER_V1,
+              counts_creator,
+              &performance_counters::locality_thread_counter_discoverer,
+              ""
             }
 #endif
         };
@@ -1257,12 +1510,29 @@ template class HPX_EXPORT hpx::threads::threadmanager_impl<
 #include <hpx/runtime/threads/policies/local_priority_queue_scheduler.hpp>
 template class HPX_EXPORT hpx::threads::threadmanager_impl<
     hpx::threads::policies::local_priority_queue_scheduler<> >;
+template class HPX_EXPORT hpx::threads::threadmanager_impl<
+    hpx::threads::policies::lockfree_map_priority_queue_scheduler>;
 
 #if defined(HPX_HAVE_ABP_SCHEDULER)
 template class HPX_EXPORT hpx::threads::threadmanager_impl<
     hpx::threads::policies::abp_fifo_priority_queue_scheduler>;
 #endif
 
+#if defined(HPX_HAVE_CHASE_LEV_SCHEDULER)
+template class HPX_EXPORT hpx::threads::threadmanager_impl<
+    hpx::threads::policies::chase_lev_priority_queue_scheduler>;
+#if defined(HPX_HAVE_LOCAL_SCHEDULER)
+template class HPX_EXPORT hpx::threads::threadmanager_impl<
+    hpx::threads::policies::chase_lev_queue_scheduler>;
+#endif
+#endif
+
+#if defined(HPX_HAVE_DEADLINE_SCHEDULER)
+#include <hpx/runtime/threads/policies/deadline_queue_scheduler.hpp>
+template class HPX_EXPORT hpx::threads::threadmanager_impl<
+    hpx::threads::policies::deadline_queue_scheduler<> >;
+#endif
+
 #if defined(HPX_HAVE_HIERARCHY_SCHEDULER)
 #include <hpx/runtime/threads/policies/hierarchy_scheduler.hpp>
 template class HPX_EXPORT hpx::threads::threadmanager_impl<
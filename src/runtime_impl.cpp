@@ -828,12 +828,29 @@ template class HPX_EXPORT hpx::runtime_impl<
 #include <hpx/runtime/threads/policies/local_priority_queue_scheduler.hpp>
 template class HPX_EXPORT hpx::runtime_impl<
     hpx::threads::policies::local_priority_queue_scheduler<> >;
+template class HPX_EXPORT hpx::runtime_impl<
+    hpx::threads::policies::lockfree_map_priority_queue_scheduler>;
 
 #if defined(HPX_HAVE_ABP_SCHEDULER)
 template class HPX_EXPORT hpx::runtime_impl<
     hpx::threads::policies::abp_fifo_priority_queue_scheduler>;
 #endif
 
+#if defined(HPX_HAVE_CHASE_LEV_SCHEDULER)
+template class HPX_EXPORT hpx::runtime_impl<
+    hpx::threads::policies::chase_lev_priority_queue_scheduler>;
+#if defined(HPX_HAVE_LOCAL_SCHEDULER)
+template class HPX_EXPORT hpx::runtime_impl<
+    hpx::threads::policies::chase_lev_queue_scheduler>;
+#endif
+#endif
+
+#if defined(HPX_HAVE_DEADLINE_SCHEDULER)
+#include <hpx/runtime/threads/policies/deadline_queue_scheduler.hpp>
+template class HPX_EXPORT hpx::runtime_impl<
+    hpx::threads::policies::deadline_queue_scheduler<> >;
+#endif
+
 #if defined(HPX_HAVE_HIERARCHY_SCHEDULER)
 #include <hpx/runtime/threads/policies/hierarchy_scheduler.hpp>
 template class HPX_EXPORT hpx::runtime_impl<
@@ -202,14 +202,13 @@ namespace hpx { namespace util { namespace detail
                 result = f_();            // invoke the supplied function
             }
 
-            // some other thread might already have started the timer
+            // some other thread might already have started the timer,
+            // otherwise a result of false leaves the timer stopped, it can
+            // be started again
             if (nullptr == id_ && result) {
                 HPX_ASSERT(!is_started_);
                 schedule_thread(l);        // wait and repeat
             }
-
-            if (!result)
-                is_terminated_ = true;
         }
         catch (hpx::exception const& e){
             // the lock above might throw yield_aborted
@@ -449,17 +449,24 @@ namespace hpx { namespace util
                  "the number of total cores in the system)")
                 ("hpx:queuing", value<std::string>(),
                   "the queue scheduling policy to use, options are "
-                  "'local', 'local-priority', 'abp-priority', "
-                  "'hierarchy', 'static', 'static-priority', and "
-                  "'periodic-priority' (default: 'local-priority'; "
+                  "'local', 'local-priority', 'local-priority-lockfree', "
+                  "'abp-priority', 'chase-lev', "
+                  "'chase-lev-priority', 'deadline', 'hierarchy', 'static', "
+                  "'static-priority', and 'periodic-priority' "
+                  "(default: 'local-priority'; "
                   "all option values can be abbreviated)")
-                ("hpx:hierarchy-arity", value<std::size_t>(),
-                  "the arity of the of the thread queue tree, valid for "
-                   "--hpx:queuing=hierarchy only (default: 2)")
+                ("hpx:hierarchy-arity", value<std::string>(),
+                  "the arity of the of the thread queue tree, either "
+                  "'topology' or a comma separated list of the arities of "
+                  "the levels of the tree (from the leaves to the root), "
+                  "valid for --hpx:queuing=hierarchy only "
+                  "(default: 'topology')")
                 ("hpx:high-priority-threads", value<std::size_t>(),
                   "the number of operating system threads maintaining a high "
                   "priority queue (default: number of OS threads), valid for "
                   "--hpx:queuing=local-priority,--hpx:queuing=static-priority, "
+                  "--hpx:queuing=chase-lev-priority, "
+                  "--hpx:queuing=deadline, "
                   " and --hpx:queuing=abp-priority only)")
                 ("hpx:numa-sensitive", value<std::size_t>()->implicit_value(0),
                   "makes the local-priority scheduler NUMA sensitive ("
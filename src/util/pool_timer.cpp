@@ -47,6 +47,8 @@ namespace hpx { namespace util { namespace detail
         ~pool_timer();
 
         bool start(bool evaluate);
+        bool start(util::steady_clock::time_point const& abs_time,
+            bool evaluate);
         bool stop();
 
         bool is_started() const { return is_started_; }
@@ -54,6 +56,8 @@ namespace hpx { namespace util { namespace detail
         void timer_handler();
 
         void terminate();             // handle system shutdown
+        bool start_locked(std::unique_lock<mutex_type>& l,
+            util::steady_clock::time_point const& abs_time, bool evaluate);
         bool stop_locked();
 
     private:
@@ -112,6 +116,20 @@ namespace hpx { namespace util { namespace detail
     bool pool_timer::start(bool evaluate_)
     {
         std::unique_lock<mutex_type> l(mtx_);
+        return start_locked(l, abs_time_, evaluate_);
+    }
+
+    bool pool_timer::start(util::steady_clock::time_point const& abs_time,
+        bool evaluate_)
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+        return start_locked(l, abs_time, evaluate_);
+    }
+
+    bool pool_timer::start_locked(std::unique_lock<mutex_type>& l,
+        util::steady_clock::time_point const& abs_time, bool evaluate_)
+    {
+        HPX_ASSERT(l.owns_lock());
         if (is_terminated_)
             return false;
 
@@ -136,6 +154,7 @@ namespace hpx { namespace util { namespace detail
 
             is_stopped_ = false;
             is_started_ = true;
+            abs_time_ = abs_time;
 
             HPX_ASSERT(timer_ != nullptr);
             timer_->expires_at(abs_time_);
@@ -225,6 +244,12 @@ namespace hpx { namespace util
         return timer_->start(evaluate);
     }
 
+    bool pool_timer::start(hpx::util::steady_duration const& time_duration,
+        bool evaluate)
+    {
+        return timer_->start(time_duration.from_now(), evaluate);
+    }
+
     bool pool_timer::stop()
     {
         return timer_->stop();
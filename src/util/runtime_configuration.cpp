@@ -9,6 +9,9 @@
 #include <hpx/config/defaults.hpp>
 // TODO: move parcel ports into plugins
 #include <hpx/runtime/parcelset/parcelhandler.hpp>
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+#include <hpx/runtime/threads/coroutines/detail/stack_pool.hpp>
+#endif
 #include <hpx/util/filesystem_compatibility.hpp>
 #include <hpx/util/find_prefix.hpp>
 #include <hpx/util/init_ini_data.hpp>
@@ -187,6 +190,10 @@ namespace hpx { namespace util
             "pu_offset = 0",
             "numa_sensitive = 0",
             "max_background_threads = ${MAX_BACKGROUND_THREADS:$[hpx.os_threads]}",
+            "max_idle_backoff_time = ${HPX_MAX_IDLE_BACKOFF_TIME:"
+                BOOST_PP_STRINGIZE(HPX_IDLE_BACKOFF_TIME_MAX) "}",
+            "max_awake_background_threads = "
+                "${HPX_MAX_AWAKE_BACKGROUND_THREADS:1}",
 
             // connect back to the given latch if specified
             "[hpx.on_startup]",
@@ -204,6 +211,10 @@ namespace hpx { namespace util
 #if defined(__linux) || defined(linux) || defined(__linux__) || defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
 #endif
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+            "pool_low_watermark = ${HPX_STACK_POOL_LOW_WATERMARK:64}",
+            "pool_high_watermark = ${HPX_STACK_POOL_HIGH_WATERMARK:1024}",
+#endif
 
             "[hpx.threadpools]",
             "io_pool_size = ${HPX_NUM_IO_POOL_SIZE:"
@@ -255,10 +266,14 @@ namespace hpx { namespace util
                 "${HPX_AGAS_MAX_PENDING_REFCNT_REQUESTS:"
                 BOOST_PP_STRINGIZE(HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS)
                 "}",
+            "refcnt_flush_interval = ${HPX_AGAS_REFCNT_FLUSH_INTERVAL:"
+                BOOST_PP_STRINGIZE(HPX_AGAS_REFCNT_FLUSH_INTERVAL) "}",
             "service_mode = hosted",
             "dedicated_server = 0",
             "local_cache_size = ${HPX_AGAS_LOCAL_CACHE_SIZE:"
                 BOOST_PP_STRINGIZE(HPX_AGAS_LOCAL_CACHE_SIZE) "}",
+            "local_cache_shards = ${HPX_AGAS_LOCAL_CACHE_SHARDS:"
+                BOOST_PP_STRINGIZE(HPX_AGAS_LOCAL_CACHE_SHARDS) "}",
             "use_range_caching = ${HPX_AGAS_USE_RANGE_CACHING:1}",
             "use_caching = ${HPX_AGAS_USE_CACHING:1}",
 
@@ -467,6 +482,11 @@ namespace hpx { namespace util
         threads::coroutines::detail::posix::use_guard_pages =
             init_use_stack_guard_pages();
 #endif
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+        threads::coroutines::detail::posix::stack_pool::set_watermarks(
+            init_stack_pool_watermark("pool_low_watermark", 64),
+            init_stack_pool_watermark("pool_high_watermark", 1024));
+#endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
         if (enable_lock_detection())
             util::enable_lock_detection();
@@ -528,6 +548,11 @@ namespace hpx { namespace util
         threads::coroutines::detail::posix::use_guard_pages =
             init_use_stack_guard_pages();
 #endif
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+        threads::coroutines::detail::posix::stack_pool::set_watermarks(
+            init_stack_pool_watermark("pool_low_watermark", 64),
+            init_stack_pool_watermark("pool_high_watermark", 1024));
+#endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
         if (enable_lock_detection())
             util::enable_lock_detection();
@@ -660,6 +685,23 @@ namespace hpx { namespace util
         return cache_size;
     }
 
+    std::size_t runtime_configuration::get_agas_local_cache_shards() const
+    {
+        std::size_t num_shards = HPX_AGAS_LOCAL_CACHE_SHARDS;
+
+        if (has_section("hpx.agas")) {
+            util::section const* sec = get_section("hpx.agas");
+            if (nullptr != sec) {
+                num_shards = hpx::util::get_entry_as<std::size_t>(
+                    *sec, "local_cache_shards", num_shards);
+            }
+        }
+
+        if (num_shards == 0)
+            num_shards = 1;      // limit lower bound
+        return num_shards;
+    }
+
     bool runtime_configuration::get_agas_caching_mode() const
     {
         if (has_section("hpx.agas")) {
@@ -698,6 +740,20 @@ namespace hpx { namespace util
         return HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS;
     }
 
+    std::size_t
+    runtime_configuration::get_agas_refcnt_flush_interval() const
+    {
+        if (has_section("hpx.agas")) {
+            util::section const* sec = get_section("hpx.agas");
+            if (nullptr != sec) {
+                return hpx::util::get_entry_as<std::size_t>(
+                    *sec, "refcnt_flush_interval",
+                    HPX_AGAS_REFCNT_FLUSH_INTERVAL);
+            }
+        }
+        return HPX_AGAS_REFCNT_FLUSH_INTERVAL;
+    }
+
     // Get whether the AGAS server is running as a dedicated runtime.
     // This decides whether the AGAS actions are executed with normal
     // priority (if dedicated) or with high priority (non-dedicated)
@@ -920,6 +976,21 @@ namespace hpx { namespace util
     }
 #endif
 
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+    std::size_t runtime_configuration::init_stack_pool_watermark(
+        char const* entryname, std::size_t defaultvalue) const
+    {
+        if (has_section("hpx")) {
+            util::section const* sec = get_section("hpx.stacks");
+            if (nullptr != sec) {
+                return hpx::util::get_entry_as<std::size_t>(
+                    *sec, entryname, defaultvalue);
+            }
+        }
+        return defaultvalue;
+    }
+#endif
+
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
     {
         return init_stack_size("small_size",
@@ -1011,6 +1082,9 @@ namespace hpx { namespace util
         case threads::thread_stacksize_huge:
             return huge_stacksize;
 
+        case threads::thread_stacksize_nostack:
+            return 0;       // stackless threads don't need any stack
+
         default:
         case threads::thread_stacksize_small:
             break;
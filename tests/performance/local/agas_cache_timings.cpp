@@ -13,6 +13,8 @@
 
 #include <hpx/util/cache/entries/lfu_entry.hpp>
 #include <hpx/util/cache/local_cache.hpp>
+#include <hpx/util/cache/lru_cache.hpp>
+#include <hpx/util/cache/sharded_cache.hpp>
 #include <hpx/util/cache/statistics/local_full_statistics.hpp>
 #include <hpx/util/histogram.hpp>
 
@@ -22,8 +24,10 @@
 #include <boost/accumulators/accumulators.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -107,6 +111,60 @@ typedef hpx::util::cache::local_cache<
     hpx::util::cache::statistics::local_full_statistics
 > gva_cache_type;
 
+///////////////////////////////////////////////////////////////////////////////
+// The AGAS cache as used today: an lru_cache split into independently locked
+// shards, compared with the same cache protected by a single lock
+typedef hpx::util::cache::lru_cache<
+    gva_cache_key, hpx::agas::gva,
+    hpx::util::cache::statistics::local_full_statistics
+> lru_gva_cache_type;
+
+struct gva_cache_sharding
+{
+    std::size_t operator()(gva_cache_key const& key,
+        std::size_t num_shards) const
+    {
+        if (key.get_count() != 1)
+            return num_shards;
+
+        hpx::naming::gid_type const gid = key.get_gid();
+        return static_cast<std::size_t>(
+            (gid.get_lsb() + gid.get_msb() * 0x9e3779b97f4a7c15ull) %
+                num_shards);
+    }
+};
+
+typedef hpx::util::cache::sharded_cache<
+    lru_gva_cache_type, gva_cache_sharding
+> sharded_gva_cache_type;
+
+struct locked_gva_cache_type
+{
+    typedef hpx::lcos::local::spinlock mutex_type;
+
+    bool get_entry(gva_cache_key const& key, gva_cache_key& idbase,
+        hpx::agas::gva& e)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return cache_.get_entry(key, idbase, e);
+    }
+
+    template <typename F>
+    bool update_if(gva_cache_key const& key, hpx::agas::gva const& e, F && f)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return cache_.update_if(key, e, std::forward<F>(f));
+    }
+
+    void reserve(std::size_t size)
+    {
+        cache_.reserve(size);
+    }
+
+    mutex_type mtx_;
+    lru_gva_cache_type cache_;
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 void calculate_histogram(std::string const& prefix,
     std::vector<boost::uint64_t> const& timings)
@@ -213,6 +271,109 @@ void test_update(gva_cache_type& cache, hpx::naming::gid_type first_key)
     calculate_histogram("update", timings);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Look up all entries from all worker threads concurrently, report the
+// average time per lookup
+template <typename Cache>
+void test_concurrent_get(char const* prefix, Cache& cache,
+    std::size_t num_entries)
+{
+    hpx::naming::gid_type locality = hpx::get_locality();
+    boost::uint32_t ct = hpx::components::component_invalid;
+
+    std::vector<hpx::naming::gid_type> keys;
+    keys.reserve(num_entries);
+
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        keys.push_back(hpx::detail::get_next_id());
+        cache.update_if(gva_cache_key(keys.back(), 1),
+            hpx::agas::gva(locality, ct, 1, boost::uint64_t(0), 0),
+            [](gva_cache_key const&, gva_cache_key const&)
+            {
+                return false;
+            });
+    }
+
+    std::size_t num_threads = hpx::get_os_thread_count();
+
+    boost::uint64_t t = hpx::util::high_resolution_clock::now();
+
+    std::vector<hpx::future<void> > lookups;
+    lookups.reserve(num_threads);
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        lookups.push_back(hpx::async(
+            [&cache, &keys]()
+            {
+                for (hpx::naming::gid_type const& id : keys)
+                {
+                    gva_cache_key idbase;
+                    hpx::agas::gva e;
+                    cache.get_entry(gva_cache_key(id, 1), idbase, e);
+                }
+            }));
+    }
+    hpx::wait_all(lookups);
+
+    t = hpx::util::high_resolution_clock::now() - t;
+
+    std::cout << prefix << ": " << num_threads << " threads, "
+              << double(t) / double(num_threads * num_entries)
+              << " [ns] per lookup" << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Invoke an action on freshly created objects, report the time needed for the
+// first invocation and the number of AGAS cache misses caused by it
+struct test_server
+  : hpx::components::simple_component_base<test_server>
+{
+    void call() {}
+
+    HPX_DEFINE_COMPONENT_ACTION(test_server, call, call_action);
+};
+
+typedef hpx::components::simple_component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server);
+
+typedef test_server::call_action call_action;
+HPX_REGISTER_ACTION(call_action);
+
+void test_first_invocation(hpx::id_type const& there, std::size_t num_entries)
+{
+    std::vector<hpx::id_type> ids;
+    ids.reserve(num_entries);
+
+    for (std::size_t i = 0; i != num_entries; ++i)
+        ids.push_back(hpx::new_<test_server>(there).get());
+
+    hpx::performance_counters::performance_counter cache_misses(
+        "/agas/count/cache/misses", hpx::find_here());
+    boost::int64_t misses =
+        cache_misses.get_value<boost::int64_t>(hpx::launch::sync);
+
+    std::vector<boost::uint64_t> timings;
+    timings.reserve(num_entries);
+
+    call_action call;
+    for (hpx::id_type const& id : ids)
+    {
+        boost::uint64_t t = hpx::util::high_resolution_clock::now();
+
+        call(id);
+
+        timings.push_back(hpx::util::high_resolution_clock::now() - t);
+    }
+
+    misses = cache_misses.get_value<boost::int64_t>(hpx::launch::sync) - misses;
+
+    calculate_histogram(" first", timings);
+    std::cout << " first: " << num_entries << " objects on locality "
+              << hpx::naming::get_locality_id_from_id(there) << ", "
+              << misses << " AGAS cache misses" << std::endl;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(boost::program_options::variables_map& vm)
 {
@@ -233,6 +394,21 @@ int hpx_main(boost::program_options::variables_map& vm)
     test_get(cache, first_key);
     test_update(cache, first_key);
 
+    {
+        locked_gva_cache_type locked_cache;
+        locked_cache.reserve(cache_size);
+        test_concurrent_get(" locked", locked_cache, num_entries);
+    }
+
+    {
+        sharded_gva_cache_type sharded_cache(HPX_AGAS_LOCAL_CACHE_SHARDS);
+        sharded_cache.reserve(cache_size);
+        test_concurrent_get("sharded", sharded_cache, num_entries);
+    }
+
+    // create the objects on a remote locality, if possible
+    test_first_invocation(hpx::find_all_localities().back(), num_entries);
+
     return hpx::finalize();
 }
 
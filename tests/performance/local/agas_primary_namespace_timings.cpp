@@ -0,0 +1,186 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark hammers a local instance of the AGAS primary namespace with
+// concurrent bind/resolve/incref/decref/unbind requests and reports the
+// average time per request for each of them.
+
+#if defined(_MSC_VER)
+// conversion from uint64_t -> double, possible loss of precision
+#pragma warning (disable: 4244)
+#endif
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/runtime/agas/server/primary_namespace.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/program_options.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+using hpx::agas::request;
+using hpx::agas::server::primary_namespace;
+
+enum operation
+{
+    op_bind = 0,
+    op_resolve,
+    op_incref,
+    op_decref,
+    op_unbind,
+    op_count
+};
+
+char const* const operation_names[op_count] =
+{
+    "bind_gid",
+    "resolve_gid",
+    "increment_credit",
+    "decrement_credit",
+    "unbind_gid"
+};
+
+boost::atomic<boost::int64_t> elapsed[op_count];
+
+///////////////////////////////////////////////////////////////////////////////
+struct timed_operation
+{
+    explicit timed_operation(operation op)
+      : op_(op)
+      , started_at_(hpx::util::high_resolution_clock::now())
+    {}
+
+    ~timed_operation()
+    {
+        elapsed[op_] += static_cast<boost::int64_t>(
+            hpx::util::high_resolution_clock::now() - started_at_);
+    }
+
+    operation op_;
+    boost::uint64_t started_at_;
+};
+
+void hammer_primary_namespace(primary_namespace& pns,
+    std::vector<hpx::naming::gid_type> const& ids,
+    hpx::naming::gid_type const& locality)
+{
+    std::int64_t const credits = 16;
+
+    for (hpx::naming::gid_type const& id : ids)
+    {
+        hpx::agas::gva const g(locality, hpx::components::component_memory, 1,
+            id.get_lsb(), 0);
+
+        {
+            timed_operation t(op_bind);
+            pns.bind_gid(request(hpx::agas::primary_ns_bind_gid, id, g,
+                locality));
+        }
+
+        {
+            timed_operation t(op_resolve);
+            pns.resolve_gid(request(hpx::agas::primary_ns_resolve_gid, id));
+        }
+
+        {
+            timed_operation t(op_incref);
+            pns.increment_credit(request(
+                hpx::agas::primary_ns_increment_credit, id, id, credits));
+        }
+
+        {
+            timed_operation t(op_decref);
+            pns.decrement_credit(request(
+                hpx::agas::primary_ns_decrement_credit, id, id, -credits));
+        }
+
+        {
+            timed_operation t(op_unbind);
+            pns.unbind_gid(request(hpx::agas::primary_ns_unbind_gid, id,
+                boost::uint64_t(1)));
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    std::size_t num_entries = vm["num_entries"].as<std::size_t>();
+    std::size_t num_tasks = vm["num_tasks"].as<std::size_t>();
+    if (num_tasks == 0)
+        num_tasks = hpx::get_os_thread_count();
+
+    hpx::naming::gid_type locality = hpx::get_locality();
+
+    primary_namespace pns;
+    pns.set_local_locality(locality);
+
+    // each of the tasks works on a set of ids of its own
+    std::vector<std::vector<hpx::naming::gid_type> > ids(num_tasks);
+    for (std::vector<hpx::naming::gid_type>& task_ids : ids)
+    {
+        task_ids.reserve(num_entries);
+        for (std::size_t i = 0; i != num_entries; ++i)
+            task_ids.push_back(hpx::detail::get_next_id());
+    }
+
+    for (boost::atomic<boost::int64_t>& e : elapsed)
+        e.store(0);
+
+    boost::uint64_t t = hpx::util::high_resolution_clock::now();
+
+    std::vector<hpx::future<void> > tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async(&hammer_primary_namespace,
+            std::ref(pns), std::cref(ids[i]), std::cref(locality)));
+    }
+    hpx::wait_all(tasks);
+
+    t = hpx::util::high_resolution_clock::now() - t;
+
+    double const num_requests = double(num_tasks * num_entries);
+
+    std::cout << num_tasks << " tasks, " << num_entries
+              << " entries per task" << std::endl;
+    for (std::size_t op = 0; op != op_count; ++op)
+    {
+        std::cout << operation_names[op] << ": "
+                  << double(elapsed[op].load()) / num_requests
+                  << " [ns] per request" << std::endl;
+    }
+    std::cout << "overall (wall clock): "
+              << double(t) / (op_count * num_requests)
+              << " [ns] per request" << std::endl;
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("num_entries,n", value<std::size_t>()->default_value(10000),
+         "number of ids each task binds, resolves, and unbinds "
+         "(default: 10000)")
+        ("num_tasks", value<std::size_t>()->default_value(0),
+         "number of concurrent tasks (default: number of OS threads)")
+        ;
+
+    // Initialize and run HPX
+    return hpx::init(desc_commandline, argc, argv);
+}
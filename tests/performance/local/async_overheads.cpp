@@ -5,6 +5,7 @@
 
 #include <hpx/hpx.hpp>
 #include <hpx/hpx_init.hpp>
+#include <hpx/include/thread_executors.hpp>
 
 #include "worker_timed.hpp"
 
@@ -17,6 +18,10 @@ std::size_t num_level_tasks = 16;
 std::size_t spread = 2;
 boost::uint64_t delay_ns = 0;
 
+// with --nostack the spawned tasks don't get a stack of their own, they run on
+// a stack borrowed from the worker threads
+hpx::threads::thread_stacksize stacksize = hpx::threads::thread_stacksize_default;
+
 void test_func()
 {
     worker_timed(delay_ns);
@@ -25,6 +30,8 @@ void test_func()
 ///////////////////////////////////////////////////////////////////////////////
 hpx::future<void> spawn_level(std::size_t num_tasks)
 {
+    hpx::threads::executors::default_executor exec(stacksize);
+
     std::vector<hpx::future<void> > tasks;
     tasks.reserve(num_tasks);
 
@@ -43,13 +50,13 @@ hpx::future<void> spawn_level(std::size_t num_tasks)
             std::size_t sub_spawn = (std::min)(spawn_hierarchically, num_sub_tasks);
             spawn_hierarchically -= sub_spawn;
             num_tasks -= sub_spawn;
-            tasks.push_back(hpx::async(&spawn_level, sub_spawn));
+            tasks.push_back(hpx::async(exec, &spawn_level, sub_spawn));
         }
     }
 
     // then spawn required number of tasks on this level
     for (std::size_t i = 0; i != num_tasks; ++i)
-        tasks.push_back(hpx::async(&test_func));
+        tasks.push_back(hpx::async(exec, &test_func));
 
     return hpx::when_all(tasks);
 }
@@ -60,6 +67,10 @@ int hpx_main(boost::program_options::variables_map& vm)
     std::size_t num_tasks = 128;
     if (vm.count("tasks"))
         num_tasks = vm["tasks"].as<std::size_t>();
+    if (vm.count("nostack"))
+        stacksize = hpx::threads::thread_stacksize_nostack;
+
+    hpx::threads::executors::default_executor exec(stacksize);
 
     {
         std::vector<hpx::future<void> > tasks;
@@ -68,7 +79,7 @@ int hpx_main(boost::program_options::variables_map& vm)
         boost::uint64_t start = hpx::util::high_resolution_clock::now();
 
         for (std::size_t i = 0; i != num_tasks; ++i)
-            tasks.push_back(hpx::async(&test_func));
+            tasks.push_back(hpx::async(exec, &test_func));
 
         hpx::wait_all(tasks);
 
@@ -82,7 +93,7 @@ int hpx_main(boost::program_options::variables_map& vm)
     {
         boost::uint64_t start = hpx::util::high_resolution_clock::now();
 
-        hpx::future<void> f = hpx::async(&spawn_level, num_tasks);
+        hpx::future<void> f = hpx::async(exec, &spawn_level, num_tasks);
         hpx::wait_all(f);
 
         boost::uint64_t end = hpx::util::high_resolution_clock::now();
@@ -110,6 +121,8 @@ int main(int argc, char* argv[])
          "number of sub-spawns per level (default: 2)")
         ("delay,d", value<boost::uint64_t>(&delay_ns)->default_value(0),
          "time spent in the delay loop [ns]")
+        ("nostack",
+         "run all tasks on stackless threads (default: use the default stack size)")
         ;
 
     // Initialize and run HPX
@@ -12,6 +12,7 @@
 #include <hpx/util/high_resolution_timer.hpp>
 #include <hpx/include/async.hpp>
 #include <hpx/include/iostreams.hpp>
+#include <hpx/include/thread_executors.hpp>
 
 #include <stdexcept>
 #include <vector>
@@ -121,6 +122,41 @@ void measure_function_futures(boost::uint64_t count, bool csv)
               << flush;
 }
 
+void measure_function_futures_nostack(boost::uint64_t count, bool csv)
+{
+    // the threads running null_function don't get a stack of their own, they
+    // run on a stack borrowed from the worker threads
+    hpx::threads::executors::default_executor exec(
+        hpx::threads::thread_stacksize_nostack);
+
+    std::vector<future<double> > futures;
+
+    futures.reserve(count);
+
+    // start the clock
+    high_resolution_timer walltime;
+
+    for (boost::uint64_t i = 0; i < count; ++i)
+        futures.push_back(async(exec, &null_function));
+
+    wait_each(scratcher(), futures);
+
+    // stop the clock
+    const double duration = walltime.elapsed();
+
+    if (csv)
+        cout << ( boost::format("%1%,%2%\n")
+                % count
+                % duration)
+              << flush;
+    else
+        cout << ( boost::format("invoked %1% futures (functions, no stack) "
+                    "in %2% seconds\n")
+                % count
+                % duration)
+              << flush;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(
     variables_map& vm
@@ -136,6 +172,8 @@ int hpx_main(
 
         measure_action_futures(count, vm.count("csv") != 0);
         measure_function_futures(count, vm.count("csv") != 0);
+        if (vm.count("nostack"))
+            measure_function_futures_nostack(count, vm.count("csv") != 0);
     }
 
     finalize();
@@ -160,6 +198,10 @@ int main(
         , value<boost::uint64_t>()->default_value(0)
         , "number of iterations in the delay loop")
 
+        ( "nostack"
+        , "additionally measure futures (functions) running on stackless "
+          "threads")
+
         ( "csv"
         , "output results as csv (format: count,duration)")
         ;
@@ -7,14 +7,21 @@
 #include <hpx/include/actions.hpp>
 #include <hpx/include/iostreams.hpp>
 #include <hpx/include/serialization.hpp>
+#include <hpx/runtime/parcelset/encode_parcels.hpp>
+#include <hpx/runtime/parcelset/parcel_buffer.hpp>
 #include <hpx/util/high_resolution_timer.hpp>
 
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
 #include <boost/format.hpp>
 #include <boost/lexical_cast.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <fstream>
 #include <iterator>
+#include <limits>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -25,6 +32,63 @@ int test_function(hpx::serialization::serialize_buffer<double> const& b)
 }
 HPX_PLAIN_ACTION(test_function, test_action)
 
+// Trivially copyable aggregate without a serialization function, vectors of
+// those are serialized bitwise.
+struct point
+{
+    double x, y, z;
+    boost::int64_t id;
+};
+
+// This function will never be called
+int test_function_aggregate(std::vector<point> const& points)
+{
+    return 42;
+}
+HPX_PLAIN_ACTION(test_function_aggregate, test_aggregate_action)
+
+///////////////////////////////////////////////////////////////////////////////
+// Allocator counting the number of allocations of the serialization buffers
+boost::atomic<std::size_t> num_allocations(0);
+
+template <typename T>
+struct counting_allocator
+{
+    typedef T value_type;
+
+    template <typename U>
+    struct rebind
+    {
+        typedef counting_allocator<U> other;
+    };
+
+    counting_allocator() {}
+    template <typename U>
+    counting_allocator(counting_allocator<U> const&) {}
+
+    T* allocate(std::size_t n)
+    {
+        ++num_allocations;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n)
+    {
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    friend bool operator==(counting_allocator const&, counting_allocator const&)
+    {
+        return true;
+    }
+    friend bool operator!=(counting_allocator const&, counting_allocator const&)
+    {
+        return false;
+    }
+};
+
+typedef std::vector<char, counting_allocator<char> > buffer_type;
+
 std::size_t get_archive_size(hpx::parcelset::parcel const& p,
     boost::uint32_t flags,
     std::vector<hpx::serialization::serialization_chunk>* chunks)
@@ -39,7 +103,7 @@ std::size_t get_archive_size(hpx::parcelset::parcel const& p,
 
 ///////////////////////////////////////////////////////////////////////////////
 double benchmark_serialization(std::size_t data_size, std::size_t iterations,
-    bool continuation, bool zerocopy)
+    bool continuation, bool zerocopy, bool encode, bool aggregate)
 {
     hpx::naming::id_type const here = hpx::find_here();
     hpx::naming::address addr(hpx::get_locality(),
@@ -89,9 +153,27 @@ double benchmark_serialization(std::size_t data_size, std::size_t iterations,
     hpx::serialization::serialize_buffer<double> buffer(data.data(), data.size(),
         hpx::serialization::serialize_buffer<double>::reference);
 
+    std::vector<point> points;
+    if (aggregate)
+        points.resize((data_size * sizeof(double) + sizeof(point) - 1) /
+            sizeof(point));
+
     // create a parcel with/without continuation
     hpx::parcelset::parcel outp;
-    if (continuation) {
+    if (aggregate) {
+        if (continuation) {
+            outp = hpx::parcelset::parcel(here, addr,
+                hpx::actions::typed_continuation<int>(here),
+                test_aggregate_action(), hpx::threads::thread_priority_normal,
+                points);
+        }
+        else {
+            outp = hpx::parcelset::parcel(here, addr,
+                test_aggregate_action(), hpx::threads::thread_priority_normal,
+                points);
+        }
+    }
+    else if (continuation) {
         outp = hpx::parcelset::parcel(here, addr,
             hpx::actions::typed_continuation<int>(here),
             test_action(), hpx::threads::thread_priority_normal, buffer
@@ -112,10 +194,40 @@ double benchmark_serialization(std::size_t data_size, std::size_t iterations,
     boost::uint32_t dest_locality_id = outp.destination_locality_id();
     hpx::util::high_resolution_timer t;
 
+    if (encode)
+    {
+        // serialize the parcel the same way as the parcelports do, this
+        // chunks data only if zero copy serialization was requested
+        if (!zerocopy)
+            out_archive_flags |= hpx::serialization::disable_data_chunking;
+
+        for (std::size_t i = 0; i != iterations; ++i)
+        {
+            hpx::parcelset::parcel_buffer<buffer_type> out_buffer;
+
+            hpx::parcelset::encode_parcels(&outp, std::size_t(-1), out_buffer,
+                out_archive_flags, (std::numeric_limits<boost::uint64_t>::max)(),
+                nullptr);
+
+            hpx::parcelset::parcel inp;
+
+            {
+                // create an input archive and deserialize the parcel
+                hpx::serialization::input_archive archive(
+                    out_buffer.data_, out_buffer.data_size_, &out_buffer.chunks_);
+
+                archive >> inp;
+            }
+        }
+
+        delete chunks;
+        return t.elapsed();
+    }
+
     for (std::size_t i = 0; i != iterations; ++i)
     {
         std::size_t arg_size = get_archive_size(outp, out_archive_flags, chunks);
-        std::vector<char> out_buffer;
+        buffer_type out_buffer;
 
         out_buffer.resize(arg_size + HPX_PARCEL_SERIALIZATION_OVERHEAD);
 
@@ -141,6 +253,7 @@ double benchmark_serialization(std::size_t data_size, std::size_t iterations,
             chunks->clear();
     }
 
+    delete chunks;
     return t.elapsed();
 }
 
@@ -154,24 +267,34 @@ int hpx_main(boost::program_options::variables_map& vm)
     bool print_header = vm.count("no-header") == 0;
     bool continuation = vm.count("continuation") != 0;
     bool zerocopy = vm.count("zerocopy") != 0;
+    bool encode = vm.count("encode") != 0;
+    bool aggregate = vm.count("aggregate") != 0;
 
     std::vector<hpx::future<double> > timings;
     for (std::size_t i = 0; i != concurrency; ++i)
     {
         timings.push_back(hpx::async(
             &benchmark_serialization, data_size, iterations,
-            continuation, zerocopy));
+            continuation, zerocopy, encode, aggregate));
     }
 
     double overall_time = 0;
     for (std::size_t i = 0; i != concurrency; ++i)
         overall_time += timings[i].get();
 
+    // only the allocations of the buffers holding serialized data are counted
+    double allocations = double(num_allocations.load()) /
+        double(iterations * concurrency);
+
     if (print_header)
-        hpx::cout << "datasize,testcount,average_time[s]\n" << hpx::flush;
+    {
+        hpx::cout << "datasize,testcount,average_time[s],allocations_per_parcel\n"
+                  << hpx::flush;
+    }
 
-    hpx::cout << (boost::format("%d,%d,%f\n") %
-        data_size % iterations % (overall_time / concurrency)) << hpx::flush;
+    hpx::cout << (boost::format("%d,%d,%f,%f\n") %
+        data_size % iterations % (overall_time / concurrency) % allocations)
+        << hpx::flush;
 
     return hpx::finalize();
 }
@@ -201,6 +324,13 @@ int main(int argc, char* argv[])
         ( "zerocopy"
         , "use zero copy serialization of bitwise copyable arguments")
 
+        ( "encode"
+        , "serialize parcels using encode_parcels as done by the parcelports")
+
+        ( "aggregate"
+        , "send a vector of trivially copyable structures instead of a "
+          "serialize_buffer<double> of (about) the same size")
+
         ( "no-header"
         , "do not print out the csv header row")
         ;
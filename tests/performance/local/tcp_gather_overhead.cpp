@@ -0,0 +1,272 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the cost of writing messages consisting of many small buffers
+// (the way the TCP parcelport sends parcels) over a loopback connection,
+// once with every buffer handed to the operating system separately and once
+// with the buffers coalesced by the gather policy of the TCP parcelport.
+
+// Makes HPX use BOOST_ASSERT, so that high_resolution_timer can be used
+// without depending on the rest of HPX.
+#define HPX_USE_BOOST_ASSERT
+
+#include <hpx/config.hpp>
+#include <hpx/plugins/parcelport/tcp/gather_policy.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+#include <boost/thread/thread.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+using boost::program_options::variables_map;
+using boost::program_options::options_description;
+using boost::program_options::value;
+using boost::program_options::store;
+using boost::program_options::command_line_parser;
+using boost::program_options::notify;
+
+using hpx::parcelset::policies::tcp::gather_policy;
+using hpx::util::high_resolution_timer;
+
+typedef std::vector<boost::asio::const_buffer> buffers_type;
+
+///////////////////////////////////////////////////////////////////////////////
+boost::uint64_t messages = 100000;
+std::size_t num_chunks = 8;
+std::size_t chunk_size = 256;
+std::size_t data_size = 512;
+std::size_t max_iovecs = 64;
+std::size_t max_gather_bytes = 65536;
+std::size_t gather_threshold = 4096;
+
+// the most buffers Boost.Asio hands to a single system call
+std::size_t const max_buffers_per_call = 64;
+
+///////////////////////////////////////////////////////////////////////////////
+struct result
+{
+    result() : elapsed_(0.0), buffers_(0), calls_(0) {}
+
+    double elapsed_;
+    boost::uint64_t buffers_;
+    boost::uint64_t calls_;
+};
+
+// Write the given buffers the same way boost::asio::write does, counting the
+// number of system calls.
+boost::uint64_t write_buffers(boost::asio::ip::tcp::socket& s,
+    buffers_type const& buffers)
+{
+    boost::uint64_t calls = 0;
+    std::size_t first = 0;
+    std::size_t offset = 0;
+
+    buffers_type pending;
+    while (first != buffers.size())
+    {
+        pending.clear();
+        for (std::size_t i = first;
+             i != buffers.size() && pending.size() != max_buffers_per_call;
+             ++i)
+        {
+            pending.push_back(i == first ? buffers[i] + offset : buffers[i]);
+        }
+
+        std::size_t written = s.write_some(pending);
+        ++calls;
+
+        // skip the buffers which have been written completely
+        while (first != buffers.size())
+        {
+            std::size_t left = boost::asio::buffer_size(buffers[first]) - offset;
+            if (written < left)
+            {
+                offset += written;
+                break;
+            }
+            written -= left;
+            offset = 0;
+            ++first;
+        }
+    }
+    return calls;
+}
+
+result bench_write(boost::asio::ip::tcp::socket& s,
+    buffers_type const& message, gather_policy const* policy)
+{
+    result r;
+
+    std::vector<char> staging;
+    buffers_type gathered;
+
+    high_resolution_timer t;
+    for (boost::uint64_t i = 0; i != messages; ++i)
+    {
+        if (policy != nullptr)
+        {
+            policy->gather(message, staging, gathered);
+            r.buffers_ += gathered.size();
+            r.calls_ += write_buffers(s, gathered);
+        }
+        else
+        {
+            r.buffers_ += message.size();
+            r.calls_ += write_buffers(s, message);
+        }
+    }
+    r.elapsed_ = t.elapsed();
+
+    return r;
+}
+
+// receive everything sent by the benchmark
+void drain(boost::asio::ip::tcp::socket& s, std::size_t total)
+{
+    std::vector<char> buffer(65536);
+    while (total != 0)
+    {
+        std::size_t count = (std::min)(total, buffer.size());
+        boost::asio::read(s, boost::asio::buffer(buffer.data(), count));
+        total -= count;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void print_results(result const& control, result const& gathered)
+{
+    std::cout
+        << "## 0:MSGS:Number of messages - Independent Variable\n"
+           "## 1:CHUNKS:Number of zero-copy chunks per message - "
+                "Independent Variable\n"
+           "## 2:CHUNK_SIZE:Size of the chunks [bytes] - Independent Variable\n"
+           "## 3:WTIME_CTL:Walltime/message, separate buffers [nanoseconds]\n"
+           "## 4:CALLS_CTL:System calls/message, separate buffers\n"
+           "## 5:WTIME_GATHER:Walltime/message, gathered buffers "
+                "[nanoseconds]\n"
+           "## 6:CALLS_GATHER:System calls/message, gathered buffers\n"
+           "## 7:BUFS_GATHER:Buffers/message, gathered buffers\n";
+
+    double const n = double(messages);
+    std::cout << (boost::format("%lu %lu %lu %.14g %.14g %.14g %.14g %.14g\n")
+        % messages % num_chunks % chunk_size
+        % (control.elapsed_ / n * 1e9) % (double(control.calls_) / n)
+        % (gathered.elapsed_ / n * 1e9) % (double(gathered.calls_) / n)
+        % (double(gathered.buffers_) / n));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int app_main(variables_map&)
+{
+    // the message: packed header, transmission chunks, serialized data, and
+    // the zero-copy chunks
+    std::vector<char> header(24, 'h');
+    std::vector<char> transmission_chunks(16 * num_chunks, 't');
+    std::vector<char> data(data_size, 'd');
+    std::vector<std::vector<char> > chunks(num_chunks,
+        std::vector<char>(chunk_size, 'c'));
+
+    buffers_type message;
+    message.push_back(boost::asio::buffer(header));
+    if (num_chunks != 0)
+        message.push_back(boost::asio::buffer(transmission_chunks));
+    message.push_back(boost::asio::buffer(data));
+    for (std::vector<char> const& c : chunks)
+        message.push_back(boost::asio::buffer(c));
+
+    std::size_t const message_size = boost::asio::buffer_size(message);
+
+    // connect two sockets over the loopback interface
+    boost::asio::io_service io_service;
+    boost::asio::ip::tcp::acceptor acceptor(io_service,
+        boost::asio::ip::tcp::endpoint(
+            boost::asio::ip::address_v4::loopback(), 0));
+
+    boost::asio::ip::tcp::socket sender(io_service);
+    boost::asio::ip::tcp::socket receiver(io_service);
+    sender.connect(acceptor.local_endpoint());
+    acceptor.accept(receiver);
+
+    sender.set_option(boost::asio::ip::tcp::no_delay(true));
+
+    gather_policy policy(max_iovecs, max_gather_bytes, gather_threshold);
+
+    boost::thread t(&drain, boost::ref(receiver),
+        std::size_t(2 * messages * message_size));
+
+    result control = bench_write(sender, message, nullptr);
+    result gathered = bench_write(sender, message, &policy);
+
+    t.join();
+
+    print_results(control, gathered);
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Parse command line.
+    variables_map vm;
+
+    options_description cmdline("Usage: " HPX_APPLICATION_STRING " [options]");
+
+    cmdline.add_options()
+        ( "help,h"
+        , "print out program usage (this message)")
+
+        ( "messages"
+        , value<boost::uint64_t>(&messages)->default_value(100000)
+        , "number of messages to send")
+
+        ( "chunks"
+        , value<std::size_t>(&num_chunks)->default_value(8)
+        , "number of zero-copy chunks per message")
+
+        ( "chunk-size"
+        , value<std::size_t>(&chunk_size)->default_value(256)
+        , "size of each of the zero-copy chunks [bytes]")
+
+        ( "data-size"
+        , value<std::size_t>(&data_size)->default_value(512)
+        , "size of the serialized (non-chunked) data [bytes]")
+
+        ( "max-iovecs"
+        , value<std::size_t>(&max_iovecs)->default_value(64)
+        , "see hpx.parcel.tcp.max_iovecs")
+
+        ( "max-gather-bytes"
+        , value<std::size_t>(&max_gather_bytes)->default_value(65536)
+        , "see hpx.parcel.tcp.max_gather_bytes")
+
+        ( "gather-threshold"
+        , value<std::size_t>(&gather_threshold)->default_value(4096)
+        , "see hpx.parcel.tcp.gather_threshold")
+        ;
+
+    store(command_line_parser(argc, argv).options(cmdline).run(), vm);
+
+    notify(vm);
+
+    // Print help screen.
+    if (vm.count("help"))
+    {
+        std::cout << cmdline;
+        return 0;
+    }
+
+    return app_main(vm);
+}
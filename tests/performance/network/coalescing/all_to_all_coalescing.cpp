@@ -0,0 +1,182 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures how well parcels are coalesced if all localities
+// send parcels to randomly chosen other localities from all of their worker
+// threads. It reports the number of parcels sent per message.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/parcel_coalescing.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+boost::atomic<std::size_t> received_parcels(0);
+
+void receive_parcel(std::vector<double> const& payload)
+{
+    ++received_parcels;
+}
+HPX_DECLARE_PLAIN_ACTION(receive_parcel, receive_parcel_action);
+HPX_ACTION_USES_MESSAGE_COALESCING(receive_parcel_action);
+HPX_PLAIN_ACTION(receive_parcel, receive_parcel_action);
+
+std::size_t get_received_parcels()
+{
+    return received_parcels.exchange(0);
+}
+HPX_PLAIN_ACTION(get_received_parcels, get_received_parcels_action);
+
+///////////////////////////////////////////////////////////////////////////////
+void send_parcels(std::size_t num_parcels, std::size_t payload_size,
+    unsigned int seed)
+{
+    std::vector<hpx::id_type> destinations = hpx::find_remote_localities();
+    std::vector<double> const payload(payload_size, 42.0);
+
+    // send from all worker threads concurrently
+    std::size_t num_threads = hpx::get_os_thread_count();
+
+    std::vector<hpx::future<void> > senders;
+    senders.reserve(num_threads);
+
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        std::size_t count = num_parcels / num_threads +
+            (i < num_parcels % num_threads ? 1 : 0);
+
+        senders.push_back(hpx::async(
+            [&destinations, &payload, count, seed, i]()
+            {
+                std::mt19937 gen(seed + static_cast<unsigned int>(i));
+                std::uniform_int_distribution<std::size_t> dist(
+                    0, destinations.size() - 1);
+
+                receive_parcel_action act;
+                for (std::size_t j = 0; j != count; ++j)
+                    hpx::apply(act, destinations[dist(gen)], payload);
+            }));
+    }
+
+    hpx::wait_all(senders);
+}
+HPX_PLAIN_ACTION(send_parcels, send_parcels_action);
+
+///////////////////////////////////////////////////////////////////////////////
+boost::int64_t query_counters(std::vector<hpx::id_type> const& localities,
+    std::string const& name, std::string const& parcelport, bool reset)
+{
+    boost::int64_t value = 0;
+    for (hpx::id_type const& id : localities)
+    {
+        hpx::performance_counters::performance_counter c(boost::str(
+            boost::format("/%s{locality#%d/total}/count/%s/sent") %
+                name % hpx::naming::get_locality_id_from_id(id) %
+                parcelport));
+        value += c.get_value<boost::int64_t>(hpx::launch::sync, reset);
+    }
+    return value;
+}
+
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    std::size_t num_parcels = vm["parcels"].as<std::size_t>();
+    std::size_t payload_size = vm["payload"].as<std::size_t>();
+    std::string parcelport = vm["parcelport"].as<std::string>();
+
+    unsigned int seed = static_cast<unsigned int>(std::time(nullptr));
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+    if (localities.size() < 2)
+    {
+        std::cout << "This benchmark must be run on at least two localities"
+                  << std::endl;
+        return hpx::finalize();
+    }
+
+    // reset the parcel and message counters
+    query_counters(localities, "parcels", parcelport, true);
+    query_counters(localities, "messages", parcelport, true);
+
+    boost::uint64_t time = hpx::util::high_resolution_clock::now();
+
+    std::vector<hpx::future<void> > senders;
+    senders.reserve(localities.size());
+    for (std::size_t i = 0; i != localities.size(); ++i)
+    {
+        senders.push_back(hpx::async(send_parcels_action(), localities[i],
+            num_parcels, payload_size,
+            seed + static_cast<unsigned int>(i * 1000)));
+    }
+    hpx::wait_all(senders);
+
+    // wait for all parcels to arrive
+    std::size_t expected = num_parcels * localities.size();
+    std::size_t received = 0;
+    while (received != expected)
+    {
+        for (hpx::id_type const& id : localities)
+            received += get_received_parcels_action()(id);
+    }
+
+    time = hpx::util::high_resolution_clock::now() - time;
+
+    boost::int64_t parcels = query_counters(localities, "parcels", parcelport, false);
+    boost::int64_t messages = query_counters(localities, "messages", parcelport, false);
+
+    std::cout
+        << "localities,threads,parcels,messages,parcels-per-message,time[s]\n"
+        << localities.size() << ","
+        << hpx::get_os_thread_count() << ","
+        << parcels << ","
+        << messages << ","
+        << (messages != 0 ? double(parcels) / double(messages) : 0.) << ","
+        << time * 1e-9 << std::endl;
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // initialize program
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    boost::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    cmdline.add_options()
+        ("parcels",
+            boost::program_options::value<std::size_t>()->default_value(100000),
+            "number of parcels sent by each locality (default: 100000)")
+        ("payload",
+            boost::program_options::value<std::size_t>()->default_value(8),
+            "number of doubles sent with each parcel (default: 8)")
+        ("parcelport",
+            boost::program_options::value<std::string>()->default_value("tcp"),
+            "the parcelport to query the number of messages for "
+            "(default: tcp)")
+        ("seed,s", boost::program_options::value<unsigned int>(),
+            "the random number generator seed to use for this run")
+        ;
+
+    return hpx::init(cmdline, argc, argv, cfg);
+}
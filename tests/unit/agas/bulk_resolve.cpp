@@ -0,0 +1,154 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/runtime/agas/addressing_service.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/cstdint.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server
+  : hpx::components::managed_component_base<test_server>
+{
+    hpx::id_type call() const
+    {
+        return hpx::find_here();
+    }
+    HPX_DEFINE_COMPONENT_ACTION(test_server, call, call_action);
+};
+
+typedef hpx::components::managed_component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server);
+
+typedef test_server::call_action call_action;
+HPX_REGISTER_ACTION(call_action);
+
+///////////////////////////////////////////////////////////////////////////////
+boost::int64_t query_counter(std::string const& name, bool reset)
+{
+    using namespace hpx::performance_counters;
+
+    performance_counter c(name);
+    return c.get_counter_value(hpx::launch::sync, reset)
+        .get_value<boost::int64_t>();
+}
+
+boost::int64_t get_cache_hits(bool reset = false)
+{
+    return query_counter("/agas{locality#0/total}/count/cache/hits", reset);
+}
+
+boost::int64_t get_cache_misses(bool reset = false)
+{
+    return query_counter("/agas{locality#0/total}/count/cache/misses", reset);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_bulk_resolve(std::vector<hpx::id_type> const& localities)
+{
+    // create a couple of objects on each of the localities, interleaved
+    std::vector<hpx::id_type> ids;
+    for (std::size_t i = 0; i != 4; ++i)
+    {
+        for (hpx::id_type const& locality : localities)
+            ids.push_back(hpx::new_<test_server>(locality).get());
+    }
+
+    std::vector<hpx::naming::address> addrs =
+        hpx::agas::resolve(ids).get();
+    HPX_TEST_EQ(addrs.size(), ids.size());
+
+    // the bulk version has to return the same as the single id version
+    for (std::size_t i = 0; i != ids.size(); ++i)
+    {
+        hpx::naming::address addr =
+            hpx::agas::resolve(hpx::launch::sync, ids[i]);
+
+        HPX_TEST_EQ(addrs[i].locality_, addr.locality_);
+        HPX_TEST_EQ(addrs[i].type_, addr.type_);
+        HPX_TEST_EQ(addrs[i].address_, addr.address_);
+
+        HPX_TEST_EQ(call_action()(ids[i]),
+            hpx::naming::get_id_from_locality_id(
+                hpx::naming::get_locality_id_from_gid(addr.locality_)));
+    }
+
+    // resolving the remote objects fills the local cache, the local objects
+    // are never cached
+    boost::int64_t num_remote = 0;
+    for (hpx::id_type const& id : ids)
+    {
+        if (hpx::naming::get_locality_id_from_id(id) != hpx::get_locality_id())
+            ++num_remote;
+    }
+    HPX_TEST_LT(0, num_remote);
+
+    hpx::naming::get_agas_client().clear_cache();
+    get_cache_hits(true);
+    get_cache_misses(true);
+
+    HPX_TEST_EQ(hpx::agas::resolve(hpx::launch::sync, ids).size(),
+        ids.size());
+    HPX_TEST_EQ(get_cache_hits(true), 0);
+    HPX_TEST_EQ(get_cache_misses(true), num_remote);
+
+    // resolving again is served from the cache
+    std::vector<hpx::naming::address> cached =
+        hpx::agas::resolve(hpx::launch::sync, ids);
+    HPX_TEST_EQ(get_cache_hits(true), num_remote);
+    HPX_TEST_EQ(get_cache_misses(true), 0);
+
+    HPX_TEST_EQ(cached.size(), ids.size());
+    for (std::size_t i = 0; i != ids.size(); ++i)
+    {
+        HPX_TEST_EQ(cached[i].locality_, addrs[i].locality_);
+        HPX_TEST_EQ(cached[i].address_, addrs[i].address_);
+    }
+
+    // the localities themselves can be resolved as well
+    HPX_TEST_EQ(hpx::agas::resolve(hpx::launch::sync, localities).size(),
+        localities.size());
+}
+
+int hpx_main()
+{
+    test_bulk_resolve(hpx::find_all_localities());
+
+    // an empty list resolves to an empty list
+    HPX_TEST(hpx::agas::resolve(
+        hpx::launch::sync, std::vector<hpx::id_type>()).empty());
+
+    bool caught_exception = false;
+    try {
+        std::vector<hpx::id_type> ids(1, hpx::find_here());
+        ids.push_back(hpx::invalid_id);
+        hpx::agas::resolve(hpx::launch::sync, ids);
+        HPX_TEST(false);
+    }
+    catch (hpx::exception const&) {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
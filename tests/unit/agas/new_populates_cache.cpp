@@ -0,0 +1,124 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Creating an object on a remote locality puts its address into the AGAS
+// cache of the creating locality, the first action invoked on the new object
+// doesn't have to resolve it. This test has to be run with at least two
+// localities.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/cstdint.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server
+  : hpx::components::managed_component_base<test_server>
+{
+    test_server() : value_(0) {}
+    explicit test_server(int value) : value_(value) {}
+
+    int call() const
+    {
+        return value_;
+    }
+    HPX_DEFINE_COMPONENT_ACTION(test_server, call, call_action);
+
+    int value_;
+};
+
+typedef hpx::components::managed_component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server);
+
+typedef test_server::call_action call_action;
+HPX_REGISTER_ACTION(call_action);
+
+///////////////////////////////////////////////////////////////////////////////
+boost::int64_t query_counter(std::string const& name, bool reset)
+{
+    using namespace hpx::performance_counters;
+
+    performance_counter c(name);
+    return c.get_counter_value(hpx::launch::sync, reset)
+        .get_value<boost::int64_t>();
+}
+
+boost::int64_t get_cache_hits(bool reset = false)
+{
+    return query_counter("/agas{locality#0/total}/count/cache/hits", reset);
+}
+
+boost::int64_t get_cache_misses(bool reset = false)
+{
+    return query_counter("/agas{locality#0/total}/count/cache/misses", reset);
+}
+
+// invoke the first action on each of the objects, none of them has to be
+// resolved
+void test_first_invocation(std::vector<hpx::id_type> const& ids, int value)
+{
+    get_cache_hits(true);
+    get_cache_misses(true);
+
+    for (hpx::id_type const& id : ids)
+        HPX_TEST_EQ(call_action()(id), value);
+
+    HPX_TEST_EQ(get_cache_misses(true), 0);
+    HPX_TEST_LTE(static_cast<boost::int64_t>(ids.size()),
+        get_cache_hits(true));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_remote_localities();
+    HPX_TEST(!localities.empty());
+
+    for (hpx::id_type const& locality : localities)
+    {
+        // a single object
+        {
+            std::vector<hpx::id_type> ids(1,
+                hpx::new_<test_server>(locality).get());
+            test_first_invocation(ids, 0);
+        }
+
+        // a single object using a non-default constructor
+        {
+            std::vector<hpx::id_type> ids(1,
+                hpx::new_<test_server>(locality, 42).get());
+            test_first_invocation(ids, 42);
+        }
+
+        // a couple of objects created at once
+        {
+            std::vector<hpx::id_type> ids =
+                hpx::new_<test_server[]>(locality, 10).get();
+            test_first_invocation(ids, 0);
+
+            ids = hpx::new_<test_server[]>(locality, 10, 42).get();
+            test_first_invocation(ids, 42);
+        }
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,164 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The GVA table of the primary namespace is split into shards, a range of gids
+// is stored in all of the shards its gids map to. This test binds ranges
+// spanning more and fewer gids than there are shards to a primary namespace
+// instance and verifies that each of the gids is resolved, that overlapping
+// ranges are rejected, and that unbinding a range removes it from all shards.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/runtime/agas/gva.hpp>
+#include <hpx/runtime/agas/namespace_action_code.hpp>
+#include <hpx/runtime/agas/request.hpp>
+#include <hpx/runtime/agas/response.hpp>
+#include <hpx/runtime/agas/server/primary_namespace.hpp>
+#include <hpx/runtime/components/component_type.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/cstdint.hpp>
+
+using hpx::agas::gva;
+using hpx::agas::request;
+using hpx::agas::response;
+using hpx::agas::server::primary_namespace;
+using hpx::naming::gid_type;
+
+///////////////////////////////////////////////////////////////////////////////
+boost::uint64_t const num_shards = HPX_AGAS_PRIMARY_NS_SHARDS;
+
+// all ranges are bound to this (fake) locality
+gid_type const locality = hpx::naming::get_gid_from_locality_id(1);
+
+gva make_gva(boost::uint64_t count)
+{
+    return gva(locality, hpx::components::component_memory, count,
+        boost::uint64_t(0x10000), 0);
+}
+
+bool bind(primary_namespace& pns, gid_type const& id, boost::uint64_t count)
+{
+    hpx::error_code ec(hpx::lightweight);
+    response r = pns.bind_gid(
+        request(hpx::agas::primary_ns_bind_gid, id, make_gva(count), locality),
+        ec);
+    return !ec && r.get_status() == hpx::success;
+}
+
+bool unbind(primary_namespace& pns, gid_type const& id, boost::uint64_t count)
+{
+    hpx::error_code ec(hpx::lightweight);
+    response r = pns.unbind_gid(
+        request(hpx::agas::primary_ns_unbind_gid, id, count), ec);
+    return !ec && r.get_status() == hpx::success &&
+        r.get_gva().count == count;
+}
+
+// every gid of the range resolves to the range
+void test_resolve(primary_namespace& pns, gid_type const& base,
+    boost::uint64_t count)
+{
+    for (boost::uint64_t i = 0; i != count; ++i)
+    {
+        response r = pns.resolve_gid(
+            request(hpx::agas::primary_ns_resolve_gid, base + i));
+
+        HPX_TEST_EQ(r.get_status(), hpx::success);
+        HPX_TEST_EQ(r.get_base_gid(), base);
+        HPX_TEST_EQ(r.get_gva().count, count);
+        HPX_TEST_EQ(r.get_locality(), locality);
+    }
+}
+
+// none of the gids of the range resolves
+void test_unresolved(primary_namespace& pns, gid_type const& base,
+    boost::uint64_t count)
+{
+    for (boost::uint64_t i = 0; i != count; ++i)
+    {
+        response r = pns.resolve_gid(
+            request(hpx::agas::primary_ns_resolve_gid, base + i));
+
+        HPX_TEST_EQ(r.get_status(), hpx::no_success);
+    }
+}
+
+void test_range(primary_namespace& pns, gid_type const& base,
+    boost::uint64_t count)
+{
+    // bind the range and its neighbors
+    HPX_TEST(bind(pns, base, count));
+    HPX_TEST(bind(pns, base - 1, 1));
+    HPX_TEST(bind(pns, base + count, 1));
+
+    test_resolve(pns, base, count);
+    test_resolve(pns, base - 1, 1);
+    test_resolve(pns, base + count, 1);
+
+    // binding another range starting inside of the range is rejected, no
+    // matter which shard its first gid maps to
+    for (boost::uint64_t i = 1; i != count; ++i)
+        HPX_TEST(!bind(pns, base + i, 1));
+
+    // the block size of an existing range can't be changed
+    HPX_TEST(!bind(pns, base, count + 1));
+
+    // rejected binds don't modify the range
+    test_resolve(pns, base, count);
+
+    // unbinding the range removes it from all shards: none of its gids is
+    // resolved anymore and each of them can be bound on its own
+    HPX_TEST(unbind(pns, base, count));
+    test_unresolved(pns, base, count);
+
+    for (boost::uint64_t i = 0; i != count; ++i)
+        HPX_TEST(bind(pns, base + i, 1));
+    for (boost::uint64_t i = 0; i != count; ++i)
+        test_resolve(pns, base + i, 1);
+    for (boost::uint64_t i = 0; i != count; ++i)
+        HPX_TEST(unbind(pns, base + i, 1));
+    test_unresolved(pns, base, count);
+
+    // the neighbors are not affected
+    test_resolve(pns, base - 1, 1);
+    test_resolve(pns, base + count, 1);
+
+    HPX_TEST(unbind(pns, base - 1, 1));
+    HPX_TEST(unbind(pns, base + count, 1));
+    test_unresolved(pns, base - 1, count + 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    primary_namespace pns;
+    pns.set_local_locality(locality);
+
+    gid_type const base(0x100, 0x10000);
+
+    // a range larger than the number of shards
+    test_range(pns, base, 3 * num_shards + 5);
+
+    // a range smaller than the number of shards
+    test_range(pns, base + 0x1003, num_shards / 2 + 1);
+
+    // a single gid
+    test_range(pns, base + 0x2007, 1);
+
+    // a range covering exactly one gid per shard
+    test_range(pns, base + 0x3001, num_shards);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
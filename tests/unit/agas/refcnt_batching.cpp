@@ -0,0 +1,204 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies the batching of reference count decrements for the
+// objects owned by different localities. It has to be run with at least two
+// localities.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/cstdint.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server
+  : hpx::components::managed_component_base<test_server>
+{};
+
+typedef hpx::components::managed_component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server);
+
+///////////////////////////////////////////////////////////////////////////////
+// number of buffered operations after which the batch of a locality is sent
+std::size_t const max_pending_requests = 16;
+
+// interval of the timer flushing all batches (in milliseconds)
+boost::uint64_t const flush_interval = 2000;
+
+boost::uint64_t const flush_interval_ns = flush_interval * 1000000ull;
+
+///////////////////////////////////////////////////////////////////////////////
+struct refcnt_counters
+{
+    refcnt_counters()
+      : coalesced_("/agas{locality#0/total}/count/refcnt_requests/coalesced")
+      , sent_("/agas{locality#0/total}/count/refcnt_requests/sent")
+    {}
+
+    boost::int64_t coalesced(bool reset = false)
+    {
+        return coalesced_.get_counter_value(hpx::launch::sync, reset)
+            .get_value<boost::int64_t>();
+    }
+
+    boost::int64_t sent(bool reset = false)
+    {
+        return sent_.get_counter_value(hpx::launch::sync, reset)
+            .get_value<boost::int64_t>();
+    }
+
+    void reset()
+    {
+        coalesced(true);
+        sent(true);
+    }
+
+    // wait for at least the given number of requests to be sent
+    bool wait_for_sent(boost::int64_t count, boost::uint64_t timeout)
+    {
+        boost::uint64_t start = hpx::util::high_resolution_clock::now();
+        while (sent() < count)
+        {
+            if (hpx::util::high_resolution_clock::now() - start > timeout)
+                return false;
+            hpx::this_thread::yield();
+        }
+        return true;
+    }
+
+    hpx::performance_counters::performance_counter coalesced_;
+    hpx::performance_counters::performance_counter sent_;
+};
+
+std::vector<hpx::id_type> create_objects(hpx::id_type const& locality,
+    std::size_t count)
+{
+    std::vector<hpx::id_type> ids;
+    for (std::size_t i = 0; i != count; ++i)
+        ids.push_back(hpx::new_<test_server>(locality).get());
+    return ids;
+}
+
+// add credits which are later removed by the decrements issued by the tests
+void add_credits(hpx::id_type const& id, boost::int64_t credits)
+{
+    hpx::agas::incref(id.get_gid(), credits, id).get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_remote_localities();
+    HPX_TEST(!localities.empty());
+    if (localities.empty())
+        return hpx::finalize();
+
+    refcnt_counters counters;
+
+    // the gids of these objects are owned by different localities
+    std::vector<hpx::id_type> local_ids =
+        create_objects(hpx::find_here(), max_pending_requests);
+    std::vector<hpx::id_type> remote_ids =
+        create_objects(localities[0], max_pending_requests);
+
+    hpx::id_type const merged = local_ids.back();
+    local_ids.pop_back();
+
+    for (hpx::id_type const& id : local_ids)
+        add_credits(id, 1);
+    for (hpx::id_type const& id : remote_ids)
+        add_credits(id, 1);
+    add_credits(merged, 10);
+
+    hpx::agas::garbage_collect();
+    counters.reset();
+
+    // A single pending decrement is sent by the timer. The tests below run
+    // right after the timer has fired, i.e. it will not interfere.
+    {
+        hpx::agas::decref(local_ids[0].get_gid(), 1);
+
+        HPX_TEST(counters.wait_for_sent(1, 5 * flush_interval_ns));
+        HPX_TEST_EQ(counters.sent(true), 1);
+        HPX_TEST_EQ(counters.coalesced(true), 0);
+    }
+
+    boost::uint64_t const start = hpx::util::high_resolution_clock::now();
+
+    // Reaching the threshold for the objects owned by the remote locality
+    // sends only those decrements, the ones for the local objects stay
+    // pending.
+    {
+        for (std::size_t i = 1; i != local_ids.size(); ++i)
+            hpx::agas::decref(local_ids[i].get_gid(), 1);
+        HPX_TEST_EQ(counters.sent(), 0);
+
+        for (hpx::id_type const& id : remote_ids)
+            hpx::agas::decref(id.get_gid(), 1);
+
+        boost::int64_t const num_remote =
+            static_cast<boost::int64_t>(remote_ids.size());
+        HPX_TEST(counters.wait_for_sent(num_remote, flush_interval_ns));
+        HPX_TEST_EQ(counters.sent(true), num_remote);
+
+        hpx::agas::garbage_collect();
+        HPX_TEST_EQ(counters.sent(true),
+            static_cast<boost::int64_t>(local_ids.size() - 1));
+        HPX_TEST_EQ(counters.coalesced(true), 0);
+    }
+
+    // Increments are merged with the pending decrements of the same object.
+    // Each operation is either coalesced or sent.
+    {
+        hpx::agas::decref(merged.get_gid(), 4);     // pending: -4
+        hpx::agas::decref(merged.get_gid(), 4);     // coalesced, pending: -8
+        HPX_TEST_EQ(counters.coalesced(), 1);
+
+        add_credits(merged, 3);                     // coalesced, pending: -5
+        add_credits(merged, 5);                     // both coalesced
+        HPX_TEST_EQ(counters.coalesced(), 4);
+        HPX_TEST_EQ(counters.sent(), 0);
+
+        hpx::agas::decref(merged.get_gid(), 2);     // pending: -2
+        add_credits(merged, 3);                     // coalesced, sends +1
+        HPX_TEST_EQ(counters.coalesced(), 5);
+        HPX_TEST_EQ(counters.sent(), 1);
+
+        hpx::agas::decref(merged.get_gid(), 11);    // pending: -11
+        hpx::agas::garbage_collect();
+
+        boost::int64_t const num_operations = 7;
+        HPX_TEST_EQ(counters.coalesced(true) + counters.sent(true),
+            num_operations);
+    }
+
+    // the tests above must not have been disturbed by the timer
+    HPX_TEST_LT(hpx::util::high_resolution_clock::now() - start,
+        flush_interval_ns);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.agas.max_pending_refcnt_requests=" +
+            std::to_string(max_pending_requests),
+        "hpx.agas.refcnt_flush_interval=" + std::to_string(flush_interval)
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
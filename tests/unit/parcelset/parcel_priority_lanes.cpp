@@ -0,0 +1,124 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Parcels of high priority actions are sent on their own lane, they overtake
+// the parcels of normal priority actions which are queued for (or are being
+// written to) the same destination. This test has to be run with at least
+// two localities.
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_TCP)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// the bulk data is sent over a single connection
+std::size_t const num_normal_parcels = 64;
+std::size_t const normal_parcel_size = 1024 * 1024;
+
+boost::atomic<std::size_t> received_normal(0);
+
+void normal_priority(std::vector<char> const& data)
+{
+    HPX_TEST_EQ(data.size(), normal_parcel_size);
+    ++received_normal;
+}
+HPX_PLAIN_ACTION(normal_priority);
+
+// returns the number of normal priority parcels which arrived before this one
+std::size_t high_priority()
+{
+    return received_normal.load();
+}
+HPX_DEFINE_PLAIN_ACTION(high_priority, high_priority_action);
+HPX_ACTION_HAS_CRITICAL_PRIORITY(high_priority_action);
+HPX_REGISTER_ACTION(high_priority_action);
+
+///////////////////////////////////////////////////////////////////////////////
+boost::int64_t query_counter(std::string const& name)
+{
+    using namespace hpx::performance_counters;
+
+    performance_counter c(name);
+    return c.get_counter_value(hpx::launch::sync, true)
+        .get_value<boost::int64_t>();
+}
+
+boost::int64_t get_normal_count()
+{
+    return query_counter("/parcels{locality#0/total}/count/tcp/queue/normal");
+}
+
+boost::int64_t get_priority_count()
+{
+    return query_counter("/parcels{locality#0/total}/count/tcp/queue/priority");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_remote_localities();
+    HPX_TEST(!localities.empty());
+    if (localities.empty())
+        return hpx::finalize();
+
+    hpx::id_type const dest = localities[0];
+
+    get_normal_count();
+    get_priority_count();
+
+    // queue the bulk data first, the high priority parcel is sent while
+    // (most of) the bulk data is still waiting for the connection
+    std::vector<char> const data(normal_parcel_size, 'x');
+
+    std::vector<hpx::future<void> > normal;
+    normal.reserve(num_normal_parcels);
+    for (std::size_t i = 0; i != num_normal_parcels; ++i)
+        normal.push_back(hpx::async<normal_priority_action>(dest, data));
+
+    std::size_t const overtaken =
+        hpx::async<high_priority_action>(dest).get();
+
+    hpx::wait_all(normal);
+
+    HPX_TEST_LT(overtaken, num_normal_parcels);
+
+    // each parcel has been sent from its lane (AGAS requests may have used
+    // the priority lane as well)
+    HPX_TEST_LTE(1, get_priority_count());
+    HPX_TEST_LTE(static_cast<boost::int64_t>(num_normal_parcels),
+        get_normal_count());
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // a single connection carries the normal priority parcels
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.tcp.enable=1",
+        "hpx.parcel.max_connections_per_locality=1",
+        "hpx.parcel.priority_lanes=1"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
@@ -0,0 +1,160 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Parcels addressed to the local locality are scheduled directly by the
+// parcelhandler, they are never handed to a parcelport.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const numparcels_default = 10;
+
+hpx::id_type test_local(std::vector<double> const& data)
+{
+    return hpx::find_here();
+}
+HPX_PLAIN_ACTION(test_local);
+
+template <typename Action, typename T>
+hpx::parcelset::parcel
+generate_parcel(hpx::id_type const& dest, hpx::id_type const& cont, T && data)
+{
+    hpx::naming::address addr;
+    hpx::parcelset::parcel p(dest, addr,
+        hpx::actions::typed_continuation<hpx::id_type>(cont),
+        Action(), hpx::threads::thread_priority_normal,
+        std::forward<T>(data));
+
+    p.parcel_id() = hpx::parcelset::parcel::generate_unique_id();
+    p.set_source_id(hpx::find_here());
+
+    return p;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+boost::int64_t query_counter(std::string const& name)
+{
+    using namespace hpx::performance_counters;
+
+    performance_counter c(name);
+    return c.get_counter_value(hpx::launch::sync, true)
+        .get_value<boost::int64_t>();
+}
+
+boost::int64_t get_loopback_count()
+{
+    return query_counter("/parcels{locality#0/total}/count/loopback");
+}
+
+boost::int64_t get_network_count()
+{
+    return query_counter("/parcels{locality#0/total}/count/network");
+}
+
+// the write handler is called once the parcel has been scheduled, the parcel
+// still refers to the scheduled action
+boost::atomic<std::size_t> write_handler_called(0);
+
+void write_handler(boost::system::error_code const& ec,
+    hpx::parcelset::parcel const& p)
+{
+    HPX_TEST(!ec);
+    HPX_TEST(dynamic_cast<
+            hpx::actions::transfer_action<test_local_action>*
+        >(p.get_action()) != nullptr);
+    ++write_handler_called;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_put_parcel()
+{
+    hpx::id_type const here = hpx::find_here();
+    std::vector<double> data(1024, 42.0);
+
+    get_loopback_count();
+    get_network_count();
+    write_handler_called.store(0);
+
+    std::vector<hpx::future<hpx::id_type> > results;
+    for (std::size_t i = 0; i != numparcels_default; ++i)
+    {
+        hpx::lcos::promise<hpx::id_type> p;
+        results.push_back(p.get_future());
+
+        hpx::get_runtime().get_parcel_handler().put_parcel(
+            generate_parcel<test_local_action>(here, p.get_id(), data),
+            &write_handler);
+    }
+
+    hpx::wait_all(results);
+    for (hpx::future<hpx::id_type>& f : results)
+        HPX_TEST(f.get() == here);
+
+    HPX_TEST_EQ(write_handler_called.load(), numparcels_default);
+    HPX_TEST_LTE(static_cast<boost::int64_t>(numparcels_default),
+        get_loopback_count());
+    HPX_TEST_EQ(get_network_count(), 0);
+}
+
+void test_put_parcels()
+{
+    hpx::id_type const here = hpx::find_here();
+    std::vector<double> data(1024, 42.0);
+
+    get_loopback_count();
+    get_network_count();
+    write_handler_called.store(0);
+
+    std::vector<hpx::future<hpx::id_type> > results;
+    std::vector<hpx::parcelset::parcel> parcels;
+    std::vector<hpx::parcelset::parcelhandler::write_handler_type> handlers;
+    for (std::size_t i = 0; i != numparcels_default; ++i)
+    {
+        hpx::lcos::promise<hpx::id_type> p;
+        results.push_back(p.get_future());
+
+        parcels.push_back(
+            generate_parcel<test_local_action>(here, p.get_id(), data));
+        handlers.push_back(&write_handler);
+    }
+
+    hpx::get_runtime().get_parcel_handler().put_parcels(
+        std::move(parcels), std::move(handlers));
+
+    hpx::wait_all(results);
+    for (hpx::future<hpx::id_type>& f : results)
+        HPX_TEST(f.get() == here);
+
+    HPX_TEST_EQ(write_handler_called.load(), numparcels_default);
+    HPX_TEST_LTE(static_cast<boost::int64_t>(numparcels_default),
+        get_loopback_count());
+    HPX_TEST_EQ(get_network_count(), 0);
+}
+
+int hpx_main()
+{
+    test_put_parcel();
+    test_put_parcels();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
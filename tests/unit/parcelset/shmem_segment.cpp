@@ -0,0 +1,146 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Tests for the shared memory segment and the ring buffers used by the shmem
+// parcelport. These don't need a running runtime.
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/error_code.hpp>
+#include <hpx/plugins/parcelport/shmem/segment.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/cstdint.hpp>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using hpx::parcelset::policies::shmem::ring_buffer;
+using hpx::parcelset::policies::shmem::segment;
+using hpx::parcelset::policies::shmem::slot_header;
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<char> make_data(std::size_t size, char first)
+{
+    std::vector<char> data(size);
+    for (std::size_t i = 0; i != size; ++i)
+        data[i] = static_cast<char>(first + i);
+    return data;
+}
+
+void test_ring_buffer()
+{
+    slot_header slot;
+    slot.state_.store(slot_header::slot_connected);
+    slot.head_.store(0);
+    slot.tail_.store(0);
+
+    char storage[16];
+    ring_buffer ring(slot, storage, sizeof(storage));
+    HPX_TEST(ring.empty());
+
+    std::vector<char> in = make_data(10, 'a');
+    HPX_TEST_EQ(ring.write(in.data(), in.size()), std::size_t(10));
+    HPX_TEST(!ring.empty());
+
+    std::vector<char> out(16);
+    HPX_TEST_EQ(ring.read(out.data(), 6), std::size_t(6));
+    HPX_TEST(std::equal(in.begin(), in.begin() + 6, out.begin()));
+
+    // the second write wraps around the end of the ring, only 12 bytes fit
+    std::vector<char> in2 = make_data(16, 'A');
+    HPX_TEST_EQ(ring.write(in2.data(), in2.size()), std::size_t(12));
+    HPX_TEST_EQ(ring.write(in2.data(), in2.size()), std::size_t(0));
+
+    HPX_TEST_EQ(ring.read(out.data(), out.size()), std::size_t(16));
+    HPX_TEST(std::equal(in.begin() + 6, in.end(), out.begin()));
+    HPX_TEST(std::equal(in2.begin(), in2.begin() + 12, out.begin() + 4));
+    HPX_TEST(ring.empty());
+    HPX_TEST_EQ(ring.read(out.data(), out.size()), std::size_t(0));
+
+    // discarding data makes room for the writer
+    HPX_TEST_EQ(ring.write(in2.data(), in2.size()), std::size_t(16));
+    HPX_TEST_EQ(ring.discard(), std::size_t(16));
+    HPX_TEST(ring.empty());
+    HPX_TEST_EQ(ring.write(in2.data(), in2.size()), std::size_t(16));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_segment()
+{
+    std::string const name =
+        segment::name(static_cast<boost::int32_t>(::getpid())) + ".test";
+    std::size_t const num_slots = 4;
+
+    segment receiver;
+    receiver.create(name, num_slots, 100);      // rounded up to 4096 bytes
+    HPX_TEST_EQ(receiver.num_slots(), num_slots);
+
+    segment sender;
+    sender.open(name);
+    HPX_TEST_EQ(sender.num_slots(), num_slots);
+
+    // all slots can be claimed exactly once
+    std::vector<std::size_t> slots;
+    for (std::size_t i = 0; i != num_slots; ++i)
+    {
+        std::size_t slot = sender.acquire_slot();
+        HPX_TEST_NEQ(slot, std::size_t(-1));
+        slots.push_back(slot);
+    }
+    HPX_TEST_EQ(sender.acquire_slot(), std::size_t(-1));
+
+    // data written by the sender shows up in the mapping of the receiver,
+    // the rings are larger than requested
+    std::vector<char> in = make_data(4096, 'a');
+    ring_buffer out_ring = sender.ring(slots[1]);
+    HPX_TEST_EQ(out_ring.write(in.data(), in.size()), in.size());
+
+    ring_buffer in_ring = receiver.ring(slots[1]);
+    HPX_TEST(receiver.ring(slots[0]).empty());
+
+    std::vector<char> out(in.size());
+    HPX_TEST_EQ(in_ring.read(out.data(), out.size()), in.size());
+    HPX_TEST(in == out);
+
+    // a released slot can be claimed again once the receiver has freed it
+    sender.release_slot(slots[1]);
+    HPX_TEST_EQ(receiver.slot(slots[1]).state_.load(),
+        boost::uint32_t(slot_header::slot_closed));
+    HPX_TEST_EQ(sender.acquire_slot(), std::size_t(-1));
+
+    receiver.free_slot(slots[1]);
+    HPX_TEST_EQ(sender.acquire_slot(), slots[1]);
+    HPX_TEST(receiver.ring(slots[1]).empty());
+    HPX_TEST_EQ(receiver.slot(slots[1]).head_.load(), boost::uint64_t(0));
+
+    // the segment is removed by its creator
+    sender.close();
+    receiver.close();
+
+    hpx::error_code ec(hpx::lightweight);
+    segment late;
+    late.open(name, ec);
+    HPX_TEST(ec);
+}
+
+int main()
+{
+    test_ring_buffer();
+    test_segment();
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
@@ -0,0 +1,201 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Tests for the policy deciding which buffers of a message are coalesced by
+// the TCP parcelport before being written. These don't need a running
+// runtime.
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_TCP)
+#include <hpx/plugins/parcelport/tcp/gather_policy.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/asio/buffer.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using hpx::parcelset::policies::tcp::gather_policy;
+
+typedef std::vector<boost::asio::const_buffer> buffers_type;
+
+///////////////////////////////////////////////////////////////////////////////
+// A message made of buffers of the given sizes, every buffer is filled with
+// different data.
+struct message
+{
+    explicit message(std::vector<std::size_t> const& sizes)
+      : data_(sizes.size())
+    {
+        char c = 'a';
+        for (std::size_t i = 0; i != sizes.size(); ++i)
+        {
+            for (std::size_t j = 0; j != sizes[i]; ++j)
+                data_[i].push_back(c++);
+
+            buffers_.push_back(
+                boost::asio::buffer(data_[i].data(), data_[i].size()));
+        }
+    }
+
+    std::string contents() const
+    {
+        std::string result;
+        for (std::string const& d : data_)
+            result += d;
+        return result;
+    }
+
+    std::vector<std::string> data_;
+    buffers_type buffers_;
+};
+
+std::string contents(buffers_type const& buffers)
+{
+    std::string result;
+    for (boost::asio::const_buffer const& b : buffers)
+    {
+        char const* p = boost::asio::buffer_cast<char const*>(b);
+        result.append(p, p + boost::asio::buffer_size(b));
+    }
+    return result;
+}
+
+bool refers_to(boost::asio::const_buffer const& b, std::vector<char> const& v)
+{
+    char const* p = boost::asio::buffer_cast<char const*>(b);
+    return p >= v.data() && p < v.data() + v.size();
+}
+
+// gather the buffers of the message and check that the written data is not
+// changed by this
+std::size_t gather(gather_policy const& policy, message const& msg,
+    std::vector<char>& staging, buffers_type& out)
+{
+    std::size_t bytes = policy.gather(msg.buffers_, staging, out);
+
+    HPX_TEST_EQ(bytes, staging.size());
+    HPX_TEST_LTE(bytes, policy.max_gather_bytes());
+    HPX_TEST_EQ(contents(out), msg.contents());
+    return bytes;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_small_buffers()
+{
+    // a small message (header, transmission chunks, data) is sent as a single
+    // buffer
+    {
+        gather_policy policy(64, 65536, 4096);
+        message msg({ 24, 32, 200 });
+
+        std::vector<char> staging;
+        buffers_type out;
+        HPX_TEST_EQ(gather(policy, msg, staging, out), std::size_t(256));
+        HPX_TEST_EQ(out.size(), std::size_t(1));
+    }
+
+    // buffers above the threshold are not copied, they split the runs of
+    // small buffers
+    {
+        gather_policy policy(64, 65536, 100);
+        message msg({ 24, 32, 200, 10, 20, 30, 500, 40 });
+
+        std::vector<char> staging;
+        buffers_type out;
+        HPX_TEST_EQ(gather(policy, msg, staging, out), std::size_t(116));
+        HPX_TEST_EQ(out.size(), std::size_t(5));
+
+        HPX_TEST(refers_to(out[0], staging));
+        HPX_TEST_EQ(boost::asio::buffer_size(out[0]), std::size_t(56));
+        HPX_TEST(!refers_to(out[1], staging));
+        HPX_TEST(refers_to(out[2], staging));
+        HPX_TEST_EQ(boost::asio::buffer_size(out[2]), std::size_t(60));
+        HPX_TEST(!refers_to(out[3], staging));
+        HPX_TEST(!refers_to(out[4], staging));
+    }
+
+    // a threshold of zero leaves small messages alone
+    {
+        gather_policy policy(64, 65536, 0);
+        message msg({ 24, 32, 200 });
+
+        std::vector<char> staging;
+        buffers_type out;
+        HPX_TEST_EQ(gather(policy, msg, staging, out), std::size_t(0));
+        HPX_TEST_EQ(out.size(), std::size_t(3));
+    }
+}
+
+void test_byte_budget()
+{
+    // coalescing stops once the budget is used up
+    gather_policy policy(64, 100, 4096);
+    message msg({ 40, 40, 40, 40 });
+
+    std::vector<char> staging;
+    buffers_type out;
+    HPX_TEST_EQ(gather(policy, msg, staging, out), std::size_t(80));
+    HPX_TEST_EQ(out.size(), std::size_t(3));
+    HPX_TEST_EQ(boost::asio::buffer_size(out[0]), std::size_t(80));
+}
+
+void test_max_iovecs()
+{
+    // large buffers are merged only if the message has too many buffers,
+    // the smallest neighbors first
+    {
+        gather_policy policy(3, 65536, 0);
+        message msg({ 1000, 200, 300, 2000, 5000 });
+
+        std::vector<char> staging;
+        buffers_type out;
+        HPX_TEST_EQ(gather(policy, msg, staging, out), std::size_t(1500));
+        HPX_TEST_EQ(out.size(), std::size_t(3));
+        HPX_TEST_EQ(boost::asio::buffer_size(out[0]), std::size_t(1500));
+        HPX_TEST_EQ(boost::asio::buffer_size(out[1]), std::size_t(2000));
+        HPX_TEST_EQ(boost::asio::buffer_size(out[2]), std::size_t(5000));
+    }
+
+    // the budget limits the merging as well
+    {
+        gather_policy policy(2, 1000, 0);
+        message msg({ 300, 400, 500, 600 });
+
+        std::vector<char> staging;
+        buffers_type out;
+        HPX_TEST_EQ(gather(policy, msg, staging, out), std::size_t(700));
+        HPX_TEST_EQ(out.size(), std::size_t(3));
+    }
+
+    // many small chunks fit into a single system call
+    {
+        gather_policy policy(64, 65536, 0);
+        message msg(std::vector<std::size_t>(200, 128));
+
+        std::vector<char> staging;
+        buffers_type out;
+        gather(policy, msg, staging, out);
+        HPX_TEST_LTE(out.size(), std::size_t(64));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_small_buffers();
+    test_byte_budget();
+    test_max_iovecs();
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
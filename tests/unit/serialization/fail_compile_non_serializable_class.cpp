@@ -7,12 +7,16 @@
 
 #include <hpx/runtime/serialization/serialize.hpp>
 
+// trivially copyable types are serialized bitwise by default, unless they
+// have been excluded explicitly
 struct A
 {
     double a;
-    int p;
+    int* p;
 };
 
+HPX_IS_NOT_BITWISE_SERIALIZABLE(A)
+
 int main()
 {
     std::vector<char> vector;
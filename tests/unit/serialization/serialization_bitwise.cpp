@@ -0,0 +1,222 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/serialization/array.hpp>
+#include <hpx/runtime/serialization/list.hpp>
+#include <hpx/runtime/serialization/map.hpp>
+#include <hpx/runtime/serialization/string.hpp>
+#include <hpx/runtime/serialization/vector.hpp>
+
+#include <hpx/runtime/serialization/input_archive.hpp>
+#include <hpx/runtime/serialization/output_archive.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <array>
+#include <cstddef>
+#include <list>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// trivially copyable aggregate without any serialization support
+struct point
+{
+    double x, y, z;
+    int id;
+};
+
+bool operator==(point const& lhs, point const& rhs)
+{
+    return lhs.x == rhs.x && lhs.y == rhs.y && lhs.z == rhs.z &&
+        lhs.id == rhs.id;
+}
+
+// large enough to be sent as a zero-copy chunk when stored in a vector
+struct block
+{
+    double data[64];
+};
+
+bool operator==(block const& lhs, block const& rhs)
+{
+    for (std::size_t i = 0; i != 64; ++i)
+    {
+        if (lhs.data[i] != rhs.data[i])
+            return false;
+    }
+    return true;
+}
+
+// providing a serialization function disables bitwise serialization
+struct counted
+{
+    int value;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        ar & value;
+    }
+};
+
+bool operator==(counted const& lhs, counted const& rhs)
+{
+    return lhs.value == rhs.value;
+}
+
+// holds a pointer, the automatic detection can't tell
+struct node
+{
+    node* next;
+    int value;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        ar & value;
+    }
+};
+
+HPX_IS_NOT_BITWISE_SERIALIZABLE(node)
+
+struct named
+{
+    std::string name;
+    int value;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        ar & name & value;
+    }
+};
+
+static_assert(hpx::traits::is_bitwise_serializable<point>::value,
+    "trivially copyable aggregates are bitwise serializable");
+static_assert(hpx::traits::is_bitwise_serializable<block>::value,
+    "trivially copyable aggregates are bitwise serializable");
+static_assert(hpx::traits::is_bitwise_serializable<std::array<point, 3> >::value,
+    "arrays of bitwise serializable types are bitwise serializable");
+static_assert(!hpx::traits::is_bitwise_serializable<counted>::value,
+    "types with a serialization function are not bitwise serializable");
+static_assert(!hpx::traits::is_bitwise_serializable<node>::value,
+    "explicitly excluded types are not bitwise serializable");
+static_assert(!hpx::traits::is_bitwise_serializable<named>::value,
+    "types which are not trivially copyable are not bitwise serializable");
+static_assert(!hpx::traits::is_bitwise_serializable<point*>::value,
+    "pointers are not bitwise serializable");
+static_assert(hpx::traits::is_bitwise_serializable<
+        std::pair<int const, point> >::value,
+    "pairs of bitwise serializable types are bitwise serializable");
+static_assert(!hpx::traits::is_bitwise_serializable<
+        std::pair<int, counted> >::value,
+    "pairs of types which are not bitwise serializable are not either");
+
+///////////////////////////////////////////////////////////////////////////////
+typedef std::vector<hpx::serialization::serialization_chunk> chunks_type;
+
+std::size_t num_pointer_chunks(chunks_type const& chunks)
+{
+    std::size_t count = 0;
+    for (hpx::serialization::serialization_chunk const& c : chunks)
+    {
+        if (c.type_ == hpx::serialization::chunk_type_pointer)
+            ++count;
+    }
+    return count;
+}
+
+template <typename T>
+void test(T const& os, std::size_t expected_pointer_chunks,
+    boost::uint32_t flags = 0U)
+{
+    std::vector<char> buffer;
+    chunks_type chunks;
+    std::size_t size = 0;
+    {
+        hpx::serialization::output_archive oarchive(
+            buffer, flags, 0U, &chunks);
+        oarchive << os;
+        size = oarchive.bytes_written();
+    }
+
+    HPX_TEST_EQ(num_pointer_chunks(chunks), expected_pointer_chunks);
+
+    T is;
+    {
+        hpx::serialization::input_archive iarchive(buffer, size, &chunks);
+        iarchive >> is;
+    }
+    HPX_TEST(os == is);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    point p = { 1.0, 2.0, 3.0, 42 };
+    test(p, 0);
+
+    // single values are always copied into the buffer, even large ones
+    block b;
+    for (std::size_t i = 0; i != 64; ++i)
+        b.data[i] = double(i);
+    test(b, 0);
+
+    std::vector<block> blocks(4, b);
+    test(blocks, 1);
+
+    std::vector<point> points(100);
+    for (std::size_t i = 0; i != points.size(); ++i)
+    {
+        point q = { double(i), double(i + 1), double(i + 2), int(i) };
+        points[i] = q;
+    }
+
+    // the whole vector is sent as a single chunk
+    test(points, 1);
+
+    std::vector<std::array<double, 3> > coords(100);
+    for (std::size_t i = 0; i != coords.size(); ++i)
+    {
+        std::array<double, 3> c = {{ double(i), double(2 * i), double(3 * i) }};
+        coords[i] = c;
+    }
+    test(coords, 1);
+
+    std::list<point> point_list(points.begin(), points.end());
+    test(point_list, 0);
+
+    std::map<int, point> point_map;
+    for (point const& q : points)
+        point_map[q.id] = q;
+    test(point_map, 0);
+
+    // vectors of bitwise serializable pairs are sent as a single chunk
+    std::vector<std::pair<int, point> > pairs;
+    for (point const& q : points)
+        pairs.push_back(std::make_pair(q.id, q));
+    test(pairs, 1);
+
+    std::vector<std::pair<int, counted> > counted_pairs(100);
+    for (std::size_t i = 0; i != counted_pairs.size(); ++i)
+    {
+        counted c = { int(i) };
+        counted_pairs[i] = std::make_pair(int(i), c);
+    }
+    test(counted_pairs, 0);
+
+    // types without a serialization function still work if the array
+    // optimization was disabled
+    test(p, 0, hpx::serialization::disable_array_optimization);
+    test(points, 0, hpx::serialization::disable_array_optimization);
+    test(coords, 0, hpx::serialization::disable_array_optimization);
+    test(pairs, 0, hpx::serialization::disable_array_optimization);
+
+    return hpx::util::report_errors();
+}
@@ -11,6 +11,7 @@
 #include <hpx/util/lightweight_test.hpp>
 #include <hpx/runtime/serialization/serialize_buffer.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -127,6 +128,97 @@ void test_initialization_from_vector(std::size_t max_size)
     }
 }
 
+template <typename T>
+void test_adopt_received_data(std::size_t size)
+{
+    typedef hpx::serialization::serialization_chunk chunk_type;
+
+    hpx::serialization::serialize_buffer<T> send_buffer1(size);
+    hpx::serialization::serialize_buffer<T> send_buffer2(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        send_buffer1[i] = T(size - i);
+        send_buffer2[i] = T(i);
+    }
+
+    std::vector<char> out_buffer;
+    std::vector<chunk_type> out_chunks;
+    std::size_t out_size = 0;
+    {
+        hpx::serialization::output_archive archive(
+            out_buffer, 0U, 0U, &out_chunks);
+        archive << send_buffer1 << send_buffer2;
+        out_size = archive.bytes_written();
+    }
+
+    // emulate the receiving end, each zero-copy chunk ends up in a buffer of
+    // its own, which has an owner of its own
+    std::vector<std::shared_ptr<void> > owners(out_chunks.size());
+    std::vector<std::weak_ptr<void> > received;
+    std::vector<char*> received_data;
+
+    std::vector<chunk_type> in_chunks;
+    for (chunk_type const& c : out_chunks)
+    {
+        if (c.type_ != hpx::serialization::chunk_type_pointer)
+        {
+            in_chunks.push_back(c);
+            continue;
+        }
+
+        char const* data = static_cast<char const*>(c.data_.cpos_);
+        std::shared_ptr<std::vector<char> > chunk =
+            std::make_shared<std::vector<char> >(data, data + c.size_);
+
+        owners[in_chunks.size()] = chunk;
+        received.push_back(chunk);
+        received_data.push_back(chunk->data());
+
+        in_chunks.push_back(hpx::serialization::create_pointer_chunk(
+            chunk->data(), c.size_));
+    }
+
+    hpx::serialization::serialize_buffer<T> recv_buffer1;
+    hpx::serialization::serialize_buffer<T> recv_buffer2;
+    {
+        hpx::serialization::input_archive archive(
+            out_buffer, out_size, &in_chunks, &owners);
+        archive >> recv_buffer1 >> recv_buffer2;
+    }
+
+    // the received data has been adopted without copying it
+    if (received_data.size() == 2)
+    {
+        HPX_TEST(static_cast<void*>(recv_buffer1.data()) ==
+            static_cast<void*>(received_data[0]));
+        HPX_TEST(static_cast<void*>(recv_buffer2.data()) ==
+            static_cast<void*>(received_data[1]));
+    }
+
+    // and stays alive as long as the buffer refers to it
+    owners.clear();
+
+    HPX_TEST_EQ(recv_buffer1.size(), size);
+    HPX_TEST(std::equal(recv_buffer1.begin(), recv_buffer1.end(),
+        send_buffer1.begin()));
+
+    // releasing one buffer releases its chunk only
+    if (received.size() == 2)
+    {
+        recv_buffer1 = hpx::serialization::serialize_buffer<T>();
+        HPX_TEST(received[0].expired());
+        HPX_TEST(!received[1].expired());
+    }
+
+    HPX_TEST_EQ(recv_buffer2.size(), size);
+    HPX_TEST(std::equal(recv_buffer2.begin(), recv_buffer2.end(),
+        send_buffer2.begin()));
+
+    recv_buffer2 = hpx::serialization::serialize_buffer<T>();
+    for (std::weak_ptr<void> const& r : received)
+        HPX_TEST(r.expired());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(int argc, char* argv[])
 {
@@ -150,6 +242,9 @@ int hpx_main(int argc, char* argv[])
         test_fixed_size_initialization_for_persistent_buffers<char>(size);
         test_fixed_size_initialization_for_persistent_buffers<float>(size);
         test_fixed_size_initialization_for_persistent_buffers<double>(size);
+
+        test_adopt_received_data<char>(size);
+        test_adopt_received_data<double>(size);
     }
 
     return hpx::finalize();
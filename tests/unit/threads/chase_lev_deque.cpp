@@ -0,0 +1,150 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/util/bind.hpp>
+#include <hpx/util/lockfree/chase_lev_deque.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/program_options.hpp>
+
+#include <boost/detail/lightweight_test.hpp>
+
+#include <iostream>
+#include <vector>
+
+hpx::util::lockfree::chase_lev_deque<boost::uint64_t>* deque = nullptr;
+
+// every item records how often it was consumed
+std::vector<boost::atomic<boost::uint64_t> >* consumed = nullptr;
+boost::atomic<boost::uint64_t> num_consumed(0);
+boost::atomic<bool> done(false);
+
+boost::uint64_t thieves = 2;
+boost::uint64_t items = 500000;
+
+void consume(boost::uint64_t item)
+{
+    ++(*consumed)[item];
+    ++num_consumed;
+}
+
+void owner_thread()
+{
+    // interleave pushing and popping to exercise the races on the last
+    // element and the growing of the underlying array
+    boost::uint64_t item = 0;
+    while (item != items)
+    {
+        for (int i = 0; i != 64 && item != items; ++i)
+            deque->push(item++);
+
+        boost::uint64_t val = 0;
+        for (int i = 0; i != 16; ++i)
+        {
+            if (deque->pop(val))
+                consume(val);
+        }
+    }
+
+    boost::uint64_t val = 0;
+    while (deque->pop(val))
+        consume(val);
+
+    done = true;
+}
+
+void thief_thread()
+{
+    boost::uint64_t val = 0;
+    while (!done || !deque->empty())
+    {
+        if (deque->steal(val))
+            consume(val);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    using boost::program_options::variables_map;
+    using boost::program_options::options_description;
+    using boost::program_options::value;
+    using boost::program_options::store;
+    using boost::program_options::command_line_parser;
+    using boost::program_options::notify;
+
+    variables_map vm;
+
+    options_description
+        desc_cmdline("Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_cmdline.add_options()
+        ("help,h", "print out program usage (this message)")
+        ("thieves,t", value<boost::uint64_t>(&thieves)->default_value(2),
+         "the number of threads stealing items from the deque")
+        ("items,i", value<boost::uint64_t>(&items)->default_value(500000),
+         "the number of items to push onto the deque")
+    ;
+
+    store(
+        command_line_parser(argc,
+            argv).options(desc_cmdline).allow_unregistered().run(), vm);
+
+    notify(vm);
+
+    // print help screen
+    if (vm.count("help"))
+    {
+        std::cout << desc_cmdline;
+        return boost::report_errors();
+    }
+
+    // single threaded operation
+    {
+        hpx::util::lockfree::chase_lev_deque<boost::uint64_t> d(2);
+        BOOST_TEST(d.empty());
+
+        for (boost::uint64_t i = 0; i != 100; ++i)
+            d.push(i);
+        BOOST_TEST_EQ(d.size(), std::size_t(100));
+
+        boost::uint64_t val = 0;
+        BOOST_TEST(d.steal(val));
+        BOOST_TEST_EQ(val, boost::uint64_t(0));
+        BOOST_TEST(d.pop(val));
+        BOOST_TEST_EQ(val, boost::uint64_t(99));
+
+        while (d.pop(val))
+            /**/;
+        BOOST_TEST(d.empty());
+        BOOST_TEST(!d.steal(val));
+    }
+
+    // one owner, multiple thieves
+    deque = new hpx::util::lockfree::chase_lev_deque<boost::uint64_t>(16);
+    consumed = new std::vector<boost::atomic<boost::uint64_t> >(items);
+    for (boost::uint64_t i = 0; i != items; ++i)
+        (*consumed)[i].store(0);
+
+    {
+        boost::thread_group tg;
+
+        for (boost::uint64_t i = 0; i != thieves; ++i)
+            tg.create_thread(&thief_thread);
+        tg.create_thread(&owner_thread);
+
+        tg.join_all();
+    }
+
+    BOOST_TEST_EQ(num_consumed.load(), items);
+    for (boost::uint64_t i = 0; i != items; ++i)
+        BOOST_TEST_EQ((*consumed)[i].load(), boost::uint64_t(1));
+
+    delete consumed;
+    delete deque;
+
+    return boost::report_errors();
+}
@@ -0,0 +1,232 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test is run using --hpx:queuing=hierarchy, it verifies that work
+// created by any of the worker threads is eventually executed, both if it
+// is created from inside and from outside of HPX threads. It also checks the
+// shape of the tree of queues built from the given arities and from the
+// machine topology.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/threads/policies/hierarchy_scheduler.hpp>
+#include <hpx/runtime/threads/topology.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+boost::atomic<std::size_t> count_invocations(0);
+
+hpx::lcos::local::spinlock mtx;
+std::set<std::thread::id> os_threads;
+
+std::size_t spawn_tree(std::size_t depth)
+{
+    ++count_invocations;
+    {
+        std::lock_guard<hpx::lcos::local::spinlock> l(mtx);
+        os_threads.insert(std::this_thread::get_id());
+    }
+
+    if (depth == 0)
+        return 1;
+
+    hpx::future<std::size_t> left = hpx::async(&spawn_tree, depth - 1);
+    hpx::future<std::size_t> right = hpx::async(&spawn_tree, depth - 1);
+    return left.get() + right.get() + 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+typedef hpx::threads::policies::hierarchy_scheduler<> scheduler_type;
+
+void test_parse_arities()
+{
+    std::vector<std::size_t> arities(1, 2);
+    HPX_TEST(scheduler_type::parse_arities("topology", arities));
+    HPX_TEST(arities.empty());
+
+    HPX_TEST(scheduler_type::parse_arities("4", arities));
+    HPX_TEST_EQ(arities.size(), std::size_t(1));
+    HPX_TEST_EQ(arities[0], std::size_t(4));
+
+    HPX_TEST(scheduler_type::parse_arities("2,4,8", arities));
+    HPX_TEST_EQ(arities.size(), std::size_t(3));
+    HPX_TEST_EQ(arities[0], std::size_t(2));
+    HPX_TEST_EQ(arities[1], std::size_t(4));
+    HPX_TEST_EQ(arities[2], std::size_t(8));
+
+    // arities have to be larger than one
+    HPX_TEST(!scheduler_type::parse_arities("1", arities));
+    HPX_TEST(!scheduler_type::parse_arities("2,0", arities));
+    HPX_TEST(!scheduler_type::parse_arities("2,x", arities));
+    HPX_TEST(!scheduler_type::parse_arities("2,,4", arities));
+    HPX_TEST(!scheduler_type::parse_arities("", arities));
+    HPX_TEST(arities.empty());
+}
+
+// every node but the root has exactly one parent on the next level, the
+// number of children of each node matches
+void check_tree(scheduler_type const& sched, std::size_t num_leaves)
+{
+    HPX_TEST_LT(std::size_t(1), sched.tree.size());
+    HPX_TEST_EQ(sched.tree.front().size(), num_leaves);
+    HPX_TEST_EQ(sched.tree.back().size(), std::size_t(1));
+    HPX_TEST_EQ(sched.parents.size(), sched.tree.size() - 1);
+    HPX_TEST_EQ(sched.num_children.size(), sched.tree.size() - 1);
+    HPX_TEST_EQ(sched.level_kinds.size(), sched.tree.size());
+
+    for (std::size_t l = 0; l + 1 < sched.tree.size(); ++l)
+    {
+        HPX_TEST_LT(sched.tree[l + 1].size(), sched.tree[l].size());
+        HPX_TEST_EQ(sched.parents[l].size(), sched.tree[l].size());
+        HPX_TEST_EQ(sched.num_children[l].size(), sched.tree[l + 1].size());
+
+        std::vector<std::size_t> children(sched.tree[l + 1].size(), 0);
+        for (std::size_t parent : sched.parents[l])
+        {
+            HPX_TEST_LT(parent, children.size());
+            if (parent < children.size())
+                ++children[parent];
+        }
+        for (std::size_t i = 0; i != children.size(); ++i)
+        {
+            HPX_TEST_LT(std::size_t(0), children[i]);
+            HPX_TEST_EQ(children[i], sched.num_children[l][i]);
+        }
+    }
+}
+
+void test_tree_from_arities()
+{
+    // 8 leaves, pairs of those share a parent, the 4 parents share the root
+    {
+        std::vector<std::size_t> arities = { 2, 4 };
+        scheduler_type sched(scheduler_type::init_parameter(8, arities));
+        check_tree(sched, 8);
+
+        HPX_TEST_EQ(sched.tree.size(), std::size_t(3));
+        HPX_TEST_EQ(sched.tree[1].size(), std::size_t(4));
+        for (std::size_t i = 0; i != 8; ++i)
+            HPX_TEST_EQ(sched.parents[0][i], i / 2);
+        for (std::size_t i = 0; i != 4; ++i)
+            HPX_TEST_EQ(sched.parents[1][i], std::size_t(0));
+    }
+
+    // the last arity is used for all remaining levels
+    {
+        std::vector<std::size_t> arities = { 3 };
+        scheduler_type sched(scheduler_type::init_parameter(10, arities));
+        check_tree(sched, 10);
+
+        HPX_TEST_EQ(sched.tree.size(), std::size_t(4));
+        HPX_TEST_EQ(sched.tree[1].size(), std::size_t(4));
+        HPX_TEST_EQ(sched.tree[2].size(), std::size_t(2));
+        for (std::size_t i = 0; i != 10; ++i)
+            HPX_TEST_EQ(sched.parents[0][i], i / 3);
+    }
+}
+
+void test_tree_from_topology()
+{
+    std::size_t const num_threads = hpx::get_os_thread_count();
+    if (num_threads == 1)
+        return;
+
+    // the tree is flat until the affinity of the OS threads is known
+    scheduler_type sched(scheduler_type::init_parameter(
+        num_threads, std::vector<std::size_t>()));
+    check_tree(sched, num_threads);
+    HPX_TEST_EQ(sched.tree.size(), std::size_t(2));
+
+    sched.init(hpx::threads::policies::init_affinity_data(),
+        hpx::threads::get_topology());
+    check_tree(sched, num_threads);
+
+    // the leaves sharing a node of a level between the leaves and the root
+    // run in the same domain (core, NUMA domain, or socket) of the machine,
+    // leaves below different nodes don't
+    for (std::size_t l = 1; l + 1 < sched.tree.size(); ++l)
+    {
+        std::size_t const kind = sched.level_kinds[l];
+        HPX_TEST_LT(kind,
+            std::size_t(hpx::threads::policies::steal_level_machine));
+
+        std::vector<std::size_t> ancestors(num_threads);
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            std::size_t node = i;
+            for (std::size_t k = 0; k != l; ++k)
+                node = sched.parents[k][node];
+            ancestors[i] = node;
+        }
+
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            for (std::size_t j = i + 1; j != num_threads; ++j)
+            {
+                bool same_domain =
+                    sched.get_domain_mask(kind, sched.get_pu_num(i)) ==
+                    sched.get_domain_mask(kind, sched.get_pu_num(j));
+                HPX_TEST_EQ(same_domain, ancestors[i] == ancestors[j]);
+            }
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_parse_arities();
+    test_tree_from_arities();
+    test_tree_from_topology();
+
+    {
+        count_invocations.store(0);
+
+        std::size_t const depth = 12;
+        std::size_t const num_tasks = (std::size_t(1) << (depth + 1)) - 1;
+
+        HPX_TEST_EQ(hpx::async(&spawn_tree, depth).get(), num_tasks);
+        HPX_TEST_EQ(count_invocations.load(), num_tasks);
+    }
+
+    {
+        count_invocations.store(0);
+
+        // a large number of independent tasks created by one thread
+        std::vector<hpx::future<std::size_t> > futures;
+        for (std::size_t i = 0; i != 1000; ++i)
+            futures.push_back(hpx::async(&spawn_tree, std::size_t(0)));
+
+        hpx::wait_all(futures);
+        HPX_TEST_EQ(count_invocations.load(), std::size_t(1000));
+    }
+
+    // the work was spread over more than one worker thread
+    if (hpx::get_os_thread_count() > 1)
+    {
+        std::lock_guard<hpx::lcos::local::spinlock> l(mtx);
+        HPX_TEST_LT(std::size_t(1), os_threads.size());
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
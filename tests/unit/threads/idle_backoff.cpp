@@ -0,0 +1,166 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that idle worker threads which were put to sleep are
+// woken up whenever they are needed. It is run with a very large maximal
+// backoff time (hpx.max_idle_backoff_time), i.e. work which is picked up late
+// would be noticed.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+///////////////////////////////////////////////////////////////////////////////
+// one second in nanoseconds, much shorter than the maximal backoff time
+boost::uint64_t const max_delay = 1000000000ull;
+
+void let_workers_park()
+{
+    // all worker threads are idle while this thread is suspended
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(500));
+}
+
+boost::int64_t query_counter(std::string const& name, bool reset = false)
+{
+    using namespace hpx::performance_counters;
+
+    performance_counter c(name);
+    return c.get_counter_value(hpx::launch::sync, reset)
+        .get_value<boost::int64_t>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// work scheduled for a parked worker thread wakes up that worker thread
+void test_targeted_wakeup()
+{
+    std::size_t const num_threads = hpx::get_os_thread_count();
+    for (std::size_t num_thread = 0; num_thread != num_threads; ++num_thread)
+    {
+        let_workers_park();
+
+        hpx::lcos::local::promise<void> p;
+        hpx::future<void> f = p.get_future();
+
+        boost::uint64_t start = hpx::util::high_resolution_clock::now();
+        hpx::threads::register_work_nullary(
+            [&p]() { p.set_value(); }, "test_targeted_wakeup",
+            hpx::threads::pending, hpx::threads::thread_priority_normal,
+            num_thread);
+
+        f.get();
+        HPX_TEST_LT(hpx::util::high_resolution_clock::now() - start,
+            max_delay);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// work scheduled for a busy worker thread wakes up a parked worker thread
+// which steals it
+boost::atomic<bool> targeted_work_done(false);
+
+void busy_worker()
+{
+    std::size_t const num_thread = hpx::get_worker_thread_num();
+
+    // this thread is blocking its worker thread, the targeted work has to be
+    // executed by somebody else
+    targeted_work_done.store(false);
+    hpx::threads::register_work_nullary(
+        []() { targeted_work_done.store(true); }, "test_thief_wakeup",
+        hpx::threads::pending, hpx::threads::thread_priority_normal,
+        num_thread);
+
+    boost::uint64_t start = hpx::util::high_resolution_clock::now();
+    while (!targeted_work_done.load() &&
+        hpx::util::high_resolution_clock::now() - start < 2 * max_delay)
+    {
+    }
+
+    HPX_TEST(targeted_work_done.load());
+    HPX_TEST_LT(hpx::util::high_resolution_clock::now() - start, max_delay);
+}
+
+void test_thief_wakeup()
+{
+    std::size_t const num_threads = hpx::get_os_thread_count();
+    for (std::size_t num_thread = 0; num_thread != num_threads; ++num_thread)
+    {
+        let_workers_park();
+
+        hpx::lcos::local::promise<void> p;
+        hpx::future<void> f = p.get_future();
+
+        hpx::threads::register_work_nullary(
+            [&p]() { busy_worker(); p.set_value(); }, "busy_worker",
+            hpx::threads::pending, hpx::threads::thread_priority_normal,
+            num_thread);
+
+        f.get();
+    }
+
+    // wait for the last targeted thread to have finished
+    while (!targeted_work_done.load())
+        hpx::this_thread::yield();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// worker threads polling the parcelports are never parked
+void test_no_parking_for_background_threads()
+{
+    HPX_TEST_EQ(query_counter(
+        "/threads{locality#0/worker-thread#0}/time/parked"), 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// resetting the number of wakeups does not discard the wakeup latencies
+void test_wakeup_counters()
+{
+    let_workers_park();
+    hpx::async([]() {}).get();
+
+    HPX_TEST_LT(0, query_counter(
+        "/threads{locality#0/total}/count/wakeups", true));
+    HPX_TEST_LT(0, query_counter(
+        "/threads{locality#0/total}/time/average-wakeup-latency"));
+}
+
+int hpx_main()
+{
+    test_targeted_wakeup();
+    test_thief_wakeup();
+    test_no_parking_for_background_threads();
+    test_wakeup_counters();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.max_idle_backoff_time=10000",
+        "hpx.max_background_threads=1"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
@@ -0,0 +1,100 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that idle worker threads are put to sleep when running
+// with the default configuration, i.e. with all worker threads polling the
+// parcelports. Only the first of them has to stay awake.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/cstdint.hpp>
+#include <boost/format.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+///////////////////////////////////////////////////////////////////////////////
+boost::int64_t query_counter(std::string const& name, bool reset = false)
+{
+    using namespace hpx::performance_counters;
+
+    performance_counter c(name);
+    return c.get_counter_value(hpx::launch::sync, reset)
+        .get_value<boost::int64_t>();
+}
+
+boost::int64_t get_parked_time(std::size_t num_thread)
+{
+    return query_counter(boost::str(boost::format(
+        "/threads{locality#0/worker-thread#%1%}/time/parked") % num_thread));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    HPX_TEST_EQ(hpx::get_config_entry("hpx.max_awake_background_threads", ""),
+        std::string("1"));
+
+    std::size_t const num_threads = hpx::get_os_thread_count();
+    HPX_TEST_LT(std::size_t(1), num_threads);
+
+    // all worker threads are idle while this thread is suspended
+    hpx::this_thread::sleep_for(std::chrono::seconds(2));
+
+    // the first worker thread keeps polling the parcelports, all others are
+    // put to sleep
+    HPX_TEST_EQ(get_parked_time(0), 0);
+
+    boost::int64_t parked = 0;
+    for (std::size_t num_thread = 1; num_thread != num_threads; ++num_thread)
+    {
+        boost::int64_t t = get_parked_time(num_thread);
+        HPX_TEST_LT(0, t);
+        parked += t;
+    }
+    HPX_TEST_LT(0, parked);
+
+    // sleeping worker threads are woken up for work scheduled for them, long
+    // before their maximal backoff time has expired
+    boost::uint64_t const max_delay = 500000000ull;      // 0.5 seconds
+    for (std::size_t num_thread = 1; num_thread != num_threads; ++num_thread)
+    {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+        hpx::lcos::local::promise<void> p;
+        hpx::future<void> f = p.get_future();
+
+        boost::uint64_t start = hpx::util::high_resolution_clock::now();
+        hpx::threads::register_work_nullary(
+            [&p]() { p.set_value(); }, "test_default_wakeup",
+            hpx::threads::pending, hpx::threads::thread_priority_normal,
+            num_thread);
+
+        f.get();
+        HPX_TEST_LT(hpx::util::high_resolution_clock::now() - start,
+            max_delay);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
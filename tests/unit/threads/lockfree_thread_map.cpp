@@ -0,0 +1,96 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test is run using --hpx:queuing=local-priority-lockfree, i.e. the
+// thread objects are kept track of by the lockfree_thread_map back-end.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+boost::atomic<std::size_t> count_invocations(0);
+
+void noop()
+{
+    ++count_invocations;
+}
+
+void wait_for(hpx::lcos::local::promise<void>& p)
+{
+    p.get_future().wait();      // suspends this thread
+    ++count_invocations;
+}
+
+hpx::threads::threadmanager_base& get_thread_manager()
+{
+    return hpx::get_runtime().get_thread_manager();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    HPX_TEST_EQ(hpx::get_config_entry("hpx.scheduler", ""),
+        std::string("local-priority-lockfree"));
+
+    // create (and recycle) a lot of thread objects
+    for (std::size_t j = 0; j != 10; ++j)
+    {
+        count_invocations.store(0);
+
+        std::vector<hpx::future<void> > futures;
+        for (std::size_t i = 0; i != 1000; ++i)
+            futures.push_back(hpx::async(&noop));
+
+        hpx::wait_all(futures);
+        HPX_TEST_EQ(count_invocations.load(), std::size_t(1000));
+    }
+
+    // iterating over the map sees the suspended threads
+    {
+        count_invocations.store(0);
+
+        std::size_t const num_suspended = 100;
+        std::vector<hpx::lcos::local::promise<void> > promises(num_suspended);
+
+        std::vector<hpx::future<void> > futures;
+        for (std::size_t i = 0; i != num_suspended; ++i)
+        {
+            futures.push_back(hpx::async(&wait_for, std::ref(promises[i])));
+        }
+
+        // wait for all of the threads to be suspended
+        while (get_thread_manager().get_thread_count(
+                hpx::threads::suspended) <
+            static_cast<boost::int64_t>(num_suspended))
+        {
+            hpx::this_thread::yield();
+        }
+
+        for (hpx::lcos::local::promise<void>& p : promises)
+            p.set_value();
+
+        hpx::wait_all(futures);
+        HPX_TEST_EQ(count_invocations.load(), num_suspended);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,126 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/threadmanager.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+#include <hpx/runtime/threads/coroutines/detail/posix_utility.hpp>
+#include <hpx/runtime/threads/coroutines/detail/stack_pool.hpp>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+using hpx::threads::coroutines::detail::posix::stack_pool;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_reuse(std::size_t size)
+{
+    std::int64_t hits = stack_pool::get_hit_count(false);
+    std::int64_t misses = stack_pool::get_miss_count(false);
+
+    void* stack = stack_pool::allocate(size);
+    HPX_TEST(stack != nullptr);
+    HPX_TEST_EQ(stack_pool::get_hit_count(false) +
+        stack_pool::get_miss_count(false), hits + misses + 1);
+
+    // make sure the whole stack is usable
+    static_cast<char*>(stack)[0] = 1;
+    static_cast<char*>(stack)[size - 1] = 1;
+
+    std::int64_t pooled = stack_pool::get_pooled_count(false);
+    stack_pool::deallocate(stack, size);
+    HPX_TEST_EQ(stack_pool::get_pooled_count(false), pooled + 1);
+
+    // the same stack is handed out again
+    hits = stack_pool::get_hit_count(false);
+
+    void* stack1 = stack_pool::allocate(size);
+    HPX_TEST_EQ(stack, stack1);
+    HPX_TEST_EQ(stack_pool::get_hit_count(false), hits + 1);
+    HPX_TEST_EQ(stack_pool::get_pooled_count(false), pooled);
+
+    stack_pool::deallocate(stack1, size);
+}
+
+void test_watermarks(std::size_t size)
+{
+    stack_pool::set_watermarks(1, 2);
+
+    std::vector<void*> stacks;
+    for (int i = 0; i != 4; ++i)
+        stacks.push_back(stack_pool::allocate(size));
+
+    std::int64_t pooled = stack_pool::get_pooled_count(false);
+    std::int64_t resident = stack_pool::get_resident_size(false);
+
+    for (void* stack : stacks)
+        stack_pool::deallocate(stack, size);
+
+    // at most two stacks are kept, only one of those keeps its memory
+    HPX_TEST(stack_pool::get_pooled_count(false) <= pooled + 2);
+    HPX_TEST(stack_pool::get_resident_size(false) <=
+        resident + std::int64_t(size));
+
+    // disabling the pool doesn't keep any additional stacks
+    stack_pool::set_watermarks(0, 0);
+    pooled = stack_pool::get_pooled_count(false);
+
+    void* stack = stack_pool::allocate(2 * size);
+    stack_pool::deallocate(stack, 2 * size);
+    HPX_TEST_EQ(stack_pool::get_pooled_count(false), pooled);
+
+    stack_pool::set_watermarks(64, 1024);
+}
+
+// the pool has to be usable before the runtime (and therefore the topology)
+// is available, as the runtime configuration sets the watermarks
+void test_no_runtime()
+{
+    stack_pool::set_watermarks(64, 1024);
+
+    std::size_t const size = 0x10000;
+    void* stack = stack_pool::allocate(size);
+    HPX_TEST(stack != nullptr);
+    stack_pool::deallocate(stack, size);
+
+    HPX_TEST_EQ(stack_pool::allocate(size), stack);
+    stack_pool::deallocate(stack, size);
+}
+#endif
+
+int hpx_main()
+{
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+    std::size_t size = static_cast<std::size_t>(
+        hpx::threads::get_stack_size(hpx::threads::thread_stacksize_huge));
+
+    test_reuse(size);
+    test_watermarks(size);
+#endif
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+    test_no_runtime();
+#endif
+
+    // run on one core only, all stacks are taken from the same NUMA domain
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=1"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
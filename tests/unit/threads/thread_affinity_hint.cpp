@@ -0,0 +1,141 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/thread_executors.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/runtime/threads/thread_data.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+boost::atomic<std::size_t> count_invocations(0);
+
+void test_hint(std::size_t key)
+{
+    // the hint is carried by the thread object
+    HPX_TEST_EQ(hpx::threads::get_self_id()->get_affinity_hint(), key);
+    ++count_invocations;
+}
+
+std::size_t run_hinted(std::size_t key)
+{
+    test_hint(key);
+    return hpx::get_worker_thread_num();
+}
+
+void test_no_hint()
+{
+    HPX_TEST_EQ(hpx::threads::get_self_id()->get_affinity_hint(),
+        std::size_t(-1));
+    ++count_invocations;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    using hpx::threads::executors::default_executor;
+
+    std::size_t const num_partitions = 2 * hpx::get_os_thread_count() + 1;
+
+    std::vector<default_executor> execs;
+    for (std::size_t i = 0; i != num_partitions; ++i)
+    {
+        execs.push_back(
+            default_executor(hpx::threads::thread_affinity_hint(i)));
+    }
+
+    {
+        count_invocations.store(0);
+
+        // repeatedly run work on all partitions
+        std::vector<hpx::future<void> > futures;
+        for (std::size_t t = 0; t != 100; ++t)
+        {
+            for (std::size_t i = 0; i != num_partitions; ++i)
+                futures.push_back(hpx::async(execs[i], &test_hint, i));
+        }
+
+        hpx::wait_all(futures);
+        HPX_TEST_EQ(count_invocations.load(), 100 * num_partitions);
+    }
+
+    {
+        count_invocations.store(0);
+
+        // a sequence of threads carrying the same hint stays on the same
+        // worker thread (without a hint they are distributed round robin)
+        std::size_t const num_steps = 100;
+        std::size_t same_worker = 0;
+
+        std::size_t last = hpx::async(execs[0], &run_hinted, 0).get();
+        for (std::size_t t = 1; t != num_steps; ++t)
+        {
+            std::size_t current = hpx::async(execs[0], &run_hinted, 0).get();
+            if (current == last)
+                ++same_worker;
+            last = current;
+        }
+
+        HPX_TEST_EQ(count_invocations.load(), num_steps);
+
+        // allow for the occasional steal by an idle neighbor
+        HPX_TEST_LTE(3 * (num_steps - 1) / 4, same_worker);
+    }
+
+    {
+        count_invocations.store(0);
+
+        // the hint is preserved for threads which were suspended, they are
+        // resumed on the worker thread they were running on before
+        std::vector<hpx::future<std::size_t> > futures;
+        for (std::size_t i = 0; i != num_partitions; ++i)
+        {
+            futures.push_back(hpx::async(execs[i],
+                [i]() -> std::size_t
+                {
+                    std::size_t before = run_hinted(i);
+                    hpx::this_thread::suspend(std::chrono::milliseconds(1));
+                    return std::size_t(run_hinted(i) == before);
+                }));
+        }
+
+        hpx::wait_all(futures);
+        HPX_TEST_EQ(count_invocations.load(), 2 * num_partitions);
+
+        std::size_t same_worker = 0;
+        for (hpx::future<std::size_t>& f : futures)
+            same_worker += f.get();
+
+        HPX_TEST_LTE(num_partitions / 2, same_worker);
+    }
+
+    {
+        count_invocations.store(0);
+
+        // recycled thread objects don't keep a stale hint
+        std::vector<hpx::future<void> > futures;
+        for (std::size_t i = 0; i != 100; ++i)
+            futures.push_back(hpx::async(&test_no_hint));
+
+        hpx::wait_all(futures);
+        HPX_TEST_EQ(count_invocations.load(), std::size_t(100));
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,122 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/runtime/threads/detail/slab_pool.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct object
+{
+    double data_[8];
+};
+
+typedef hpx::threads::detail::slab_pool<object> pool_type;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_owner(std::size_t slab_size)
+{
+    pool_type pool(slab_size);
+    pool.set_owner();
+
+    std::vector<object*> objects;
+    for (std::size_t i = 0; i != slab_size; ++i)
+        objects.push_back(pool.allocate());
+
+    HPX_TEST_EQ(pool.get_count(), std::int64_t(slab_size));
+    HPX_TEST_EQ(pool.get_capacity(), std::int64_t(slab_size));
+
+    for (object* p : objects)
+        pool.deallocate(p);
+    HPX_TEST_EQ(pool.get_count(), 0);
+
+    // the most recently freed object is handed out first
+    object* p = pool.allocate();
+    HPX_TEST_EQ(p, objects.back());
+    HPX_TEST_EQ(pool.get_capacity(), std::int64_t(slab_size));
+
+    // a new slab is allocated only once all objects are in use
+    objects.clear();
+    for (std::size_t i = 0; i != slab_size; ++i)
+        objects.push_back(pool.allocate());
+    HPX_TEST_EQ(pool.get_count(), std::int64_t(slab_size + 1));
+    HPX_TEST_EQ(pool.get_capacity(), std::int64_t(2 * slab_size));
+
+    pool.deallocate(p);
+    for (object* q : objects)
+        pool.deallocate(q);
+    HPX_TEST_EQ(pool.get_count(), 0);
+}
+
+void test_remote(std::size_t slab_size)
+{
+    pool_type pool(slab_size);
+    pool.set_owner();
+
+    std::vector<object*> objects;
+    for (std::size_t i = 0; i != slab_size; ++i)
+        objects.push_back(pool.allocate());
+
+    // objects freed by another OS thread are handed back to the owner
+    std::thread t(
+        [&]()
+        {
+            for (object* p : objects)
+                pool.deallocate(p);
+        });
+    t.join();
+
+    HPX_TEST_EQ(pool.get_count(), 0);
+
+    for (std::size_t i = 0; i != slab_size; ++i)
+        objects[i] = pool.allocate();
+    HPX_TEST_EQ(pool.get_capacity(), std::int64_t(slab_size));
+
+    // objects can be allocated by other OS threads as well
+    object* remote = nullptr;
+    std::thread t1(
+        [&]()
+        {
+            remote = pool.allocate();
+        });
+    t1.join();
+
+    HPX_TEST(remote != nullptr);
+    HPX_TEST_EQ(pool.get_count(), std::int64_t(slab_size + 1));
+    HPX_TEST_EQ(pool.get_capacity(), std::int64_t(2 * slab_size));
+
+    pool.deallocate(remote);
+    for (object* p : objects)
+        pool.deallocate(p);
+    HPX_TEST_EQ(pool.get_count(), 0);
+}
+
+int hpx_main()
+{
+    test_owner(1);
+    test_owner(16);
+
+    test_remote(1);
+    test_remote(16);
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // the pools are owned by the (only) worker thread
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=1"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,264 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/thread_executors.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/runtime/threads/policies/deadline_queue_scheduler.hpp>
+#include <hpx/runtime/threads/thread_data.hpp>
+#include <hpx/runtime/threads/thread_init_data.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/lightweight_test.hpp>
+#include <hpx/util/tuple.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+boost::atomic<std::size_t> count_invocations(0);
+
+void test_deadline(std::uint64_t created, std::uint64_t budget)
+{
+    // the deadline is carried by the thread object
+    std::uint64_t deadline = hpx::threads::get_self_id()->get_deadline();
+    HPX_TEST_LTE(created + budget, deadline);
+    HPX_TEST_LTE(deadline, hpx::util::high_resolution_clock::now() + budget);
+    ++count_invocations;
+}
+
+void test_no_deadline()
+{
+    HPX_TEST_EQ(hpx::threads::get_self_id()->get_deadline(),
+        std::uint64_t(0));
+    ++count_invocations;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the pending queue hands out the items ordered by their deadline
+void test_deadline_ordering()
+{
+    typedef hpx::util::tuple<
+            hpx::threads::thread_init_data, hpx::threads::thread_state_enum
+        > task_description;
+    typedef hpx::threads::policies::deadline_fifo::apply<
+            task_description*
+        >::type queue_type;
+
+    std::uint64_t const deadlines[] = { 30, 0, 10, 20, 0, 10 };
+    std::size_t const expected[] = { 2, 5, 3, 0, 1, 4 };
+
+    std::vector<task_description> tasks(6);
+    for (std::size_t i = 0; i != tasks.size(); ++i)
+        hpx::util::get<0>(tasks[i]).deadline = deadlines[i];
+
+    queue_type q;
+    HPX_TEST(q.empty());
+    for (task_description& t : tasks)
+        HPX_TEST(q.push(&t));
+
+    for (std::size_t i : expected)
+    {
+        task_description* t = nullptr;
+        HPX_TEST(q.pop(t));
+        HPX_TEST_EQ(t, &tasks[i]);
+    }
+
+    task_description* t = nullptr;
+    HPX_TEST(!q.pop(t));
+    HPX_TEST(q.empty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+boost::atomic<std::size_t> count_executed(0);
+
+template <typename F>
+void register_deadline_thread(F && f, std::uint64_t deadline,
+    std::size_t os_thread = std::size_t(-1))
+{
+    hpx::threads::thread_init_data data(
+        [f](hpx::threads::thread_state_ex_enum)
+        {
+            f();
+            ++count_executed;
+            return hpx::threads::thread_result_type(
+                hpx::threads::terminated, nullptr);
+        },
+        hpx::util::thread_description("deadline_thread"), 0,
+        hpx::threads::thread_priority_normal, os_thread);
+    data.deadline = deadline;
+
+    hpx::threads::register_thread_plain(data);
+}
+
+// wait for the registered threads without occupying a worker thread
+void wait_for_executed(std::size_t count)
+{
+    while (count_executed.load() != count)
+        hpx::this_thread::yield();
+}
+
+// the scheduler runs the pending threads of a worker thread ordered by their
+// deadline
+void test_edf_scheduling()
+{
+    std::size_t const num_threads = hpx::get_os_thread_count();
+    std::size_t const this_thread = hpx::get_worker_thread_num();
+
+    // keep all other worker threads busy, they would steal the threads
+    // otherwise
+    boost::atomic<std::size_t> busy(0);
+    boost::atomic<bool> release(false);
+    for (std::size_t i = 1; i != num_threads; ++i)
+    {
+        hpx::threads::register_thread_nullary(
+            [&busy, &release]()
+            {
+                ++busy;
+                while (!release.load())
+                    /**/;
+            });
+    }
+    while (busy.load() != num_threads - 1)
+        /**/;
+
+    // the threads are not run before this thread yields
+    std::size_t const offsets[] = { 5, 0, 3, 7, 0, 1, 6, 2, 4 };
+    std::size_t const num_tasks = sizeof(offsets) / sizeof(offsets[0]);
+
+    std::vector<std::size_t> order;
+    order.reserve(num_tasks);
+
+    count_executed.store(0);
+    std::uint64_t const base =
+        hpx::util::high_resolution_clock::now() + 1000000000;  // 1s
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        std::uint64_t deadline =
+            offsets[i] == 0 ? 0 : base + offsets[i] * 1000000;
+        register_deadline_thread(
+            [&order, i]() { order.push_back(i); }, deadline, this_thread);
+    }
+
+    wait_for_executed(num_tasks);
+    release.store(true);
+
+    // earliest deadline first, threads without deadline last
+    std::size_t const expected[] = { 5, 7, 2, 8, 0, 6, 3, 1, 4 };
+    HPX_TEST_EQ(order.size(), num_tasks);
+    HPX_TEST(std::equal(order.begin(), order.end(), expected));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t query_counter(std::string const& name, bool reset = false)
+{
+    using namespace hpx::performance_counters;
+
+    performance_counter c(name);
+    return c.get_counter_value(hpx::launch::sync, reset)
+        .get_value<std::int64_t>();
+}
+
+std::int64_t get_deadline_count(bool reset = false)
+{
+    return query_counter("/threads{locality#0/total}/count/deadlines", reset);
+}
+
+std::int64_t get_missed_deadline_count(bool reset = false)
+{
+    return query_counter(
+        "/threads{locality#0/total}/count/missed-deadlines", reset);
+}
+
+// threads finishing after their deadline are counted as missed
+void test_missed_deadlines()
+{
+    std::size_t const num_missed = 10;
+    std::size_t const num_met = 20;
+
+    get_deadline_count(true);
+    get_missed_deadline_count(true);
+
+    count_executed.store(0);
+
+    std::uint64_t const now = hpx::util::high_resolution_clock::now();
+    for (std::size_t i = 0; i != num_missed; ++i)
+        register_deadline_thread([]() {}, now + 1);
+    for (std::size_t i = 0; i != num_met; ++i)
+        register_deadline_thread([]() {}, now + 10000000000ull);  // 10s
+
+    // threads without deadline are not counted
+    for (std::size_t i = 0; i != num_met; ++i)
+        register_deadline_thread([]() {}, 0);
+
+    wait_for_executed(num_missed + 2 * num_met);
+
+    // the counters are updated once the threads have been destroyed
+    std::int64_t const num_deadlines = std::int64_t(num_missed + num_met);
+    std::uint64_t const start = hpx::util::high_resolution_clock::now();
+    while (get_deadline_count() < num_deadlines &&
+        hpx::util::high_resolution_clock::now() - start < 1000000000)
+    {
+        hpx::this_thread::yield();
+    }
+
+    HPX_TEST_EQ(get_deadline_count(), num_deadlines);
+    HPX_TEST_EQ(get_missed_deadline_count(), std::int64_t(num_missed));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    using hpx::threads::executors::default_executor;
+
+    test_deadline_ordering();
+    test_missed_deadlines();
+    test_edf_scheduling();
+
+    {
+        count_invocations.store(0);
+
+        std::uint64_t const budget = 1000000;     // 1ms
+        default_executor exec(std::chrono::milliseconds(1));
+
+        std::vector<hpx::future<void> > futures;
+        for (std::size_t i = 0; i != 100; ++i)
+        {
+            futures.push_back(hpx::async(exec, &test_deadline,
+                hpx::util::high_resolution_clock::now(), budget));
+        }
+
+        hpx::wait_all(futures);
+        HPX_TEST_EQ(count_invocations.load(), std::size_t(100));
+    }
+
+    {
+        count_invocations.store(0);
+
+        // recycled thread objects don't keep a stale deadline
+        std::vector<hpx::future<void> > futures;
+        for (std::size_t i = 0; i != 100; ++i)
+            futures.push_back(hpx::async(&test_no_deadline));
+
+        hpx::wait_all(futures);
+        HPX_TEST_EQ(count_invocations.load(), std::size_t(100));
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,125 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/thread_executors.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/runtime/threads/thread_data.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/atomic.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+boost::atomic<std::size_t> count_invocations(0);
+
+void test_nostack()
+{
+    HPX_TEST(hpx::threads::get_self_ptr());
+    HPX_TEST(hpx::threads::get_self_id() != hpx::threads::invalid_thread_id);
+
+    // no stack has been allocated for this thread, it runs on a borrowed one
+    HPX_TEST_EQ(hpx::threads::get_ctx_ptr()->get_stacksize(), 0);
+
+    ++count_invocations;
+}
+HPX_DECLARE_ACTION(test_nostack, test_nostack_action)
+HPX_ACTION_USES_NO_STACK(test_nostack_action)
+HPX_PLAIN_ACTION(test_nostack, test_nostack_action)
+
+// yielding gives control back to the scheduler, the thread continues on the
+// stack it has borrowed
+void test_nostack_yield()
+{
+    std::size_t value = 42;
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        hpx::this_thread::yield();
+        HPX_TEST_EQ(value, std::size_t(42));
+    }
+
+    HPX_TEST_EQ(hpx::threads::get_ctx_ptr()->get_stacksize(), 0);
+    ++count_invocations;
+}
+
+// suspending a stackless thread keeps its stack until it has finished running
+void test_nostack_suspend()
+{
+    hpx::lcos::local::promise<std::size_t> p;
+    hpx::future<std::size_t> f = p.get_future();
+
+    hpx::apply([&p]() { p.set_value(42); });
+    HPX_TEST_EQ(f.get(), std::size_t(42));
+
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    HPX_TEST_EQ(hpx::threads::get_ctx_ptr()->get_stacksize(), 0);
+    ++count_invocations;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    hpx::threads::executors::default_executor exec(
+        hpx::threads::thread_stacksize_nostack);
+
+    {
+        count_invocations.store(0);
+
+        std::vector<hpx::future<void> > futures;
+        for (std::size_t i = 0; i != 1000; ++i)
+            futures.push_back(hpx::async(exec, &test_nostack));
+
+        hpx::wait_all(futures);
+        HPX_TEST_EQ(count_invocations.load(), std::size_t(1000));
+    }
+
+    {
+        count_invocations.store(0);
+
+        test_nostack_action act;
+        act(hpx::find_here());
+        HPX_TEST_EQ(count_invocations.load(), std::size_t(1));
+    }
+
+    {
+        // continuations can be run on stackless threads as well
+        hpx::future<int> f = hpx::async([]() { return 42; });
+        hpx::future<int> cont = f.then(exec,
+            [](hpx::future<int> && f)
+            {
+                HPX_TEST_EQ(hpx::threads::get_ctx_ptr()->get_stacksize(), 0);
+                return f.get() + 1;
+            });
+        HPX_TEST_EQ(cont.get(), 43);
+    }
+
+    for (auto f : { &test_nostack_yield, &test_nostack_suspend })
+    {
+        count_invocations.store(0);
+
+        std::vector<hpx::future<void> > futures;
+        for (std::size_t i = 0; i != 100; ++i)
+            futures.push_back(hpx::async(exec, f));
+
+        hpx::wait_all(futures);
+        HPX_TEST_EQ(count_invocations.load(), std::size_t(100));
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
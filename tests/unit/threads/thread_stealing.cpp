@@ -0,0 +1,235 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that a single steal operation moves at most half of the
+// pending threads of the victim queue, and that the stealing performed by the
+// local-priority scheduler is reported per level of the machine hierarchy
+// (/threads/count/steals/*).
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/runtime/threads/policies/thread_queue.hpp>
+#include <hpx/runtime/threads/thread_data.hpp>
+#include <hpx/runtime/threads/thread_init_data.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+typedef hpx::threads::policies::thread_queue<> queue_type;
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::threads::thread_result_type never_run(hpx::threads::thread_state_ex_enum)
+{
+    HPX_TEST(false);
+    return hpx::threads::thread_result_type(hpx::threads::terminated,
+        hpx::threads::invalid_thread_id);
+}
+
+void add_threads(queue_type& q, std::size_t count,
+    std::size_t affinity_hint = std::size_t(-1))
+{
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        hpx::threads::thread_init_data data(&never_run,
+            hpx::util::thread_description("never_run"));
+        data.affinity_hint = affinity_hint;
+
+        q.create_thread(data, nullptr, hpx::threads::pending, true,
+            hpx::throws);
+    }
+}
+
+// remove all pending threads from the queues without running them
+void clear_threads(queue_type& owner, queue_type& other)
+{
+    boost::int64_t busy_count = 0;
+
+    hpx::threads::thread_data* thrd = nullptr;
+    while (owner.get_next_thread(thrd) || other.get_next_thread(thrd))
+    {
+        thrd->set_state(hpx::threads::terminated, hpx::threads::wait_unknown);
+        HPX_TEST(owner.destroy_thread(thrd, busy_count));
+    }
+    owner.cleanup_terminated(true);
+}
+
+void test_steal_half(std::size_t count)
+{
+    queue_type victim;
+    queue_type thief;
+
+    add_threads(victim, count);
+    HPX_TEST_EQ(victim.get_pending_queue_length(), boost::int64_t(count));
+
+    hpx::threads::thread_data* thrd = nullptr;
+    std::size_t stolen = thief.steal_next_threads(&victim, thrd);
+
+    // the first of the stolen threads is returned, the others are moved to
+    // the queue of the thief
+    HPX_TEST_EQ(stolen, (count + 1) / 2);
+    HPX_TEST(thrd != nullptr);
+    HPX_TEST_EQ(thief.get_pending_queue_length(), boost::int64_t(stolen - 1));
+    HPX_TEST_EQ(victim.get_pending_queue_length(),
+        boost::int64_t(count - stolen));
+
+    // at most half of the remaining threads are stolen by the next steal
+    // operation
+    hpx::threads::thread_data* next = nullptr;
+    std::size_t const remaining = count - stolen;
+    std::size_t stolen_next = thief.steal_next_threads(&victim, next);
+
+    HPX_TEST_EQ(stolen_next, (remaining + 1) / 2);
+    HPX_TEST_EQ(victim.get_pending_queue_length(),
+        boost::int64_t(remaining - stolen_next));
+
+    // put the returned threads back to be able to clean up
+    thief.schedule_thread(thrd);
+    if (stolen_next != 0)
+        thief.schedule_thread(next);
+
+    clear_threads(victim, thief);
+}
+
+void test_steal_empty()
+{
+    queue_type victim;
+    queue_type thief;
+
+    hpx::threads::thread_data* thrd = nullptr;
+    HPX_TEST_EQ(thief.steal_next_threads(&victim, thrd), std::size_t(0));
+    HPX_TEST_EQ(thief.get_pending_queue_length(), 0);
+}
+
+void test_steal_affine()
+{
+    queue_type victim;
+    queue_type thief;
+
+    add_threads(victim, 4, 0);
+
+    // queues holding hinted threads are skipped if asked to do so
+    hpx::threads::thread_data* thrd = nullptr;
+    HPX_TEST_EQ(thief.steal_next_threads(&victim, thrd, false),
+        std::size_t(0));
+    HPX_TEST_EQ(victim.get_pending_queue_length(), 4);
+
+    std::size_t stolen = thief.steal_next_threads(&victim, thrd, true);
+    HPX_TEST_EQ(stolen, std::size_t(2));
+
+    thief.schedule_thread(thrd);
+    clear_threads(victim, thief);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+char const* const steal_levels[] =
+{
+    "core", "numa-node", "socket", "machine"
+};
+
+boost::int64_t get_num_steals(std::string const& instance, bool reset = false)
+{
+    using hpx::performance_counters::performance_counter;
+
+    boost::int64_t num_steals = 0;
+    for (char const* level : steal_levels)
+    {
+        performance_counter c("/threads{locality#0/" + instance +
+            "}/count/steals/" + level);
+
+        boost::int64_t value = c.get_counter_value(hpx::launch::sync, reset)
+            .get_value<boost::int64_t>();
+
+        HPX_TEST_LTE(0, value);
+        num_steals += value;
+    }
+    return num_steals;
+}
+
+boost::atomic<std::size_t> count_tasks(0);
+boost::atomic<std::size_t> count_foreign_tasks(0);
+
+void busy_task()
+{
+    // keep the worker thread busy long enough for the others to steal
+    boost::uint64_t const start = hpx::util::high_resolution_clock::now();
+    while (hpx::util::high_resolution_clock::now() - start < 20000)
+        /**/;
+
+    if (hpx::get_worker_thread_num() != 0)
+        ++count_foreign_tasks;
+    ++count_tasks;
+}
+
+void test_steal_counters()
+{
+    std::size_t const num_threads = hpx::get_os_thread_count();
+    std::size_t const num_tasks = 1000;
+
+    get_num_steals("total", true);
+    for (std::size_t i = 0; i != num_threads; ++i)
+        get_num_steals("worker-thread#" + std::to_string(i), true);
+
+    // create an imbalance by putting all of the work onto the first worker
+    // thread
+    count_tasks.store(0);
+    count_foreign_tasks.store(0);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        hpx::threads::register_work_nullary(&busy_task, "busy_task",
+            hpx::threads::pending, hpx::threads::thread_priority_normal, 0);
+    }
+
+    while (count_tasks.load() != num_tasks)
+        hpx::this_thread::yield();
+
+    if (num_threads == 1)
+    {
+        HPX_TEST_EQ(get_num_steals("total"), 0);
+        return;
+    }
+
+    // the idle worker threads have stolen some of the work, every steal
+    // operation is reported on one of the levels
+    HPX_TEST_LT(std::size_t(0), count_foreign_tasks.load());
+
+    boost::int64_t const num_steals = get_num_steals("total");
+    HPX_TEST_LT(0, num_steals);
+
+    boost::int64_t num_steals_per_thread = 0;
+    for (std::size_t i = 0; i != num_threads; ++i)
+        num_steals_per_thread +=
+            get_num_steals("worker-thread#" + std::to_string(i));
+    HPX_TEST_LTE(num_steals, num_steals_per_thread);
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_steal_empty();
+    for (std::size_t count : { 1, 2, 7, 100 })
+        test_steal_half(count);
+    test_steal_affine();
+
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+    test_steal_counters();
+#endif
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
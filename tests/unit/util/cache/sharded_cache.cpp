@@ -0,0 +1,285 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/util/cache/lru_cache.hpp>
+#include <hpx/util/cache/sharded_cache.hpp>
+#include <hpx/util/cache/statistics/local_statistics.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/cstdint.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// keys representing ranges of integers, a key for a single value compares
+// equal to all ranges containing it
+struct range_key
+{
+    range_key(boost::uint64_t first = 0, boost::uint64_t count = 1)
+      : first_(first), count_(count)
+    {}
+
+    friend bool operator<(range_key const& lhs, range_key const& rhs)
+    {
+        return lhs.first_ + lhs.count_ <= rhs.first_;
+    }
+
+    boost::uint64_t first_;
+    boost::uint64_t count_;
+};
+
+// ranges are stored in the cache shared by all shards
+struct range_sharding
+{
+    std::size_t operator()(range_key const& key, std::size_t num_shards) const
+    {
+        if (key.count_ != 1)
+            return num_shards;
+        return static_cast<std::size_t>(key.first_ % num_shards);
+    }
+};
+
+typedef hpx::util::cache::sharded_cache<
+        hpx::util::cache::lru_cache<
+            range_key, std::string,
+            hpx::util::cache::statistics::local_statistics>,
+        range_sharding
+    > range_cache_type;
+
+typedef range_cache_type::statistics_type stats_type;
+
+boost::int64_t get_statistics(range_cache_type& c,
+    std::size_t (stats_type::*f)(bool), bool reset = false)
+{
+    return c.accumulate_statistics(
+        [f, reset](stats_type& stat)
+        {
+            return boost::int64_t((stat.*f)(reset));
+        });
+}
+
+template <typename Key>
+bool always(Key const&, Key const&)
+{
+    return true;
+}
+
+bool check_for_collisions(range_key const& new_key, range_key const& old_key)
+{
+    return new_key.first_ != old_key.first_ ||
+        new_key.count_ != old_key.count_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_single_keys()
+{
+    typedef hpx::util::cache::sharded_cache<
+            hpx::util::cache::lru_cache<std::string, std::string>
+        > cache_type;
+
+    cache_type c(4);
+    c.reserve(16);
+    HPX_TEST_EQ(c.num_shards(), std::size_t(4));
+
+    HPX_TEST(c.update_if("white", "255,255,255", &always<std::string>));
+    HPX_TEST(c.update_if("black", "0,0,0", &always<std::string>));
+    HPX_TEST(c.update_if("green", "0,255,0", &always<std::string>));
+    HPX_TEST_EQ(c.size(), std::size_t(3));
+
+    std::string key, value;
+    HPX_TEST(c.get_entry("black", key, value));
+    HPX_TEST_EQ(key, std::string("black"));
+    HPX_TEST_EQ(value, std::string("0,0,0"));
+    HPX_TEST(!c.get_entry("blue", key, value));
+
+    HPX_TEST_EQ(c.erase(
+        [](std::pair<std::string, std::string> const& p)
+        {
+            return p.first == "white";
+        }), std::size_t(1));
+    HPX_TEST(!c.get_entry("white", key, value));
+    HPX_TEST_EQ(c.size(), std::size_t(2));
+
+    HPX_TEST_EQ(c.clear(), std::size_t(2));
+    HPX_TEST_EQ(c.size(), std::size_t(0));
+}
+
+void test_ranges()
+{
+    range_cache_type c(8);
+    c.reserve(64);
+
+    // a range is visible from all of its elements
+    HPX_TEST(c.update_if(range_key(100, 20), "range", &check_for_collisions));
+    HPX_TEST(c.update_if(range_key(200), "single", &check_for_collisions));
+
+    for (boost::uint64_t i = 100; i != 120; ++i)
+    {
+        range_key key;
+        std::string value;
+        HPX_TEST(c.get_entry(range_key(i), key, value));
+        HPX_TEST_EQ(key.first_, boost::uint64_t(100));
+        HPX_TEST_EQ(key.count_, boost::uint64_t(20));
+        HPX_TEST_EQ(value, std::string("range"));
+    }
+
+    range_key key;
+    std::string value;
+    HPX_TEST(!c.get_entry(range_key(120), key, value));
+    HPX_TEST(c.get_entry(range_key(200), key, value));
+    HPX_TEST_EQ(value, std::string("single"));
+
+    // updating the same range succeeds, an overlapping range is rejected
+    HPX_TEST(c.update_if(range_key(100, 20), "range", &check_for_collisions));
+    HPX_TEST(!c.update_if(range_key(110, 20), "other", &check_for_collisions));
+
+    // the range has been stored once
+    HPX_TEST_EQ(c.size(), std::size_t(2));
+    HPX_TEST_EQ(get_statistics(c, &stats_type::insertions), boost::int64_t(2));
+}
+
+void test_range_collisions()
+{
+    range_cache_type c(8);
+    c.reserve(64);
+
+    HPX_TEST(c.update_if(range_key(100, 20), "range", &check_for_collisions));
+
+    // single keys overlapping a range are rejected, even though they are
+    // stored in a different shard
+    for (boost::uint64_t i = 100; i != 120; ++i)
+    {
+        HPX_TEST(!c.update_if(range_key(i), "single", &check_for_collisions));
+    }
+    HPX_TEST(c.update_if(range_key(120), "single", &check_for_collisions));
+    HPX_TEST_EQ(c.size(), std::size_t(2));
+
+    // a removed range is not visible from its elements anymore
+    HPX_TEST_EQ(c.erase(
+        [](std::pair<range_key, std::string> const& p)
+        {
+            return p.first.count_ != 1;
+        }), std::size_t(1));
+
+    range_key key;
+    std::string value;
+    HPX_TEST(!c.get_entry(range_key(105), key, value));
+    HPX_TEST(c.update_if(range_key(105), "single", &check_for_collisions));
+    HPX_TEST(c.get_entry(range_key(105), key, value));
+    HPX_TEST_EQ(value, std::string("single"));
+}
+
+void test_statistics()
+{
+    range_cache_type c(8);
+    c.reserve(64);
+
+    c.update_if(range_key(100, 20), "range", &check_for_collisions);
+    c.update_if(range_key(200), "single", &check_for_collisions);
+
+    get_statistics(c, &stats_type::hits, true);
+    get_statistics(c, &stats_type::misses, true);
+
+    // each lookup is accounted for exactly once, independently of where the
+    // key was found
+    range_key key;
+    std::string value;
+    HPX_TEST(c.get_entry(range_key(105), key, value));
+    HPX_TEST(c.get_entry(range_key(200), key, value));
+    HPX_TEST(!c.get_entry(range_key(300), key, value));
+
+    HPX_TEST_EQ(get_statistics(c, &stats_type::hits), boost::int64_t(2));
+    HPX_TEST_EQ(get_statistics(c, &stats_type::misses), boost::int64_t(1));
+}
+
+void test_capacity()
+{
+    range_cache_type c(4);
+    c.reserve(8);
+
+    for (boost::uint64_t i = 0; i != 100; ++i)
+        c.update_if(range_key(i), "value", &check_for_collisions);
+
+    // each shard holds its share of the overall capacity
+    HPX_TEST_EQ(c.size(), std::size_t(8));
+
+    HPX_TEST_EQ(get_statistics(c, &stats_type::evictions), boost::int64_t(92));
+}
+
+void test_range_capacity()
+{
+    range_cache_type c(4);
+    c.reserve(8);
+
+    // the ranges are not limited by the capacity of a single shard
+    for (boost::uint64_t i = 0; i != 8; ++i)
+        c.update_if(range_key(i * 10, 10), "range", &check_for_collisions);
+
+    HPX_TEST_EQ(c.size(), std::size_t(8));
+    HPX_TEST_EQ(get_statistics(c, &stats_type::evictions), boost::int64_t(0));
+
+    for (boost::uint64_t i = 0; i != 8; ++i)
+    {
+        range_key key;
+        std::string value;
+        HPX_TEST(c.get_entry(range_key(i * 10 + 5), key, value));
+    }
+
+    c.update_if(range_key(80, 10), "range", &check_for_collisions);
+    HPX_TEST_EQ(c.size(), std::size_t(8));
+    HPX_TEST_EQ(get_statistics(c, &stats_type::evictions), boost::int64_t(1));
+}
+
+void test_concurrent_access()
+{
+    range_cache_type c(16);
+    c.reserve(16000);
+
+    std::size_t const num_tasks = 8;
+    boost::uint64_t const num_keys = 1000;
+
+    std::vector<hpx::future<void> > tasks;
+    for (std::size_t t = 0; t != num_tasks; ++t)
+    {
+        tasks.push_back(hpx::async(
+            [&c, t, num_keys]()
+            {
+                for (boost::uint64_t i = 0; i != num_keys; ++i)
+                {
+                    boost::uint64_t k = t * num_keys + i;
+                    c.update_if(range_key(k), std::to_string(k),
+                        &check_for_collisions);
+
+                    range_key key;
+                    std::string value;
+                    HPX_TEST(c.get_entry(range_key(k), key, value));
+                    HPX_TEST_EQ(value, std::to_string(k));
+                }
+            }));
+    }
+    hpx::wait_all(tasks);
+
+    HPX_TEST_EQ(c.size(), num_tasks * num_keys);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_single_keys();
+    test_ranges();
+    test_range_collisions();
+    test_statistics();
+    test_capacity();
+    test_range_capacity();
+    test_concurrent_access();
+
+    return hpx::util::report_errors();
+}
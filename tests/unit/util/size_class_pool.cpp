@@ -0,0 +1,113 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/util/lightweight_test.hpp>
+#include <hpx/util/size_class_pool.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+typedef hpx::util::size_class_pool<> pool_type;
+typedef hpx::util::size_class_pool_allocator<char> allocator_type;
+typedef std::vector<char, allocator_type> buffer_type;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_size_classes()
+{
+    pool_type pool(4096, 2);
+
+    // the first allocation of any size class is served from the heap
+    char* p1 = pool.allocate(100);
+    HPX_TEST_EQ(pool.get_misses(true), 1);
+    HPX_TEST_EQ(pool.get_hits(true), 0);
+
+    // a block is reused for any request falling into the same size class
+    pool.deallocate(p1, 100);
+    char* p2 = pool.allocate(128);
+    HPX_TEST_EQ(p1, p2);
+    HPX_TEST_EQ(pool.get_hits(true), 1);
+
+    // but not for a different one
+    pool.deallocate(p2, 128);
+    char* p3 = pool.allocate(129);
+    HPX_TEST_EQ(pool.get_misses(true), 1);
+    pool.deallocate(p3, 129);
+
+    // large blocks are never pooled
+    char* p4 = pool.allocate(8192);
+    pool.deallocate(p4, 8192);
+    char* p5 = pool.allocate(8192);
+    HPX_TEST_EQ(pool.get_misses(true), 2);
+    HPX_TEST_EQ(pool.get_hits(true), 0);
+    pool.deallocate(p5, 8192);
+
+    // the number of cached blocks per size class is bounded
+    char* p6 = pool.allocate(64);
+    char* p7 = pool.allocate(64);
+    char* p8 = pool.allocate(64);
+    pool.deallocate(p6, 64);
+    pool.deallocate(p7, 64);
+    pool.deallocate(p8, 64);
+    pool.get_misses(true);
+
+    p6 = pool.allocate(64);
+    p7 = pool.allocate(64);
+    p8 = pool.allocate(64);
+    HPX_TEST_EQ(pool.get_hits(true), 2);
+    HPX_TEST_EQ(pool.get_misses(true), 1);
+
+    pool.deallocate(p6, 64);
+    pool.deallocate(p7, 64);
+    pool.deallocate(p8, 64);
+}
+
+void test_allocator()
+{
+    std::shared_ptr<pool_type> p = std::make_shared<pool_type>();
+    pool_type& pool = *p;
+    allocator_type alloc(p);
+
+    {
+        buffer_type buffer(alloc);
+        buffer.resize(1000);
+        HPX_TEST_EQ(pool.get_misses(true), 1);
+    }
+
+    // the memory of a destroyed buffer is reused by the next one
+    {
+        buffer_type buffer(alloc);
+        buffer.resize(1000);
+        HPX_TEST_EQ(pool.get_hits(true), 1);
+        HPX_TEST_EQ(pool.get_misses(true), 0);
+
+        // the allocator travels with the memory when the buffer is moved
+        buffer_type other(std::move(buffer));
+        HPX_TEST(other.get_allocator() == alloc);
+    }
+    HPX_TEST_EQ(pool.get_hits(true), 0);
+
+    // copies of an empty buffer can be used as chunk buffers
+    std::vector<buffer_type> chunks;
+    chunks.resize(2, buffer_type(alloc));
+    chunks[0].resize(10);
+    chunks[1].resize(10);
+    HPX_TEST_EQ(pool.get_hits(true) + pool.get_misses(true), 2);
+
+    // the pool stays alive as long as memory allocated from it is in use
+    p.reset();
+    HPX_TEST(chunks[0].get_allocator() == alloc);
+    chunks.clear();
+}
+
+int main()
+{
+    test_size_classes();
+    test_allocator();
+
+    return hpx::util::report_errors();
+}